@@ -0,0 +1,102 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Replays a branch trace through one or more branch predictors without
+# simulating a CPU. This measures predictor accuracy and host throughput
+# in isolation. Traces are either branch traces (src/proto/branch.proto),
+# as written by a BranchTraceRecorder attached to a CPU's branch
+# predictor, or InstPBTrace instruction traces. Several predictors are
+# replayed in parallel, e.g.:
+#
+#   gem5.opt configs/example/bpred_trace_replay.py --trace=branches.trc.gz \
+#       --bp-type=TAGE_SC_L_64KB --bp-type=LTAGE --bp-type=TournamentBP
+
+import argparse
+import sys
+
+import m5
+from m5.objects import *
+from m5.util import addToPath
+
+addToPath("../")
+
+from common import ObjectList
+
+parser = argparse.ArgumentParser(
+    description="Replay a branch trace through a branch predictor"
+)
+parser.add_argument("--trace", required=True, help="Trace file to replay")
+parser.add_argument(
+    "--trace-format",
+    default="Branch",
+    choices=["Branch", "Inst"],
+    help="Branch trace or InstPBTrace instruction trace",
+)
+parser.add_argument(
+    "--bp-type",
+    action="append",
+    choices=ObjectList.bp_list.get_names(),
+    help="Branch predictor to evaluate, may be given multiple times",
+)
+parser.add_argument(
+    "--num-threads",
+    type=int,
+    default=1,
+    help="Number of hardware threads recorded in the trace",
+)
+parser.add_argument(
+    "--max-branches",
+    type=int,
+    default=0,
+    help="Stop after this many branches (0 replays the whole trace)",
+)
+parser.add_argument(
+    "--replay-threads",
+    type=int,
+    default=0,
+    help="Host threads used for replay (0 uses one per host core)",
+)
+
+args = parser.parse_args()
+
+bp_types = args.bp_type or ["TAGE_SC_L_64KB"]
+
+root = Root(full_system=False)
+root.replayer = BranchTraceReplayer(
+    numThreads=args.num_threads,
+    predictors=[ObjectList.bp_list.get(bp)() for bp in bp_types],
+    trace_file=args.trace,
+    trace_format=args.trace_format,
+    max_branches=args.max_branches,
+    replay_threads=args.replay_threads,
+)
+
+m5.instantiate()
+
+replayed = root.replayer.replay()
+print(f"Replayed {replayed} branches through {', '.join(bp_types)}")
+
+m5.stats.dump()
@@ -0,0 +1,128 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Measures the host cost of an L1 hit in timing mode. A traffic generator
+# first sweeps a footprint that fits in the cache to warm it up, then
+# keeps issuing reads to the same footprint so that every access hits.
+# Only the hit phase is timed, e.g.:
+#
+#   gem5.opt configs/example/cache_hit_bench.py --accesses=2000000
+
+import argparse
+import time
+
+import m5
+from m5.objects import *
+
+parser = argparse.ArgumentParser(
+    description="Measure the host time per L1 cache hit"
+)
+parser.add_argument(
+    "--accesses", type=int, default=1000000, help="Hits to time"
+)
+parser.add_argument(
+    "--footprint", default="16KiB", help="Bytes touched by the accesses"
+)
+parser.add_argument("--l1-size", default="32KiB", help="L1 cache size")
+parser.add_argument("--l1-assoc", type=int, default=8, help="L1 assoc")
+parser.add_argument(
+    "--rd-perc", type=int, default=100, help="Percentage of reads"
+)
+
+args = parser.parse_args()
+
+period = 1000
+block_size = 64
+footprint = int(m5.util.convert.toMemorySize(args.footprint))
+
+system = System(cache_line_size=block_size, mem_mode="timing")
+system.clk_domain = SrcClockDomain(
+    clock="1GHz", voltage_domain=VoltageDomain()
+)
+system.mem_ranges = [AddrRange("512MiB")]
+
+system.tgen = PyTrafficGen()
+system.l1 = Cache(
+    size=args.l1_size,
+    assoc=args.l1_assoc,
+    tag_latency=1,
+    data_latency=1,
+    response_latency=1,
+    mshrs=8,
+    tgts_per_mshr=8,
+)
+system.membus = SystemXBar()
+system.mem = SimpleMemory(range=system.mem_ranges[0])
+
+system.tgen.port = system.l1.cpu_side
+system.l1.mem_side = system.membus.cpu_side_ports
+system.mem.port = system.membus.mem_side_ports
+system.system_port = system.membus.cpu_side_ports
+
+root = Root(full_system=False, system=system)
+
+m5.instantiate()
+
+
+def phases():
+    # warm up with one pass over the footprint, then time the hits
+    yield system.tgen.createLinear(
+        (footprint // block_size) * period * 10,
+        0,
+        footprint - 1,
+        block_size,
+        period * 10,
+        period * 10,
+        100,
+        0,
+    )
+    yield system.tgen.createExit(0)
+    yield system.tgen.createLinear(
+        args.accesses * period,
+        0,
+        footprint - 1,
+        block_size,
+        period,
+        period,
+        args.rd_perc,
+        0,
+    )
+    yield system.tgen.createExit(0)
+
+
+system.tgen.start(phases())
+
+m5.simulate()
+m5.stats.reset()
+
+start = time.perf_counter()
+m5.simulate()
+elapsed = time.perf_counter() - start
+
+print(f"{args.accesses} hits in {elapsed:.3f} s host time")
+print(f"{elapsed / args.accesses * 1e9:.1f} ns per hit")
+
+m5.stats.dump()
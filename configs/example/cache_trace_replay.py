@@ -0,0 +1,139 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Replays a packet trace through a set of cache models, made of the tags,
+# replacement policy and prefetcher of a cache, without a timing
+# simulation. Hit rates and prefetch accuracy and coverage are reported
+# for every combination of the given sizes, associativities, replacement
+# policies and prefetchers, and the models are replayed in parallel.
+# Packet traces (src/proto/packet.proto) are written by a MemTraceProbe
+# attached to a CommMonitor, e.g.:
+#
+#   gem5.opt configs/example/cache_trace_replay.py --trace=l2.trc.gz \
+#       --size=1MiB --size=2MiB --rp-type=LRURP --rp-type=RRIPRP \
+#       --hwp-type=none --hwp-type=BOPPrefetcher
+
+import argparse
+import itertools
+
+import m5
+from m5.objects import *
+from m5.util import addToPath
+
+addToPath("../")
+
+from common import ObjectList
+
+parser = argparse.ArgumentParser(
+    description="Replay a packet trace through cache models"
+)
+parser.add_argument("--trace", required=True, help="Trace file to replay")
+parser.add_argument(
+    "--size", action="append", help="Cache size, may be given multiple times"
+)
+parser.add_argument(
+    "--assoc",
+    action="append",
+    type=int,
+    help="Associativity, may be given multiple times",
+)
+parser.add_argument(
+    "--rp-type",
+    action="append",
+    choices=ObjectList.rp_list.get_names(),
+    help="Replacement policy, may be given multiple times",
+)
+parser.add_argument(
+    "--hwp-type",
+    action="append",
+    choices=["none"] + ObjectList.hwp_list.get_names(),
+    help="Prefetcher, may be given multiple times",
+)
+parser.add_argument(
+    "--cacheline-size", type=int, default=64, help="Block size in bytes"
+)
+parser.add_argument(
+    "--prefetches-per-access",
+    type=int,
+    default=1,
+    help="Prefetches filled after each access",
+)
+parser.add_argument(
+    "--max-accesses",
+    type=int,
+    default=0,
+    help="Stop after this many accesses (0 replays the whole trace)",
+)
+parser.add_argument(
+    "--replay-threads",
+    type=int,
+    default=0,
+    help="Host threads used for replay (0 uses one per host core)",
+)
+
+args = parser.parse_args()
+
+configs = list(
+    itertools.product(
+        args.size or ["1MiB"],
+        args.assoc or [16],
+        args.rp_type or ["LRURP"],
+        args.hwp_type or ["none"],
+    )
+)
+
+models = []
+for size, assoc, rp_type, hwp_type in configs:
+    model = TraceCacheModel(
+        size=size,
+        assoc=assoc,
+        replacement_policy=ObjectList.rp_list.get(rp_type)(),
+        prefetches_per_access=args.prefetches_per_access,
+    )
+    if hwp_type != "none":
+        model.prefetcher = ObjectList.hwp_list.get(hwp_type)()
+    models.append(model)
+
+root = Root(full_system=False)
+root.system = System(cache_line_size=args.cacheline_size)
+root.system.clk_domain = SrcClockDomain(
+    clock="1GHz", voltage_domain=VoltageDomain()
+)
+root.system.replayer = CacheTraceReplayer(
+    models=models,
+    trace_file=args.trace,
+    max_accesses=args.max_accesses,
+    replay_threads=args.replay_threads,
+)
+
+m5.instantiate()
+
+replayed = root.system.replayer.replay()
+print(f"Replayed {replayed} accesses through {len(models)} model(s):")
+for i, (size, assoc, rp_type, hwp_type) in enumerate(configs):
+    print(f"  {i}: {size} {assoc}-way {rp_type} {hwp_type}")
+
+m5.stats.dump()
@@ -0,0 +1,90 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Replays a packet trace through a hardware prefetcher without simulating
+# a cache, to measure the host cost of training and queueing prefetches.
+# Packet traces (src/proto/packet.proto) are written by a MemTraceProbe
+# attached to a CommMonitor, e.g.:
+#
+#   gem5.opt configs/example/prefetch_trace_replay.py --trace=l2.trc.gz \
+#       --hwp-type=SignaturePathPrefetcherV2 --prefetches-per-access=2
+
+import argparse
+
+import m5
+from m5.objects import *
+from m5.util import addToPath
+
+addToPath("../")
+
+from common import ObjectList
+
+parser = argparse.ArgumentParser(
+    description="Replay a packet trace through a prefetcher"
+)
+parser.add_argument("--trace", required=True, help="Trace file to replay")
+parser.add_argument(
+    "--hwp-type",
+    default="StridePrefetcher",
+    choices=ObjectList.hwp_list.get_names(),
+    help="Prefetcher to evaluate",
+)
+parser.add_argument(
+    "--cacheline-size", type=int, default=64, help="Block size in bytes"
+)
+parser.add_argument(
+    "--max-accesses",
+    type=int,
+    default=0,
+    help="Stop after this many accesses (0 replays the whole trace)",
+)
+parser.add_argument(
+    "--prefetches-per-access",
+    type=int,
+    default=1,
+    help="Prefetches taken from the prefetcher after each access",
+)
+
+args = parser.parse_args()
+
+root = Root(full_system=False)
+root.system = System(cache_line_size=args.cacheline_size)
+root.system.clk_domain = SrcClockDomain(
+    clock="1GHz", voltage_domain=VoltageDomain()
+)
+root.system.replayer = PrefetcherTraceReplayer(
+    prefetcher=ObjectList.hwp_list.get(args.hwp_type)(),
+    trace_file=args.trace,
+    max_accesses=args.max_accesses,
+    prefetches_per_access=args.prefetches_per_access,
+)
+
+m5.instantiate()
+
+replayed = root.system.replayer.replay()
+print(f"Replayed {replayed} accesses through {args.hwp_type}")
+
+m5.stats.dump()
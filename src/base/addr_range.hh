@@ -315,6 +315,27 @@ class AddrRange
      */
     uint32_t stripes() const { return 1ULL << masks.size(); }
 
+    /**
+     * Get the interleaving masks. Each mask determines the bits that
+     * are xor'ed to get one bit of the interleaving select value,
+     * starting from the least significant bit.
+     *
+     * @return The interleaving masks, empty if not interleaved
+     *
+     * @ingroup api_addr_range
+     */
+    const std::vector<Addr> &intlvMasks() const { return masks; }
+
+    /**
+     * Get the interleaving select value of the stripe this range
+     * covers.
+     *
+     * @return The select value, zero if not interleaved
+     *
+     * @ingroup api_addr_range
+     */
+    uint8_t intlvMatchValue() const { return intlvMatch; }
+
     /**
      * Get the size of the address range. For a case where
      * interleaving is used we make the simplifying assumption that
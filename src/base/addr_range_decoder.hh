@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_ADDR_RANGE_DECODER_HH__
+#define __BASE_ADDR_RANGE_DECODER_HH__
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "base/addr_range.hh"
+#include "base/bitfield.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+/**
+ * A flat, read-only address decoder for a set of non-overlapping
+ * address ranges, such as the contents of an AddrRangeMap.
+ *
+ * Ranges are grouped into segments sorted by start address. All the
+ * stripes of an interleaved range share a segment, with a table holding
+ * the value of each stripe indexed by its interleaving select value.
+ * A lookup is a binary search over the segment start addresses followed
+ * by a select value computation. When the interleaving bits are
+ * contiguous and not hashed, as for power-of-two channel or slice
+ * interleaving, the select value is a single shift and mask.
+ *
+ * Lookups give the same results as AddrRangeMap::contains. The decoder
+ * does not track changes, build() must be called again whenever the
+ * set of ranges changes.
+ */
+template <typename V>
+class AddrRangeDecoder
+{
+  private:
+    struct Segment
+    {
+        /** First and last address covered, both inclusive */
+        Addr start;
+        Addr last;
+
+        /** Interleaving masks, empty if not interleaved */
+        std::vector<Addr> masks;
+
+        /** Size of a contiguous chunk of a stripe */
+        Addr granularity;
+
+        /**
+         * Are the interleaving bits contiguous, one bit per mask, in
+         * which case the select value is (addr >> shift) & selMask
+         */
+        bool direct;
+        unsigned shift;
+        Addr selMask;
+
+        /** Value per select value, and if any range provides it */
+        std::vector<V> values;
+        std::vector<bool> valid;
+
+        bool interleaved() const { return !masks.empty(); }
+
+        unsigned
+        select(Addr a) const
+        {
+            if (direct)
+                return (a >> shift) & selMask;
+
+            unsigned sel = 0;
+            for (unsigned i = 0; i < masks.size(); i++)
+                sel |= (popCount(a & masks[i]) % 2) << i;
+            return sel;
+        }
+    };
+
+    /** Segment start addresses, kept apart to make the search compact */
+    std::vector<Addr> starts;
+    std::vector<Segment> segments;
+
+    /** All ranges, for the rare lookups the fast path does not handle */
+    std::vector<std::pair<AddrRange, V>> entries;
+
+    const V *
+    findSlow(const AddrRange &r) const
+    {
+        for (const auto &entry : entries) {
+            if (r.isSubset(entry.first))
+                return &entry.second;
+        }
+        return nullptr;
+    }
+
+  public:
+    /**
+     * Build the decoder from (AddrRange, value) pairs sorted by range,
+     * as found when iterating over an AddrRangeMap. The ranges must not
+     * intersect.
+     *
+     * @param map Container of sorted (AddrRange, value) pairs
+     */
+    template <typename Map>
+    void
+    build(const Map &map)
+    {
+        clear();
+
+        for (const auto &entry : map) {
+            const AddrRange &r = entry.first;
+            entries.emplace_back(r, entry.second);
+
+            // stripes of an interleaved range are next to each other
+            // in the sorted ranges and all share the same segment
+            if (segments.empty() || !r.interleaved() ||
+                !entries[entries.size() - 2].first.mergesWith(r)) {
+                Segment seg;
+                seg.start = r.start();
+                seg.last = r.end() - 1;
+                seg.masks = r.intlvMasks();
+                seg.granularity = r.granularity();
+
+                seg.direct = true;
+                seg.shift = seg.masks.empty() ? 0 : ctz64(seg.masks[0]);
+                seg.selMask = r.stripes() - 1;
+                for (unsigned i = 0; i < seg.masks.size(); i++) {
+                    seg.direct = seg.direct &&
+                        seg.masks[i] == (Addr(1) << (seg.shift + i));
+                }
+
+                seg.values.resize(r.stripes());
+                seg.valid.resize(r.stripes(), false);
+
+                starts.push_back(seg.start);
+                segments.push_back(std::move(seg));
+            }
+
+            Segment &seg = segments.back();
+            seg.values[r.intlvMatchValue()] = entry.second;
+            seg.valid[r.intlvMatchValue()] = true;
+        }
+    }
+
+    void
+    clear()
+    {
+        starts.clear();
+        segments.clear();
+        entries.clear();
+    }
+
+    bool empty() const { return entries.empty(); }
+
+    /**
+     * Find the value of the range that contains the given address
+     * range, i.e. the equivalent of AddrRangeMap::contains.
+     *
+     * @param r A non-interleaved address range
+     * @return The value, nullptr if no range contains r
+     */
+    const V *
+    find(const AddrRange &r) const
+    {
+        // empty or wrapping ranges are left to the generic checks
+        if (r.interleaved() || r.end() <= r.start())
+            return findSlow(r);
+
+        const Addr a = r.start();
+        const Addr b = r.end() - 1;
+
+        auto it = std::upper_bound(starts.begin(), starts.end(), a);
+        if (it == starts.begin())
+            return nullptr;
+
+        const Segment &seg = segments[it - starts.begin() - 1];
+        if (b > seg.last)
+            return nullptr;
+
+        if (!seg.interleaved())
+            return &seg.values[0];
+
+        // both ends must be in the same stripe and in a single chunk
+        // of it
+        const unsigned sel = seg.select(a);
+        if (!seg.valid[sel] || seg.select(b) != sel ||
+            b - a >= seg.granularity) {
+            return nullptr;
+        }
+
+        return &seg.values[sel];
+    }
+
+    /**
+     * Find the value of the range that contains the given address.
+     *
+     * @param a An address
+     * @return The value, nullptr if no range contains a
+     */
+    const V *find(Addr a) const { return find(RangeSize(a, 1)); }
+};
+
+} // namespace gem5
+
+#endif // __BASE_ADDR_RANGE_DECODER_HH__
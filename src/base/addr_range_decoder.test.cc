@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "base/addr_range_decoder.hh"
+#include "base/addr_range_map.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/**
+ * Check that the decoder gives the same answer as AddrRangeMap::contains
+ * for a set of address ranges.
+ */
+void
+checkSameAsMap(const AddrRangeMap<int> &map,
+               const std::vector<AddrRange> &queries)
+{
+    AddrRangeDecoder<int> decoder;
+    decoder.build(map);
+
+    for (const auto &r : queries) {
+        auto it = map.contains(r);
+        const int *v = decoder.find(r);
+        if (it == map.end()) {
+            EXPECT_EQ(v, nullptr) << r.to_string();
+        } else {
+            ASSERT_NE(v, nullptr) << r.to_string();
+            EXPECT_EQ(*v, it->second) << r.to_string();
+        }
+    }
+}
+
+/** Ranges of the given size covering [start, end) with a stride */
+std::vector<AddrRange>
+sweep(Addr start, Addr end, Addr stride, Addr size)
+{
+    std::vector<AddrRange> queries;
+    for (Addr a = start; a < end; a += stride)
+        queries.push_back(RangeSize(a, size));
+    return queries;
+}
+
+/**
+ * Build a map of 'channels' power-of-two interleaved stripes over
+ * [start, end), with the interleaving bits starting at intlv_low_bit,
+ * and optionally xor'ed with higher address bits.
+ */
+void
+addInterleaved(AddrRangeMap<int> &map, Addr start, Addr end,
+               unsigned channels, unsigned intlv_low_bit,
+               unsigned xor_low_bit, int first_value)
+{
+    std::vector<Addr> masks;
+    for (unsigned i = 0; (1u << i) < channels; i++) {
+        Addr mask = Addr(1) << (intlv_low_bit + i);
+        if (xor_low_bit)
+            mask |= Addr(1) << (xor_low_bit + i);
+        masks.push_back(mask);
+    }
+
+    for (unsigned c = 0; c < channels; c++) {
+        ASSERT_NE(map.insert(AddrRange(start, end, masks, c),
+                             first_value + c),
+                  map.end());
+    }
+}
+
+} // anonymous namespace
+
+TEST(AddrRangeDecoderTest, Empty)
+{
+    AddrRangeDecoder<int> decoder;
+    EXPECT_TRUE(decoder.empty());
+    EXPECT_EQ(decoder.find(0x1000), nullptr);
+}
+
+TEST(AddrRangeDecoderTest, Contiguous)
+{
+    AddrRangeMap<int> map;
+    map.insert(RangeIn(10, 40), 5);
+    map.insert(RangeIn(60, 90), 3);
+    map.insert(RangeEx(0x1000, 0x2000), 7);
+
+    checkSameAsMap(map, sweep(0, 0x2100, 1, 1));
+    checkSameAsMap(map, sweep(0, 0x2100, 3, 8));
+    checkSameAsMap(map, {RangeIn(10, 40), RangeIn(10, 41), RangeIn(9, 40),
+                         RangeEx(0x1000, 0x2000)});
+}
+
+TEST(AddrRangeDecoderTest, Interleaved)
+{
+    AddrRangeMap<int> map;
+    addInterleaved(map, 0x0, 0x10000, 4, 6, 0, 0);
+    addInterleaved(map, 0x80000, 0x100000, 8, 12, 0, 10);
+    map.insert(RangeEx(0x20000, 0x30000), 100);
+
+    checkSameAsMap(map, sweep(0, 0x110000, 16, 64));
+    // accesses crossing interleaving boundaries
+    checkSameAsMap(map, sweep(0, 0x20000, 48, 32));
+    checkSameAsMap(map, sweep(0x80000, 0x100000, 0x700, 0x200));
+}
+
+TEST(AddrRangeDecoderTest, Hashed)
+{
+    AddrRangeMap<int> map;
+    addInterleaved(map, 0x0, 0x100000, 4, 6, 16, 0);
+
+    checkSameAsMap(map, sweep(0, 0x100000, 64, 64));
+    checkSameAsMap(map, sweep(0, 0x100000, 40, 32));
+}
+
+TEST(AddrRangeDecoderTest, MissingStripe)
+{
+    std::vector<Addr> masks = {Addr(1) << 6, Addr(1) << 7};
+
+    AddrRangeMap<int> map;
+    map.insert(AddrRange(0, 0x10000, masks, 0), 0);
+    map.insert(AddrRange(0, 0x10000, masks, 1), 1);
+    map.insert(AddrRange(0, 0x10000, masks, 3), 3);
+
+    checkSameAsMap(map, sweep(0, 0x10000, 32, 32));
+}
+
+TEST(AddrRangeDecoderTest, TopOfAddressSpace)
+{
+    AddrRangeMap<int> map;
+    map.insert(RangeIn(0xffffffffffff0000, 0xffffffffffffffff), 1);
+    map.insert(RangeEx(0x0, 0x1000), 2);
+
+    checkSameAsMap(map, {RangeSize(0xffffffffffff0000, 64),
+                         RangeSize(0xfffffffffffffff0, 16),
+                         RangeSize(0xfffffffffffffff0, 8),
+                         RangeSize(0xffffffffffff0000 - 8, 16),
+                         RangeSize(0x0, 64)});
+}
+
+TEST(AddrRangeDecoderTest, Rebuild)
+{
+    AddrRangeMap<int> map;
+    map.insert(RangeEx(0x0, 0x1000), 1);
+
+    AddrRangeDecoder<int> decoder;
+    decoder.build(map);
+    ASSERT_NE(decoder.find(0x10), nullptr);
+
+    map.clear();
+    map.insert(RangeEx(0x1000, 0x2000), 2);
+    decoder.build(map);
+    EXPECT_EQ(decoder.find(0x10), nullptr);
+    ASSERT_NE(decoder.find(0x1010), nullptr);
+    EXPECT_EQ(*decoder.find(0x1010), 2);
+}
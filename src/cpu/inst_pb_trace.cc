@@ -155,7 +155,7 @@ InstPBTrace::traceInst(ThreadContext *tc, StaticInstPtr si,
         curMsg->set_inst(letoh(*reinterpret_cast<uint32_t *>(buf.get())));
     } else if (instSize) {
         curMsg->set_inst_bytes(
-            std::string(reinterpret_cast<const char *>(buf.get()), bufSize));
+            std::string(reinterpret_cast<const char *>(buf.get()), instSize));
     }
     curMsg->set_cpuid(tc->cpuId());
     curMsg->set_tick(curTick());
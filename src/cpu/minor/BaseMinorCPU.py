@@ -425,6 +425,13 @@ class BaseMinorCPU(BaseCPU):
         True, "Enable cycle skipping when the processor is idle\n"
     )
 
+    skipIdleStages = Param.Bool(
+        False,
+        "Only evaluate pipeline stages which have input or outstanding"
+        " work in a cycle. This changes the draws of the Random thread"
+        " policy, so it is off by default to keep existing results",
+    )
+
     branchPred = Param.BranchPredictor(
         TournamentBP(numThreads=Parent.numThreads), "Branch Predictor"
     )
@@ -156,6 +156,11 @@ class Decode : public Named
      *  into Decode and on to Execute which is responsible for
      *  actually killing instructions */
     bool isDrained();
+
+    /** Is there nothing for Decode to do this cycle?  True when no new
+     *  input has arrived and no buffered input can be passed on to
+     *  Execute.  Used by Pipeline to skip evaluating an idle stage */
+    bool isIdle();
 };
 
 } // namespace minor
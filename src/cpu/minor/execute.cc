@@ -1639,6 +1639,20 @@ Execute::checkInterrupts(BranchData& branch, bool& interrupted)
     return InvalidThreadID;
 }
 
+bool
+Execute::isIdle()
+{
+    if (!inp.outputWire->isBubble())
+        return false;
+
+    for (ThreadID tid = 0; tid < cpu.numThreads; tid++) {
+        if (hasInterrupt(tid))
+            return false;
+    }
+
+    return true;
+}
+
 bool
 Execute::hasInterrupt(ThreadID thread_id)
 {
@@ -353,6 +353,14 @@ class Execute : public Named
      *  instructions and memory accesses. */
     bool isDrained();
 
+    /** Is there nothing new for Execute to react to this cycle?  True when
+     *  no instructions have arrived from Decode and no interrupt is
+     *  pending.  Everything else Execute waits on (FU progress, issue,
+     *  commit, memory responses) wakes the stage through
+     *  MinorCPU::wakeupOnEvent.  Used by Pipeline to skip evaluating
+     *  Execute while, for example, it is blocked on a load */
+    bool isIdle();
+
     /** Like the drain interface on SimObject */
     unsigned int drain();
     void drainResume();
@@ -745,6 +745,37 @@ Fetch1::isDrained()
     return drained;
 }
 
+bool
+Fetch1::isIdle()
+{
+    if (!inp.outputWire->isBubble() || !prediction.outputWire->isBubble())
+        return false;
+
+    bool can_fetch = numInFlightFetches() < fetchLimit;
+
+    for (ThreadID tid = 0; tid < cpu.numThreads; tid++) {
+        const Fetch1ThreadInfo &thread = fetchInfo[tid];
+
+        /* wakeupGuard is cleared by evaluate */
+        if (thread.wakeupGuard)
+            return false;
+
+        if (can_fetch && thread.state == FetchRunning &&
+            cpu.getContext(tid)->status() == ThreadContext::Active &&
+            nextStageReserve[tid].canReserve()) {
+            return false;
+        }
+    }
+
+    /* A translated (or discardable) request can move on to transfers */
+    if (icacheState == IcacheRunning && !requests.empty() &&
+        requests.front()->state != FetchRequest::InTranslation) {
+        return false;
+    }
+
+    return transfers.empty() || !transfers.front()->isComplete();
+}
+
 void
 Fetch1::FetchRequest::reportData(std::ostream &os) const
 {
@@ -406,6 +406,13 @@ class Fetch1 : public Named
     /** Is this stage drained?  For Fetch1, draining is initiated by
      *  Execute signalling a branch with the reason HaltFetch */
     bool isDrained();
+
+    /** Is there nothing for Fetch1 to do this cycle?  True when there
+     *  are no incoming branches, no thread can start a new fetch and
+     *  neither fetch queue can be stepped.  Memory and ITLB responses
+     *  wake the stage through MinorCPU::wakeupOnEvent.  Used by Pipeline
+     *  to skip evaluating an idle stage */
+    bool isIdle();
 };
 
 } // namespace minor
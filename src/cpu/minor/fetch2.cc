@@ -598,6 +598,33 @@ Fetch2::isDrained()
            (*predictionOut.inputWire).isBubble();
 }
 
+bool
+Fetch2::isIdle()
+{
+    if (!inp.outputWire->isBubble() || !branchInp.outputWire->isBubble())
+        return false;
+
+    for (ThreadID tid = 0; tid < cpu.numThreads; tid++) {
+        const ForwardLineData *line_in = getInput(tid);
+
+        if (!line_in)
+            continue;
+
+        if (nextStageReserve[tid].canReserve())
+            return false;
+
+        /* Lines with the wrong prediction sequence number are discarded
+         *  even when blocked */
+        const Fetch2ThreadInfo &thread = fetchInfo[tid];
+        if (thread.expectedStreamSeqNum == line_in->id.streamSeqNum &&
+            thread.predictionSeqNum != line_in->id.predictionSeqNum) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 Fetch2::Fetch2Stats::Fetch2Stats(MinorCPU *cpu)
       : statistics::Group(cpu, "fetch2"),
       ADD_STAT(intInstructions, statistics::units::Count::get(),
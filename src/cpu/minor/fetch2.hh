@@ -218,6 +218,12 @@ class Fetch2 : public Named
      *  Execute halting Fetch1 causing Fetch2 to naturally drain.
      *  Branch predictions are ignored by Fetch1 during halt */
     bool isDrained();
+
+    /** Is there nothing for Fetch2 to do this cycle?  True when there is
+     *  no new line or branch input and no buffered line can either be
+     *  passed on to Decode or discarded.  Used by Pipeline to skip
+     *  evaluating an idle stage */
+    bool isIdle();
 };
 
 } // namespace minor
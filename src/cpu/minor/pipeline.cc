@@ -43,6 +43,7 @@
 #include "cpu/minor/execute.hh"
 #include "cpu/minor/fetch1.hh"
 #include "cpu/minor/fetch2.hh"
+#include "cpu/minor/stats.hh"
 #include "debug/Drain.hh"
 #include "debug/MinorCPU.hh"
 #include "debug/MinorTrace.hh"
@@ -58,6 +59,7 @@ Pipeline::Pipeline(MinorCPU &cpu_, const BaseMinorCPUParams &params) :
     Ticked(cpu_, &(cpu_.BaseCPU::baseStats.numCycles)),
     cpu(cpu_),
     allow_idling(params.enableIdling),
+    skip_idle_stages(params.skipIdleStages),
     f1ToF2(cpu.name() + ".f1ToF2", "lines",
         params.fetch1ToFetch2ForwardDelay),
     f2ToF1(cpu.name() + ".f2ToF1", "prediction",
@@ -85,6 +87,8 @@ Pipeline::Pipeline(MinorCPU &cpu_, const BaseMinorCPUParams &params) :
         params.executeBranchDelay)))),
     needToSignalDrained(false)
 {
+    stageWakeup.fill(false);
+
     if (params.fetch1ToFetch2ForwardDelay < 1) {
         fatal("%s: fetch1ToFetch2ForwardDelay must be >= 1 (%d)\n",
             cpu.name(), params.fetch1ToFetch2ForwardDelay);
@@ -127,13 +131,37 @@ Pipeline::evaluate()
     /** We tick the CPU to update the BaseCPU cycle counters */
     cpu.tick();
 
+    /* A wakeup of the whole processor or draining evaluates every
+     *  stage.  Otherwise, only stages which were activated or which have
+     *  work to do are evaluated.  Each stage's isIdle is checked after
+     *  the later stages have evaluated so that buffer space they free up
+     *  in this cycle is seen */
+    bool evaluate_all = !skip_idle_stages || needToSignalDrained ||
+        isStageActive(CPUStageId);
+    minor::MinorStats &stats = cpu.stats;
+
     /* Note that it's important to evaluate the stages in order to allow
      *  'immediate', 0-time-offset TimeBuffer activity to be visible from
      *  later stages to earlier ones in the same cycle */
-    execute.evaluate();
-    decode.evaluate();
-    fetch2.evaluate();
-    fetch1.evaluate();
+    if (evaluate_all || isStageActive(ExecuteStageId) || !execute.isIdle())
+        execute.evaluate();
+    else
+        stats.skippedStageEvaluations[ExecuteStageId]++;
+
+    if (evaluate_all || isStageActive(DecodeStageId) || !decode.isIdle())
+        decode.evaluate();
+    else
+        stats.skippedStageEvaluations[DecodeStageId]++;
+
+    if (evaluate_all || isStageActive(Fetch2StageId) || !fetch2.isIdle())
+        fetch2.evaluate();
+    else
+        stats.skippedStageEvaluations[Fetch2StageId]++;
+
+    if (evaluate_all || isStageActive(Fetch1StageId) || !fetch1.isIdle())
+        fetch1.evaluate();
+    else
+        stats.skippedStageEvaluations[Fetch1StageId]++;
 
     if (debug::MinorTrace)
         minorTrace();
@@ -155,16 +183,21 @@ Pipeline::evaluate()
             DPRINTF(Quiesce, "Suspending as the processor is idle\n");
             stop();
         }
+    }
 
+    if (allow_idling || skip_idle_stages) {
         /* Deactivate all stages.  Note that the stages *could*
          *  activate and deactivate themselves but that's fraught
          *  with additional difficulty.
-         *  As organised herre */
-        activityRecorder.deactivateStage(Pipeline::CPUStageId);
-        activityRecorder.deactivateStage(Pipeline::Fetch1StageId);
-        activityRecorder.deactivateStage(Pipeline::Fetch2StageId);
-        activityRecorder.deactivateStage(Pipeline::DecodeStageId);
-        activityRecorder.deactivateStage(Pipeline::ExecuteStageId);
+         *  As organised herre.  Remember which stages asked to be
+         *  evaluated next cycle */
+        for (int stage_id = CPUStageId; stage_id < Num_StageId;
+            stage_id++)
+        {
+            stageWakeup[stage_id] =
+                activityRecorder.getStageActive(stage_id);
+            activityRecorder.deactivateStage(stage_id);
+        }
     }
 
     if (needToSignalDrained) /* Must be draining */
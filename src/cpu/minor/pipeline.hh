@@ -45,6 +45,8 @@
 #ifndef __CPU_MINOR_PIPELINE_HH__
 #define __CPU_MINOR_PIPELINE_HH__
 
+#include <array>
+
 #include "cpu/minor/activity.hh"
 #include "cpu/minor/cpu.hh"
 #include "cpu/minor/decode.hh"
@@ -77,6 +79,10 @@ class Pipeline : public Ticked
     /** Allow cycles to be skipped when the pipeline is idle */
     bool allow_idling;
 
+    /** Only evaluate stages which have input or outstanding work in a
+     *  cycle */
+    bool skip_idle_stages;
+
     Latch<ForwardLineData> f1ToF2;
     Latch<BranchData> f2ToF1;
     Latch<ForwardInstData> f2ToD;
@@ -107,6 +113,22 @@ class Pipeline : public Ticked
     /** True after drain is called but draining isn't complete */
     bool needToSignalDrained;
 
+  protected:
+    /** Stage activations carried over from the last cycle.  The activity
+     *  recorder's stage flags are cleared at the end of each evaluate so
+     *  activations made by the stages as they evaluate are kept here to
+     *  decide which stages to evaluate next cycle */
+    std::array<bool, Num_StageId> stageWakeup;
+
+    /** Has the given stage been activated either by itself last cycle or
+     *  by an event since */
+    bool
+    isStageActive(StageId stage_id) const
+    {
+        return stageWakeup[stage_id] ||
+            activityRecorder.getStageActive(stage_id);
+    }
+
   public:
     Pipeline(MinorCPU &cpu_, const BaseMinorCPUParams &params);
 
@@ -47,9 +47,22 @@ MinorStats::MinorStats(BaseCPU *base_cpu)
     : statistics::Group(base_cpu),
     ADD_STAT(quiesceCycles, statistics::units::Cycle::get(),
              "Total number of cycles that CPU has spent quiesced or waiting "
-             "for an interrupt")
+             "for an interrupt"),
+    ADD_STAT(skippedStageEvaluations, statistics::units::Cycle::get(),
+             "Number of cycles in which a pipeline stage was idle and not "
+             "evaluated")
 {
     quiesceCycles.prereq(quiesceCycles);
+
+    /* Matches Pipeline::StageId */
+    skippedStageEvaluations
+        .init(5)
+        .subname(0, "cpu")
+        .subname(1, "fetch1")
+        .subname(2, "fetch2")
+        .subname(3, "decode")
+        .subname(4, "execute")
+        .flags(statistics::nozero);
 }
 
 } // namespace minor
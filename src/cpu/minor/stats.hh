@@ -62,6 +62,10 @@ struct MinorStats : public statistics::Group
     /** Number of cycles in quiescent state */
     statistics::Scalar quiesceCycles;
 
+    /** Number of cycles in which each pipeline stage was not evaluated
+     *  as it had nothing to do.  Indexed by Pipeline::StageId */
+    statistics::Vector skippedStageEvaluations;
+
 };
 
 } // namespace minor
@@ -42,6 +42,7 @@ from m5.objects.BaseCPU import BaseCPU
 # from m5.objects.O3Checker import O3Checker
 from m5.objects.BranchPredictor import *
 from m5.objects.FUPool import *
+from m5.objects.SMTPolicy import *
 from m5.params import *
 from m5.proxy import *
 
@@ -91,6 +92,14 @@ class BaseO3CPU(BaseCPU):
     fetchQueueSize = Param.Unsigned(
         32, "Fetch queue size in micro-ops per-thread"
     )
+    fetchTargetQueueSize = Param.Unsigned(
+        0,
+        "Fetch blocks per thread the decoupled front end may predict ahead "
+        "of fetch for fetch-directed instruction prefetching (0 disables it)",
+    )
+    fetchTargetsPerCycle = Param.Unsigned(
+        1, "Fetch blocks the decoupled front end predicts per cycle"
+    )
 
     renameToDecodeDelay = Param.Cycles(1, "Rename to decode delay")
     iewToDecodeDelay = Param.Cycles(
@@ -186,6 +195,11 @@ class BaseO3CPU(BaseCPU):
     )
     smtROBThreshold = Param.Int(100, "SMT ROB Threshold Sharing Parameter")
     smtCommitPolicy = Param.CommitPolicy("RoundRobin", "SMT Commit Policy")
+    smtPolicy = Param.BaseSMTPolicy(
+        NULL,
+        "SMT fetch and resource sharing policy. If set, it overrides "
+        "smtFetchPolicy and further limits the ROB, IQ and LSQ partitions",
+    )
 
     branchPred = Param.BranchPredictor(
         TournamentBP(numThreads=Parent.numThreads), "Branch Predictor"
@@ -0,0 +1,99 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.params import *
+from m5.proxy import *
+from m5.SimObject import SimObject
+
+
+class BaseSMTPolicy(SimObject):
+    type = "BaseSMTPolicy"
+    abstract = True
+    cxx_class = "gem5::o3::BaseSMTPolicy"
+    cxx_header = "cpu/o3/smt_policy.hh"
+
+    numThreads = Param.Unsigned(Parent.numThreads, "Number of threads")
+    numROBEntries = Param.Unsigned(
+        Parent.numROBEntries, "Number of reorder buffer entries"
+    )
+    numIQEntries = Param.Unsigned(
+        Parent.numIQEntries, "Number of instruction queue entries"
+    )
+    LQEntries = Param.Unsigned(Parent.LQEntries, "Number of load queue entries")
+    SQEntries = Param.Unsigned(
+        Parent.SQEntries, "Number of store queue entries"
+    )
+
+    missLatencyThreshold = Param.Cycles(
+        20,
+        "Number of cycles a load at the head of the ROB has to wait for "
+        "its data before the thread is considered to have a long-latency "
+        "(L2) miss",
+    )
+
+
+class ICountSMTPolicy(BaseSMTPolicy):
+    """ICOUNT (Tullsen et al., ISCA'96): fetch from the thread with the
+    fewest instructions in the front end and the instruction queue."""
+
+    type = "ICountSMTPolicy"
+    cxx_class = "gem5::o3::ICountSMTPolicy"
+    cxx_header = "cpu/o3/smt_policy.hh"
+
+
+class StallSMTPolicy(ICountSMTPolicy):
+    """STALL (Tullsen and Brown, MICRO'01): ICOUNT, but threads with an
+    outstanding long-latency load are not allowed to fetch."""
+
+    type = "StallSMTPolicy"
+    cxx_class = "gem5::o3::StallSMTPolicy"
+    cxx_header = "cpu/o3/smt_policy.hh"
+
+
+class FlushSMTPolicy(StallSMTPolicy):
+    """FLUSH (Tullsen and Brown, MICRO'01): STALL, and additionally squash
+    the instructions younger than the missing load so the thread releases
+    its shared resources."""
+
+    type = "FlushSMTPolicy"
+    cxx_class = "gem5::o3::FlushSMTPolicy"
+    cxx_header = "cpu/o3/smt_policy.hh"
+
+
+class DCRASMTPolicy(ICountSMTPolicy):
+    """DCRA (Cazorla et al., MICRO'04): dynamically partition the ROB, IQ
+    and LSQ. Threads with an outstanding long-latency load are limited to
+    E/T * (1 + C * F) entries of a resource with E entries, where T is the
+    number of active threads, F the number of threads without misses and
+    C the sharing factor."""
+
+    type = "DCRASMTPolicy"
+    cxx_class = "gem5::o3::DCRASMTPolicy"
+    cxx_header = "cpu/o3/smt_policy.hh"
+
+    sharingFactor = Param.Float(
+        0.0, "Sharing factor C, 0 selects the default of 1 / (numThreads + 4)"
+    )
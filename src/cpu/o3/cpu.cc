@@ -98,6 +98,8 @@ CPU::CPU(const BaseO3CPUParams &params)
 
       rob(this, params),
 
+      smtPolicy(params.smtPolicy),
+
       scoreboard(name() + ".scoreboard", regFile.totalNumPhysRegs()),
 
       isa(numThreads, NULL),
@@ -380,6 +382,9 @@ CPU::tick()
 
     iew.tick();
 
+    if (smtPolicy && numThreads > 1)
+        updateSMTPolicy();
+
     commit.tick();
 
     // Now advance the time buffers
@@ -417,6 +422,38 @@ CPU::tick()
     tryDrain();
 }
 
+void
+CPU::updateSMTPolicy()
+{
+    SMTThreadOccupancy occupancy[MaxThreads];
+
+    for (ThreadID tid : activeThreads) {
+        SMTThreadOccupancy &occ = occupancy[tid];
+
+        const unsigned iq_count = iew.instQueue.getCount(tid);
+        occ.preIssue = fetch.numQueuedInsts(tid) +
+            decode.numQueuedInsts(tid) + rename.numQueuedInsts(tid) +
+            iq_count;
+        occ.entries[(size_t)SMTResource::ROB] = rob.getThreadEntries(tid);
+        occ.entries[(size_t)SMTResource::IQ] = iq_count;
+        occ.entries[(size_t)SMTResource::LQ] = iew.ldstQueue.numLoads(tid);
+        occ.entries[(size_t)SMTResource::SQ] = iew.ldstQueue.numStores(tid);
+
+        const DynInstPtr &head = rob.readHeadInst(tid);
+        if (head && head->isLoad() && head->isIssued() &&
+            !head->isExecuted() && !head->isSquashed()) {
+            occ.pendingHeadLoad = head->seqNum;
+        }
+    }
+
+    smtPolicy->update(activeThreads, occupancy, curCycle());
+
+    for (ThreadID tid : activeThreads) {
+        if (smtPolicy->shouldFlush(tid))
+            iew.squashAfterLongLatencyLoad(rob.readHeadInst(tid), tid);
+    }
+}
+
 void
 CPU::init()
 {
@@ -485,6 +522,9 @@ CPU::deactivateThread(ThreadID tid)
 
     fetch.deactivateThread(tid);
     commit.deactivateThread(tid);
+
+    if (smtPolicy)
+        smtPolicy->deactivateThread(tid);
 }
 
 Counter
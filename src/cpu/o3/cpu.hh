@@ -62,6 +62,7 @@
 #include "cpu/o3/rename.hh"
 #include "cpu/o3/rob.hh"
 #include "cpu/o3/scoreboard.hh"
+#include "cpu/o3/smt_policy.hh"
 #include "cpu/o3/thread_state.hh"
 #include "cpu/activity.hh"
 #include "cpu/base.hh"
@@ -234,6 +235,10 @@ class CPU : public BaseCPU
     /** Update The Order In Which We Process Threads. */
     void updateThreadPriority();
 
+    /** Sample the per-thread occupancy into the SMT policy and carry out
+     * any flush it requests. */
+    void updateSMTPolicy();
+
     /** Is the CPU draining? */
     bool isDraining() const { return drainState() == DrainState::Draining; }
 
@@ -431,6 +436,9 @@ class CPU : public BaseCPU
     /** The re-order buffer. */
     ROB rob;
 
+    /** Pluggable SMT fetch and resource sharing policy, if any. */
+    BaseSMTPolicy *smtPolicy;
+
     /** Active Threads List */
     std::list<ThreadID> activeThreads;
 
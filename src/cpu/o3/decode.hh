@@ -128,6 +128,13 @@ class Decode
     /** Has the stage drained? */
     bool isDrained() const;
 
+    /** Returns the number of instructions buffered for a thread. */
+    unsigned
+    numQueuedInsts(ThreadID tid) const
+    {
+        return insts[tid].size() + skidBuffer[tid].size();
+    }
+
     /** Takes over from another CPU's thread. */
     void takeOverFrom() { resetStage(); }
 
@@ -46,6 +46,7 @@
 #include <list>
 #include <map>
 #include <queue>
+#include <vector>
 
 #include "arch/generic/tlb.hh"
 #include "base/types.hh"
@@ -55,6 +56,7 @@
 #include "cpu/o3/cpu.hh"
 #include "cpu/o3/dyn_inst.hh"
 #include "cpu/o3/limits.hh"
+#include "cpu/o3/smt_policy.hh"
 #include "debug/Activity.hh"
 #include "debug/Drain.hh"
 #include "debug/Fetch.hh"
@@ -81,6 +83,7 @@ Fetch::IcachePort::IcachePort(Fetch *_fetch, CPU *_cpu) :
 
 Fetch::Fetch(CPU *_cpu, const BaseO3CPUParams &params)
     : fetchPolicy(params.smtFetchPolicy),
+      smtPolicy(params.smtPolicy),
       cpu(_cpu),
       branchPred(nullptr),
       decodeToFetchDelay(params.decodeToFetchDelay),
@@ -98,7 +101,11 @@ Fetch::Fetch(CPU *_cpu, const BaseO3CPUParams &params)
       numThreads(params.numThreads),
       numFetchingThreads(params.smtNumFetchingThreads),
       icachePort(this, _cpu),
-      finishTranslationEvent(this), fetchStats(_cpu, this)
+      finishTranslationEvent(this),
+      fetchTargetQueueSize(params.fetchTargetQueueSize),
+      fetchTargetsPerCycle(params.fetchTargetsPerCycle),
+      prefetchesInFlight(0),
+      fetchStats(_cpu, this)
 {
     if (numThreads > MaxThreads)
         fatal("numThreads (%d) is larger than compiled limit (%d),\n"
@@ -129,6 +136,8 @@ Fetch::Fetch(CPU *_cpu, const BaseO3CPUParams &params)
         fetchBufferValid[i] = false;
         lastIcacheStall[i] = 0;
         issuePipelinedIfetch[i] = false;
+        prefetchEpoch[i] = 0;
+        lastPrefetchBlk[i] = MaxAddr;
     }
 
     branchPred = params.branchPred;
@@ -142,6 +151,18 @@ Fetch::Fetch(CPU *_cpu, const BaseO3CPUParams &params)
 
     // Get the size of an instruction.
     instSize = decoder[0]->moreBytesSize();
+
+    if (fetchTargetQueueSize) {
+        // the run-ahead probes the BTB at the alignment it is indexed
+        // at, rather than by instruction, which may be of any length
+        ftq.reset(new FetchTargetQueue(fetchTargetQueueSize,
+                    fetchBufferSize, branchPred->instAlignment(),
+                    [this](ThreadID tid, Addr pc) {
+                        const PCStateBase *target =
+                            branchPred->peekTakenTarget(tid, pc);
+                        return target ? target->instAddr() : MaxAddr;
+                    }));
+    }
 }
 
 std::string Fetch::name() const { return cpu->name() + ".fetch"; }
@@ -189,6 +210,20 @@ Fetch::FetchStatGroup::FetchStatGroup(CPU *cpu, Fetch *fetch)
              "Number of outstanding Icache misses that were squashed"),
     ADD_STAT(tlbSquashes, statistics::units::Count::get(),
              "Number of outstanding ITLB misses that were squashed"),
+    ADD_STAT(ftqTargets, statistics::units::Count::get(),
+             "Number of fetch blocks predicted by the fetch-target queue"),
+    ADD_STAT(ftqHits, statistics::units::Count::get(),
+             "Number of fetch block requests found at the head of the "
+             "fetch-target queue"),
+    ADD_STAT(ftqResteers, statistics::units::Count::get(),
+             "Number of fetch block requests that resteered the "
+             "fetch-target queue"),
+    ADD_STAT(ftqOccupancy, statistics::units::Count::get(),
+             "Number of fetch targets queued each cycle"),
+    ADD_STAT(instPrefetches, statistics::units::Count::get(),
+             "Number of fetch-directed I-cache prefetches sent"),
+    ADD_STAT(instPrefetchesDropped, statistics::units::Count::get(),
+             "Number of fetch-directed I-cache prefetches dropped"),
     ADD_STAT(nisnDist, statistics::units::Count::get(),
              "Number of instructions fetched each cycle (Total)"),
     ADD_STAT(idleRate, statistics::units::Ratio::get(),
@@ -225,6 +260,22 @@ Fetch::FetchStatGroup::FetchStatGroup(CPU *cpu, Fetch *fetch)
             .prereq(icacheSquashes);
         tlbSquashes
             .prereq(tlbSquashes);
+        ftqTargets
+            .prereq(ftqTargets);
+        ftqHits
+            .prereq(ftqHits);
+        ftqResteers
+            .prereq(ftqResteers);
+        ftqOccupancy
+            .init(/* base value */ 0,
+              /* last value */ fetch->fetchTargetQueueSize,
+              /* bucket size */ 1)
+            .flags(statistics::pdf)
+            .prereq(ftqTargets);
+        instPrefetches
+            .prereq(instPrefetches);
+        instPrefetchesDropped
+            .prereq(instPrefetchesDropped);
         nisnDist
             .init(/* base value */ 0,
               /* last value */ fetch->fetchWidth,
@@ -283,6 +334,9 @@ Fetch::clearStates(ThreadID tid)
     fetchBufferPC[tid] = 0;
     fetchBufferValid[tid] = false;
     fetchQueue[tid].clear();
+    lastPrefetchBlk[tid] = MaxAddr;
+    if (ftq)
+        ftq->resteer(tid, pc[tid]->instAddr());
 
     // TODO not sure what to do with priorityList for now
     // priorityList.push_back(tid);
@@ -315,6 +369,10 @@ Fetch::resetStage()
 
         fetchQueue[tid].clear();
 
+        lastPrefetchBlk[tid] = MaxAddr;
+        if (ftq)
+            ftq->resteer(tid, pc[tid]->instAddr());
+
         priorityList.push_back(tid);
     }
 
@@ -414,6 +472,12 @@ Fetch::isDrained() const
         }
     }
 
+    /* Outstanding instruction prefetches would otherwise complete
+     * after the drain.
+     */
+    if (prefetchesInFlight)
+        return false;
+
     /* The pipeline might start up again in the middle of the drain
      * cycle if the finish translation event is scheduled, so make
      * sure that's not the case.
@@ -681,6 +745,108 @@ Fetch::finishTranslation(const Fault &fault, const RequestPtr &mem_req)
     _status = updateFetchStatus();
 }
 
+void
+Fetch::runAhead(ThreadID tid)
+{
+    if (fetchStatus[tid] == Idle || fetchStatus[tid] == TrapPending ||
+        fetchStatus[tid] == QuiescePending ||
+        fetchStatus[tid] == NoGoodAddr || stalls[tid].drain) {
+        return;
+    }
+
+    for (unsigned i = 0; i < fetchTargetsPerCycle && !ftq->full(tid); ++i) {
+        const auto &target = ftq->produce(tid);
+        ++fetchStats.ftqTargets;
+
+        DPRINTF(Fetch, "[tid:%i] FTQ predicted fetch block %#x-%#x, "
+                "next %#x%s.\n", tid, target.start, target.end, target.next,
+                target.taken ? " (taken)" : "");
+
+        // A fetch block never spans cache blocks, as the fetch buffer
+        // is at most a cache block in size.
+        const Addr blk_addr = target.start & ~(cacheBlkSize - 1);
+        const Addr held_blk = fetchBufferPC[tid] & ~(cacheBlkSize - 1);
+        if (blk_addr != lastPrefetchBlk[tid] &&
+            !(fetchBufferValid[tid] && blk_addr == held_blk)) {
+            issueInstPrefetch(tid, blk_addr);
+            lastPrefetchBlk[tid] = blk_addr;
+        }
+    }
+
+    fetchStats.ftqOccupancy.sample(ftq->occupancy(tid));
+}
+
+void
+Fetch::consumeFetchTarget(ThreadID tid, Addr fetch_addr)
+{
+    const Addr held_block = fetchBufferValid[tid] ?
+        fetchBufferPC[tid] : MaxAddr;
+
+    if (ftq->consume(tid, fetch_addr, held_block)) {
+        ++fetchStats.ftqHits;
+    } else {
+        DPRINTF(Fetch, "[tid:%i] Fetch block %#x not at the FTQ head, "
+                "resteering.\n", tid, fetchBufferAlignPC(fetch_addr));
+        ++fetchStats.ftqResteers;
+        lastPrefetchBlk[tid] = MaxAddr;
+    }
+}
+
+void
+Fetch::issueInstPrefetch(ThreadID tid, Addr blk_addr)
+{
+    if (cacheBlocked) {
+        ++fetchStats.instPrefetchesDropped;
+        return;
+    }
+
+    RequestPtr req = std::make_shared<Request>(
+        blk_addr, cacheBlkSize,
+        Request::INST_FETCH | Request::PREFETCH, cpu->instRequestorId(),
+        blk_addr, cpu->thread[tid]->contextId());
+    req->taskId(cpu->taskId());
+
+    ++prefetchesInFlight;
+    PrefetchTranslation *trans =
+        new PrefetchTranslation(this, tid, prefetchEpoch[tid]);
+    cpu->mmu->translateTiming(req, cpu->thread[tid]->getTC(),
+                              trans, BaseMMU::Execute);
+}
+
+void
+Fetch::finishPrefetchTranslation(const Fault &fault, const RequestPtr &req,
+                                 ThreadID tid, uint64_t epoch)
+{
+    assert(prefetchesInFlight);
+
+    // Drop prefetches that were squashed while translating, that fault,
+    // target non-memory or uncacheable addresses, or find the cache busy.
+    // Prefetches are never retried.
+    if (epoch != prefetchEpoch[tid] || fault != NoFault ||
+        cpu->switchedOut() || req->isUncacheable() ||
+        !cpu->system->isMemAddr(req->getPaddr()) || cacheBlocked) {
+        --prefetchesInFlight;
+        ++fetchStats.instPrefetchesDropped;
+        return;
+    }
+
+    PacketPtr pkt = new Packet(req, MemCmd::SoftPFReq);
+    pkt->allocate();
+
+    if (!icachePort.sendTimingReq(pkt)) {
+        DPRINTF(Fetch, "[tid:%i] I-cache busy, dropping prefetch of %#x.\n",
+                tid, req->getVaddr());
+        --prefetchesInFlight;
+        ++fetchStats.instPrefetchesDropped;
+        delete pkt;
+        return;
+    }
+
+    DPRINTF(Fetch, "[tid:%i] Prefetching instruction block %#x.\n",
+            tid, req->getVaddr());
+    ++fetchStats.instPrefetches;
+}
+
 void
 Fetch::doSquash(const PCStateBase &new_pc, const DynInstPtr squashInst,
         ThreadID tid)
@@ -723,6 +889,14 @@ Fetch::doSquash(const PCStateBase &new_pc, const DynInstPtr squashInst,
     // Empty fetch queue
     fetchQueue[tid].clear();
 
+    // Restart the decoupled front end on the correct path and drop any
+    // prefetch that is still being translated for the wrong one.
+    if (ftq) {
+        ftq->resteer(tid, new_pc.instAddr());
+        ++prefetchEpoch[tid];
+        lastPrefetchBlk[tid] = MaxAddr;
+    }
+
     // microops are being squashed, it is not known wheather the
     // youngest non-squashed microop was  marked delayed commit
     // or not. Setting the flag to true ensures that the
@@ -866,6 +1040,12 @@ Fetch::tick()
         }
     }
 
+    // Let the decoupled front end run ahead of fetch and prefetch.
+    if (ftq) {
+        for (auto tid : *activeThreads)
+            runAhead(tid);
+    }
+
     // Send instructions enqueued into the fetch queue to decode.
     // Limit rate by fetchWidth.  Stall if decode is stalled.
     unsigned insts_to_decode = 0;
@@ -1120,7 +1300,8 @@ Fetch::fetch(bool &status_change)
             DPRINTF(Fetch, "[tid:%i] Attempting to translate and read "
                     "instruction, starting at PC %s.\n", tid, this_pc);
 
-            fetchCacheLine(fetchAddr, tid, this_pc.instAddr());
+            if (fetchCacheLine(fetchAddr, tid, this_pc.instAddr()) && ftq)
+                consumeFetchTarget(tid, fetchAddr);
 
             if (fetchStatus[tid] == IcacheWaitResponse) {
                 cpu->fetchStats[tid]->icacheStallCycles++;
@@ -1363,6 +1544,9 @@ ThreadID
 Fetch::getFetchingThread()
 {
     if (numThreads > 1) {
+        if (smtPolicy)
+            return smtPolicyThread();
+
         switch (fetchPolicy) {
           case SMTFetchPolicy::RoundRobin:
             return roundRobin();
@@ -1501,6 +1685,26 @@ Fetch::branchCount()
     return InvalidThreadID;
 }
 
+ThreadID
+Fetch::smtPolicyThread()
+{
+    std::vector<ThreadID> candidates;
+
+    for (ThreadID tid : *activeThreads) {
+        if ((fetchStatus[tid] == Running ||
+             fetchStatus[tid] == IcacheAccessComplete ||
+             fetchStatus[tid] == Idle) &&
+            smtPolicy->canFetch(tid)) {
+            candidates.push_back(tid);
+        }
+    }
+
+    if (candidates.empty())
+        return InvalidThreadID;
+
+    return smtPolicy->selectFetchThread(candidates);
+}
+
 void
 Fetch::pipelineIcacheAccesses(ThreadID tid)
 {
@@ -1526,7 +1730,8 @@ Fetch::pipelineIcacheAccesses(ThreadID tid)
         DPRINTF(Fetch, "[tid:%i] Issuing a pipelined I-cache access, "
                 "starting at PC %s.\n", tid, this_pc);
 
-        fetchCacheLine(fetchAddr, tid, this_pc.instAddr());
+        if (fetchCacheLine(fetchAddr, tid, this_pc.instAddr()) && ftq)
+            consumeFetchTarget(tid, fetchAddr);
     }
 }
 
@@ -1586,6 +1791,15 @@ Fetch::IcachePort::recvTimingResp(PacketPtr pkt)
     // We shouldn't ever get a cacheable block in Modified state
     assert(pkt->req->isUncacheable() ||
            !(pkt->cacheResponding() && !pkt->hasSharers()));
+
+    // Fetch-directed prefetches only warm the I-cache.
+    if (pkt->req->isPrefetch()) {
+        assert(fetch->prefetchesInFlight);
+        --fetch->prefetchesInFlight;
+        delete pkt;
+        return true;
+    }
+
     fetch->processCacheCompletion(pkt);
 
     return true;
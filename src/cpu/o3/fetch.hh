@@ -47,6 +47,7 @@
 #include "base/statistics.hh"
 #include "cpu/o3/comm.hh"
 #include "cpu/o3/dyn_inst_ptr.hh"
+#include "cpu/o3/fetch_target_queue.hh"
 #include "cpu/o3/limits.hh"
 #include "cpu/pc_event.hh"
 #include "cpu/pred/bpred_unit.hh"
@@ -66,6 +67,7 @@ struct BaseO3CPUParams;
 namespace o3
 {
 
+class BaseSMTPolicy;
 class CPU;
 
 /**
@@ -122,6 +124,32 @@ class Fetch
         }
     };
 
+    /** Translation of a fetch-directed instruction prefetch. */
+    class PrefetchTranslation : public BaseMMU::Translation
+    {
+      protected:
+        Fetch *fetch;
+        ThreadID tid;
+        /** Squash epoch of the thread when the prefetch was issued. */
+        uint64_t epoch;
+
+      public:
+        PrefetchTranslation(Fetch *_fetch, ThreadID _tid, uint64_t _epoch)
+            : fetch(_fetch), tid(_tid), epoch(_epoch)
+        {}
+
+        void markDelayed() {}
+
+        void
+        finish(const Fault &fault, const RequestPtr &req,
+            gem5::ThreadContext *tc, BaseMMU::Mode mode)
+        {
+            assert(mode == BaseMMU::Execute);
+            fetch->finishPrefetchTranslation(fault, req, tid, epoch);
+            delete this;
+        }
+    };
+
   private:
     /* Event to delay delivery of a fetch translation result in case of
      * a fault and the nop to carry the fault cannot be generated
@@ -193,6 +221,9 @@ class Fetch
     /** Fetch policy. */
     SMTFetchPolicy fetchPolicy;
 
+    /** Pluggable SMT policy, overrides fetchPolicy if set. */
+    BaseSMTPolicy *smtPolicy;
+
     /** List that has the threads organized by priority. */
     std::list<ThreadID> priorityList;
 
@@ -302,6 +333,26 @@ class Fetch
     bool fetchCacheLine(Addr vaddr, ThreadID tid, Addr pc);
     void finishTranslation(const Fault &fault, const RequestPtr &mem_req);
 
+    /**
+     * Run the fetch-target queue ahead of fetch for up to
+     * fetchTargetsPerCycle fetch blocks and prefetch the blocks it
+     * predicts into the I-cache.
+     */
+    void runAhead(ThreadID tid);
+
+    /**
+     * Check a fetch block request against the fetch-target queue.
+     * @param fetch_addr The address of the block fetch is requesting.
+     */
+    void consumeFetchTarget(ThreadID tid, Addr fetch_addr);
+
+    /** Start the translation of an I-cache prefetch for a cache block. */
+    void issueInstPrefetch(ThreadID tid, Addr blk_addr);
+
+    /** Send a translated I-cache prefetch, unless it was squashed. */
+    void finishPrefetchTranslation(const Fault &fault, const RequestPtr &req,
+                                   ThreadID tid, uint64_t epoch);
+
 
     /** Check if an interrupt is pending and that we need to handle
      */
@@ -362,6 +413,13 @@ class Fetch
 
     RequestPort &getInstPort() { return icachePort; }
 
+    /** Returns the number of instructions waiting in the fetch queue. */
+    unsigned
+    numQueuedInsts(ThreadID tid) const
+    {
+        return fetchQueue[tid].size();
+    }
+
   private:
     DynInstPtr buildInst(ThreadID tid, StaticInstPtr staticInst,
             StaticInstPtr curMacroop, const PCStateBase &this_pc,
@@ -383,6 +441,10 @@ class Fetch
      * policy. */
     ThreadID branchCount();
 
+    /** Returns the appropriate thread to fetch as selected by the
+     * pluggable SMT policy. */
+    ThreadID smtPolicyThread();
+
     /** Pipeline the next I-cache access to the current one. */
     void pipelineIcacheAccesses(ThreadID tid);
 
@@ -530,6 +592,24 @@ class Fetch
     /** Event used to delay fault generation of translation faults */
     FinishTranslationEvent finishTranslationEvent;
 
+    /** Fetch-target queue of the decoupled front end, null if disabled. */
+    std::unique_ptr<FetchTargetQueue> ftq;
+
+    /** Fetch targets per thread the FTQ can hold (0 disables it). */
+    unsigned fetchTargetQueueSize;
+
+    /** Fetch blocks the fetch-target queue may predict per cycle. */
+    unsigned fetchTargetsPerCycle;
+
+    /** Incremented on every squash to drop stale prefetches. */
+    uint64_t prefetchEpoch[MaxThreads];
+
+    /** Last cache block prefetched per thread, to avoid duplicates. */
+    Addr lastPrefetchBlk[MaxThreads];
+
+    /** Prefetch translations and I-cache accesses still in flight. */
+    unsigned prefetchesInFlight;
+
   protected:
     struct FetchStatGroup : public statistics::Group
     {
@@ -574,6 +654,18 @@ class Fetch
          * due to a squash.
          */
         statistics::Scalar tlbSquashes;
+        /** Fetch blocks predicted by the fetch-target queue. */
+        statistics::Scalar ftqTargets;
+        /** Fetch block requests that matched the head of the FTQ. */
+        statistics::Scalar ftqHits;
+        /** Fetch block requests that missed the FTQ and resteered it. */
+        statistics::Scalar ftqResteers;
+        /** Distribution of the FTQ occupancy each cycle. */
+        statistics::Distribution ftqOccupancy;
+        /** I-cache prefetches sent by fetch-directed prefetching. */
+        statistics::Scalar instPrefetches;
+        /** Prefetches dropped due to squashes, faults or a busy cache. */
+        statistics::Scalar instPrefetchesDropped;
         /** Distribution of number of instructions fetched each cycle. */
         statistics::Distribution nisnDist;
         /** Rate of how often fetch was idle. */
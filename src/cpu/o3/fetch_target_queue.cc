@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/o3/fetch_target_queue.hh"
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+FetchTargetQueue::FetchTargetQueue(unsigned _size, unsigned block_size,
+                                   unsigned scan_step,
+                                   TakenTargetLookup _lookup)
+    : size(_size), blockSize(block_size), blockMask(block_size - 1),
+      scanStep(scan_step), lookup(_lookup)
+{
+    fatal_if(!lookup, "The fetch-target queue requires a branch predictor\n");
+    fatal_if(!isPowerOf2(scanStep) || blockSize % scanStep,
+             "Fetch block size (%u) must be a multiple of the BTB "
+             "alignment (%u)\n", blockSize, scanStep);
+
+    for (ThreadID tid = 0; tid < MaxThreads; ++tid)
+        runAheadPC[tid] = 0;
+}
+
+void
+FetchTargetQueue::resteer(ThreadID tid, Addr pc)
+{
+    queue[tid].clear();
+    runAheadPC[tid] = pc;
+}
+
+FetchTargetQueue::FetchTarget
+FetchTargetQueue::predict(ThreadID tid, Addr pc) const
+{
+    const Addr block_end = blockAlign(pc) + blockSize;
+
+    // Probe once per BTB slot, a branch anywhere in a slot is found
+    // through it, and the block ends with the slot
+    for (Addr inst_pc = pc; inst_pc < block_end; inst_pc += scanStep) {
+        const Addr target = lookup(tid, inst_pc);
+        if (target != MaxAddr) {
+            return {pc, roundDown(inst_pc, scanStep) + scanStep, target,
+                    true};
+        }
+    }
+
+    return {pc, block_end, block_end, false};
+}
+
+const FetchTargetQueue::FetchTarget &
+FetchTargetQueue::produce(ThreadID tid)
+{
+    assert(!full(tid));
+
+    queue[tid].push_back(predict(tid, runAheadPC[tid]));
+    runAheadPC[tid] = queue[tid].back().next;
+
+    return queue[tid].back();
+}
+
+bool
+FetchTargetQueue::consume(ThreadID tid, Addr fetch_addr, Addr held_block)
+{
+    auto &q = queue[tid];
+    const Addr block = blockAlign(fetch_addr);
+
+    while (!q.empty() && blockAlign(q.front().start) == held_block)
+        q.pop_front();
+
+    if (!q.empty() && blockAlign(q.front().start) == block) {
+        q.pop_front();
+        return true;
+    }
+
+    // The run-ahead went down a different path than fetch (or has not
+    // caught up yet). Restart it behind the block fetch is requesting.
+    resteer(tid, predict(tid, fetch_addr).next);
+    return false;
+}
+
+} // namespace o3
+} // namespace gem5
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_O3_FETCH_TARGET_QUEUE_HH__
+#define __CPU_O3_FETCH_TARGET_QUEUE_HH__
+
+#include <deque>
+#include <functional>
+
+#include "base/types.hh"
+#include "cpu/o3/limits.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+/**
+ * Fetch-target queue (FTQ) of a decoupled front end. A run-ahead walks
+ * the predicted instruction stream one fetch block at a time, ahead of
+ * the fetch stage, and queues the predicted blocks so that they can be
+ * prefetched into the I-cache (fetch-directed instruction prefetching).
+ *
+ * A fetch block starts at a fetch target and ends either at the first
+ * predicted-taken branch or at the end of the aligned fetch buffer
+ * block. Branches are discovered through the BTB, so the run-ahead only
+ * sees branches that hit there. Fetch still predicts every branch it
+ * fetches through BPredUnit::predict(); the FTQ is checked against the
+ * blocks fetch actually requests and is resteered on a mismatch.
+ */
+class FetchTargetQueue
+{
+  public:
+    /** A predicted fetch block. */
+    struct FetchTarget
+    {
+        /** First byte of the block. */
+        Addr start;
+        /** One past the last byte of the block. */
+        Addr end;
+        /** Start of the next predicted block. */
+        Addr next;
+        /** Whether the block ends in a predicted-taken branch. */
+        bool taken;
+    };
+
+    /**
+     * Looks up a predicted-taken branch at a PC, as
+     * BPredUnit::peekTakenTarget does, and returns its target, or
+     * MaxAddr if no taken branch is predicted there.
+     */
+    typedef std::function<Addr(ThreadID tid, Addr pc)> TakenTargetLookup;
+
+    /**
+     * @param size Maximum number of queued fetch targets per thread.
+     * @param block_size Size of the aligned fetch block in bytes.
+     * @param scan_step Granularity at which the BTB is searched for
+     * branches within a fetch block. This is the alignment the BTB is
+     * indexed at, so that every branch it holds is seen, whatever the
+     * length of the instructions.
+     * @param lookup The lookup of the predicted-taken branches.
+     */
+    FetchTargetQueue(unsigned size, unsigned block_size, unsigned scan_step,
+                     TakenTargetLookup lookup);
+
+    /** Drop all queued targets and restart the run-ahead at pc. */
+    void resteer(ThreadID tid, Addr pc);
+
+    /** Whether another target can be queued for this thread. */
+    bool full(ThreadID tid) const { return queue[tid].size() >= size; }
+
+    /** Number of targets queued for this thread. */
+    size_t occupancy(ThreadID tid) const { return queue[tid].size(); }
+
+    /**
+     * Predict the block at the run-ahead PC, queue it and advance the
+     * run-ahead to the block's successor.
+     * @return The queued target.
+     */
+    const FetchTarget &produce(ThreadID tid);
+
+    /**
+     * Match the fetch block fetch is about to request against the head
+     * of the queue. Queued targets for the block fetch already holds are
+     * skipped, since fetch does not re-request a buffered block. On a
+     * mismatch the queue is resteered past the requested block.
+     * @param tid The thread id.
+     * @param fetch_addr The address fetch requests.
+     * @param held_block The fetch block currently buffered by fetch, or
+     * MaxAddr if none.
+     * @return Whether the requested block was the head of the queue.
+     */
+    bool consume(ThreadID tid, Addr fetch_addr, Addr held_block);
+
+    /** Align an address to the start of its fetch block. */
+    Addr blockAlign(Addr addr) const { return addr & ~blockMask; }
+
+  private:
+    /** Predict the fetch block that starts at pc. */
+    FetchTarget predict(ThreadID tid, Addr pc) const;
+
+    const unsigned size;
+    const unsigned blockSize;
+    const Addr blockMask;
+    const Addr scanStep;
+
+    const TakenTargetLookup lookup;
+
+    /** Next PC to predict from, per thread. */
+    Addr runAheadPC[MaxThreads];
+
+    /** Queued fetch targets, per thread. */
+    std::deque<FetchTarget> queue[MaxThreads];
+};
+
+} // namespace o3
+} // namespace gem5
+
+#endif // __CPU_O3_FETCH_TARGET_QUEUE_HH__
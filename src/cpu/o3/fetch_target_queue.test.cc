@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <map>
+
+#include "cpu/o3/fetch_target_queue.hh"
+
+using namespace gem5;
+using namespace gem5::o3;
+
+namespace
+{
+
+const unsigned blockSize = 64;
+
+/**
+ * Stands in for the BTB and direction predictor: the predicted-taken
+ * branches, found by any PC in the same aligned slot of the BTB, as a
+ * BTB indexed and tagged at a 4-byte alignment finds them.
+ */
+class FetchTargetQueueTest : public testing::Test
+{
+  protected:
+    static constexpr unsigned btbAlignment = 4;
+
+    std::map<Addr, Addr> takenBranches;
+    unsigned lookups = 0;
+
+    FetchTargetQueue ftq{4, blockSize, btbAlignment,
+        [this](ThreadID tid, Addr pc) {
+            ++lookups;
+            for (const auto &[branch_pc, target] : takenBranches) {
+                if (branch_pc / btbAlignment == pc / btbAlignment)
+                    return target;
+            }
+            return MaxAddr;
+        }};
+
+    void
+    expectTarget(const FetchTargetQueue::FetchTarget &target, Addr start,
+                 Addr end, Addr next, bool taken)
+    {
+        EXPECT_EQ(target.start, start);
+        EXPECT_EQ(target.end, end);
+        EXPECT_EQ(target.next, next);
+        EXPECT_EQ(target.taken, taken);
+    }
+};
+
+TEST_F(FetchTargetQueueTest, FollowsThePredictedPath)
+{
+    takenBranches[0x1010] = 0x2008;
+
+    ftq.resteer(0, 0x1000);
+    expectTarget(ftq.produce(0), 0x1000, 0x1014, 0x2008, true);
+    // a taken branch starts the next block part way into a fetch block
+    expectTarget(ftq.produce(0), 0x2008, 0x2040, 0x2040, false);
+    expectTarget(ftq.produce(0), 0x2040, 0x2080, 0x2080, false);
+    EXPECT_EQ(ftq.occupancy(0), 3);
+    EXPECT_FALSE(ftq.full(0));
+    ftq.produce(0);
+    EXPECT_TRUE(ftq.full(0));
+
+    // the threads run ahead on their own
+    EXPECT_EQ(ftq.occupancy(1), 0);
+    ftq.resteer(1, 0x1014);
+    expectTarget(ftq.produce(1), 0x1014, 0x1040, 0x1040, false);
+}
+
+TEST_F(FetchTargetQueueTest, ProbesEveryBTBSlot)
+{
+    // branches of variable-length instructions, at any byte offset, are
+    // found wherever they are in their slot of the BTB
+    takenBranches[0x100e] = 0x3000;
+    takenBranches[0x3021] = 0x4000;
+
+    ftq.resteer(0, 0x1000);
+    expectTarget(ftq.produce(0), 0x1000, 0x1010, 0x3000, true);
+    EXPECT_EQ(lookups, 4);
+    expectTarget(ftq.produce(0), 0x3000, 0x3024, 0x4000, true);
+
+    // a run-ahead starting part way into a slot probes each slot once
+    lookups = 0;
+    ftq.resteer(0, 0x4002);
+    expectTarget(ftq.produce(0), 0x4002, 0x4040, 0x4040, false);
+    EXPECT_EQ(lookups, 16);
+
+    takenBranches[0x5013] = 0x6000;
+    ftq.resteer(0, 0x5002);
+    expectTarget(ftq.produce(0), 0x5002, 0x5014, 0x6000, true);
+}
+
+TEST_F(FetchTargetQueueTest, ConsumeMatchesTheHead)
+{
+    takenBranches[0x1010] = 0x2000;
+
+    ftq.resteer(0, 0x1000);
+    ftq.produce(0);
+    ftq.produce(0);
+    ftq.produce(0);
+
+    EXPECT_TRUE(ftq.consume(0, 0x1004, MaxAddr));
+    EXPECT_EQ(ftq.occupancy(0), 2);
+    EXPECT_TRUE(ftq.consume(0, 0x2000, 0x1000));
+    EXPECT_EQ(ftq.occupancy(0), 1);
+
+    // a block fetch already holds is skipped rather than matched
+    ftq.resteer(0, 0x1000);
+    ftq.produce(0);
+    ftq.produce(0);
+    EXPECT_TRUE(ftq.consume(0, 0x2000, 0x1000));
+    EXPECT_EQ(ftq.occupancy(0), 0);
+}
+
+TEST_F(FetchTargetQueueTest, MismatchResteersPastTheRequest)
+{
+    takenBranches[0x1010] = 0x2000;
+    takenBranches[0x5030] = 0x6000;
+
+    ftq.resteer(0, 0x1000);
+    ftq.produce(0);
+    ftq.produce(0);
+
+    // fetch went elsewhere, the queue restarts behind its block
+    EXPECT_FALSE(ftq.consume(0, 0x5000, MaxAddr));
+    EXPECT_EQ(ftq.occupancy(0), 0);
+    expectTarget(ftq.produce(0), 0x6000, 0x6040, 0x6040, false);
+
+    // and so it does when it has not caught up yet
+    EXPECT_FALSE(ftq.consume(0, 0x7000, MaxAddr));
+    expectTarget(ftq.produce(0), 0x7040, 0x7080, 0x7080, false);
+}
+
+} // anonymous namespace
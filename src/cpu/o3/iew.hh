@@ -236,6 +236,12 @@ class IEW
         ldstQueue.setLastRetiredHtmUid(tid, htmUid);
     }
 
+    /** Sends commit proper information to squash all instructions younger
+     * than a load waiting for a long-latency miss, as requested by the
+     * SMT policy.
+     */
+    void squashAfterLongLatencyLoad(const DynInstPtr &inst, ThreadID tid);
+
   private:
     /** Sends commit proper information for a squash due to a branch
      * mispredict.
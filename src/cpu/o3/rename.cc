@@ -41,11 +41,13 @@
 
 #include "cpu/o3/rename.hh"
 
+#include <algorithm>
 #include <list>
 
 #include "cpu/o3/cpu.hh"
 #include "cpu/o3/dyn_inst.hh"
 #include "cpu/o3/limits.hh"
+#include "cpu/o3/smt_policy.hh"
 #include "cpu/reg_class.hh"
 #include "debug/Activity.hh"
 #include "debug/O3PipeView.hh"
@@ -60,6 +62,7 @@ namespace o3
 
 Rename::Rename(CPU *_cpu, const BaseO3CPUParams &params)
     : cpu(_cpu),
+      smtPolicy(params.smtPolicy),
       iewToRenameDelay(params.iewToRenameDelay),
       decodeToRenameDelay(params.decodeToRenameDelay),
       commitToRenameDelay(params.commitToRenameDelay),
@@ -1138,8 +1141,13 @@ Rename::renameDestRegs(const DynInstPtr &inst, ThreadID tid)
 int
 Rename::calcFreeROBEntries(ThreadID tid)
 {
-    int num_free = freeEntries[tid].robEntries -
-                  (instsInProgress[tid] - fromIEW->iewInfo[tid].dispatched);
+    int in_flight = instsInProgress[tid] - fromIEW->iewInfo[tid].dispatched;
+    int num_free = freeEntries[tid].robEntries - in_flight;
+
+    if (smtPolicy) {
+        num_free = std::min(num_free,
+            smtPolicy->headroom(SMTResource::ROB, tid) - in_flight);
+    }
 
     //DPRINTF(Rename,"[tid:%i] %i rob free\n",tid,num_free);
 
@@ -1149,8 +1157,13 @@ Rename::calcFreeROBEntries(ThreadID tid)
 int
 Rename::calcFreeIQEntries(ThreadID tid)
 {
-    int num_free = freeEntries[tid].iqEntries -
-                  (instsInProgress[tid] - fromIEW->iewInfo[tid].dispatched);
+    int in_flight = instsInProgress[tid] - fromIEW->iewInfo[tid].dispatched;
+    int num_free = freeEntries[tid].iqEntries - in_flight;
+
+    if (smtPolicy) {
+        num_free = std::min(num_free,
+            smtPolicy->headroom(SMTResource::IQ, tid) - in_flight);
+    }
 
     //DPRINTF(Rename,"[tid:%i] %i iq free\n",tid,num_free);
 
@@ -1160,8 +1173,13 @@ Rename::calcFreeIQEntries(ThreadID tid)
 int
 Rename::calcFreeLQEntries(ThreadID tid)
 {
-        int num_free = freeEntries[tid].lqEntries -
-            (loadsInProgress[tid] - fromIEW->iewInfo[tid].dispatchedToLQ);
+        int in_flight =
+            loadsInProgress[tid] - fromIEW->iewInfo[tid].dispatchedToLQ;
+        int num_free = freeEntries[tid].lqEntries - in_flight;
+        if (smtPolicy) {
+            num_free = std::min(num_free,
+                smtPolicy->headroom(SMTResource::LQ, tid) - in_flight);
+        }
         DPRINTF(Rename,
                 "calcFreeLQEntries: free lqEntries: %d, loadsInProgress: %d, "
                 "loads dispatchedToLQ: %d\n",
@@ -1173,8 +1191,13 @@ Rename::calcFreeLQEntries(ThreadID tid)
 int
 Rename::calcFreeSQEntries(ThreadID tid)
 {
-        int num_free = freeEntries[tid].sqEntries -
-            (storesInProgress[tid] - fromIEW->iewInfo[tid].dispatchedToSQ);
+        int in_flight =
+            storesInProgress[tid] - fromIEW->iewInfo[tid].dispatchedToSQ;
+        int num_free = freeEntries[tid].sqEntries - in_flight;
+        if (smtPolicy) {
+            num_free = std::min(num_free,
+                smtPolicy->headroom(SMTResource::SQ, tid) - in_flight);
+        }
         DPRINTF(Rename, "calcFreeSQEntries: free sqEntries: %d, "
                 "storesInProgress: %d, stores dispatchedToSQ: %d\n",
                 freeEntries[tid].sqEntries, storesInProgress[tid],
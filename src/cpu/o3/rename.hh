@@ -63,6 +63,8 @@ struct BaseO3CPUParams;
 namespace o3
 {
 
+class BaseSMTPolicy;
+
 /**
  * Rename handles both single threaded and SMT rename. Its
  * width is specified by the parameters; each cycle it tries to rename
@@ -184,6 +186,13 @@ class Rename
     /** Has the stage drained? */
     bool isDrained() const;
 
+    /** Returns the number of instructions buffered for a thread. */
+    unsigned
+    numQueuedInsts(ThreadID tid) const
+    {
+        return insts[tid].size() + skidBuffer[tid].size();
+    }
+
     /** Takes over from another CPU's thread. */
     void takeOverFrom();
 
@@ -323,6 +332,9 @@ class Rename
     /** Pointer to CPU. */
     CPU *cpu;
 
+    /** Pluggable SMT policy limiting per-thread allocation, if any. */
+    BaseSMTPolicy *smtPolicy;
+
     /** Pointer to main time buffer used for backwards communication. */
     TimeBuffer<TimeStruct> *timeBuffer;
 
@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/o3/smt_policy.hh"
+
+#include <algorithm>
+
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/SMTPolicy.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+BaseSMTPolicy::BaseSMTPolicy(const Params &p)
+    : SimObject(p),
+      numThreads(p.numThreads),
+      capacity{p.numROBEntries, p.numIQEntries, p.LQEntries, p.SQEntries},
+      missLatencyThreshold(p.missLatencyThreshold),
+      stats(this)
+{
+    fatal_if(numThreads > MaxThreads,
+             "%s: %d threads requested, at most %d are supported.\n",
+             name(), numThreads, MaxThreads);
+
+    headLoad.fill(0);
+    headLoadSince.fill(Cycles(0));
+    longLatency.fill(false);
+}
+
+void
+BaseSMTPolicy::update(const std::list<ThreadID> &active_threads,
+                      const SMTThreadOccupancy *new_occupancy, Cycles now)
+{
+    for (ThreadID tid : active_threads) {
+        const SMTThreadOccupancy &occ = new_occupancy[tid];
+        occupancy[tid] = occ;
+
+        // A load is considered to have missed in the L2 once it has been
+        // blocking the ROB head for longer than the threshold.
+        if (occ.pendingHeadLoad != headLoad[tid]) {
+            headLoad[tid] = occ.pendingHeadLoad;
+            headLoadSince[tid] = now;
+        }
+
+        const bool miss = headLoad[tid] != 0 &&
+            now - headLoadSince[tid] >= missLatencyThreshold;
+        if (miss && !longLatency[tid]) {
+            DPRINTF(SMTPolicy, "[tid:%i] [sn:%llu] Long-latency load "
+                    "detected.\n", tid, headLoad[tid]);
+            ++stats.longLatencyLoads[tid];
+        }
+        longLatency[tid] = miss;
+
+        ++stats.cycles[tid];
+        stats.preIssueOccupancy[tid] += occ.preIssue;
+        stats.robOccupancy[tid] += occ.entries[(size_t)SMTResource::ROB];
+        stats.iqOccupancy[tid] += occ.entries[(size_t)SMTResource::IQ];
+        stats.lqOccupancy[tid] += occ.entries[(size_t)SMTResource::LQ];
+        stats.sqOccupancy[tid] += occ.entries[(size_t)SMTResource::SQ];
+        if (miss)
+            ++stats.longLatencyCycles[tid];
+    }
+
+    updatePolicy(active_threads);
+
+    for (ThreadID tid : active_threads) {
+        if (!canFetch(tid))
+            ++stats.fetchGatedCycles[tid];
+    }
+}
+
+void
+BaseSMTPolicy::deactivateThread(ThreadID tid)
+{
+    DPRINTF(SMTPolicy, "[tid:%i] Clearing the occupancy of the "
+            "deactivated thread.\n", tid);
+
+    occupancy[tid] = SMTThreadOccupancy();
+    headLoad[tid] = 0;
+    headLoadSince[tid] = Cycles(0);
+    longLatency[tid] = false;
+}
+
+BaseSMTPolicy::SMTPolicyStats::SMTPolicyStats(BaseSMTPolicy *policy)
+    : statistics::Group(policy),
+      ADD_STAT(cycles, statistics::units::Cycle::get(),
+               "Number of cycles each thread was active"),
+      ADD_STAT(preIssueOccupancy, statistics::units::Count::get(),
+               "Accumulated number of fetched but not issued instructions"),
+      ADD_STAT(robOccupancy, statistics::units::Count::get(),
+               "Accumulated number of ROB entries used"),
+      ADD_STAT(iqOccupancy, statistics::units::Count::get(),
+               "Accumulated number of IQ entries used"),
+      ADD_STAT(lqOccupancy, statistics::units::Count::get(),
+               "Accumulated number of LQ entries used"),
+      ADD_STAT(sqOccupancy, statistics::units::Count::get(),
+               "Accumulated number of SQ entries used"),
+      ADD_STAT(avgPreIssueOccupancy, statistics::units::Rate<
+                    statistics::units::Count, statistics::units::Cycle>::get(),
+               "Average number of fetched but not issued instructions"),
+      ADD_STAT(avgROBOccupancy, statistics::units::Rate<
+                    statistics::units::Count, statistics::units::Cycle>::get(),
+               "Average number of ROB entries used"),
+      ADD_STAT(avgIQOccupancy, statistics::units::Rate<
+                    statistics::units::Count, statistics::units::Cycle>::get(),
+               "Average number of IQ entries used"),
+      ADD_STAT(avgLQOccupancy, statistics::units::Rate<
+                    statistics::units::Count, statistics::units::Cycle>::get(),
+               "Average number of LQ entries used"),
+      ADD_STAT(avgSQOccupancy, statistics::units::Rate<
+                    statistics::units::Count, statistics::units::Cycle>::get(),
+               "Average number of SQ entries used"),
+      ADD_STAT(fetchSelected, statistics::units::Count::get(),
+               "Number of times each thread was selected to fetch"),
+      ADD_STAT(longLatencyLoads, statistics::units::Count::get(),
+               "Number of long-latency loads detected"),
+      ADD_STAT(longLatencyCycles, statistics::units::Cycle::get(),
+               "Number of cycles spent waiting for a long-latency load"),
+      ADD_STAT(fetchGatedCycles, statistics::units::Cycle::get(),
+               "Number of cycles a thread was not allowed to fetch"),
+      ADD_STAT(flushes, statistics::units::Count::get(),
+               "Number of flushes triggered by the policy"),
+      ADD_STAT(limitedCycles, statistics::units::Cycle::get(),
+               "Number of cycles a thread ran with a reduced allocation "
+               "limit")
+{
+    using namespace statistics;
+
+    const ThreadID num_threads = policy->numThreads;
+
+    for (auto *stat : {&cycles, &preIssueOccupancy, &robOccupancy,
+                       &iqOccupancy, &lqOccupancy, &sqOccupancy,
+                       &fetchSelected, &longLatencyLoads, &longLatencyCycles,
+                       &fetchGatedCycles, &flushes, &limitedCycles}) {
+        stat->init(num_threads).flags(total);
+    }
+
+    // the formulas can only be set once the vectors are sized
+    avgPreIssueOccupancy = preIssueOccupancy / cycles;
+    avgROBOccupancy = robOccupancy / cycles;
+    avgIQOccupancy = iqOccupancy / cycles;
+    avgLQOccupancy = lqOccupancy / cycles;
+    avgSQOccupancy = sqOccupancy / cycles;
+
+    for (auto *stat : {&avgPreIssueOccupancy, &avgROBOccupancy,
+                       &avgIQOccupancy, &avgLQOccupancy, &avgSQOccupancy}) {
+        stat->precision(2);
+    }
+}
+
+ICountSMTPolicy::ICountSMTPolicy(const Params &p)
+    : BaseSMTPolicy(p), lastSelected(0)
+{
+}
+
+ThreadID
+ICountSMTPolicy::selectFetchThread(const std::vector<ThreadID> &candidates)
+{
+    assert(!candidates.empty());
+
+    // Visit the threads starting after the last selected one so that
+    // threads with the same count take turns.
+    ThreadID selected = InvalidThreadID;
+    unsigned min_count = 0;
+    for (ThreadID i = 1; i <= numThreads; i++) {
+        const ThreadID tid = (lastSelected + i) % numThreads;
+        if (std::find(candidates.begin(), candidates.end(), tid) ==
+                candidates.end()) {
+            continue;
+        }
+
+        const unsigned count = occupancy[tid].preIssue;
+        if (selected == InvalidThreadID || count < min_count) {
+            selected = tid;
+            min_count = count;
+        }
+    }
+
+    assert(selected != InvalidThreadID);
+    lastSelected = selected;
+    ++stats.fetchSelected[selected];
+
+    return selected;
+}
+
+StallSMTPolicy::StallSMTPolicy(const Params &p)
+    : ICountSMTPolicy(p)
+{
+}
+
+bool
+StallSMTPolicy::canFetch(ThreadID tid)
+{
+    return !isLongLatency(tid);
+}
+
+FlushSMTPolicy::FlushSMTPolicy(const Params &p)
+    : StallSMTPolicy(p)
+{
+    flushedLoad.fill(0);
+}
+
+bool
+FlushSMTPolicy::shouldFlush(ThreadID tid)
+{
+    // Flush once per miss, and only if there is something younger than
+    // the load to give back.
+    if (!isLongLatency(tid) || flushedLoad[tid] == headLoad[tid] ||
+        occupancy[tid].entries[(size_t)SMTResource::ROB] <= 1) {
+        return false;
+    }
+
+    DPRINTF(SMTPolicy, "[tid:%i] [sn:%llu] Flushing younger instructions.\n",
+            tid, headLoad[tid]);
+
+    flushedLoad[tid] = headLoad[tid];
+    ++stats.flushes[tid];
+    return true;
+}
+
+void
+FlushSMTPolicy::deactivateThread(ThreadID tid)
+{
+    StallSMTPolicy::deactivateThread(tid);
+    flushedLoad[tid] = 0;
+}
+
+DCRASMTPolicy::DCRASMTPolicy(const Params &p)
+    : ICountSMTPolicy(p),
+      sharingFactor(p.sharingFactor > 0 ? p.sharingFactor :
+                    1.0 / (numThreads + 4))
+{
+    fatal_if(p.sharingFactor < 0, "%s: sharingFactor must not be "
+             "negative.\n", name());
+
+    for (size_t res = 0; res < limits.size(); res++)
+        limits[res].fill(capacity[res]);
+}
+
+unsigned
+DCRASMTPolicy::allocationLimit(SMTResource res, ThreadID tid) const
+{
+    return limits[(size_t)res][tid];
+}
+
+void
+DCRASMTPolicy::deactivateThread(ThreadID tid)
+{
+    ICountSMTPolicy::deactivateThread(tid);
+    for (size_t res = 0; res < limits.size(); res++)
+        limits[res][tid] = capacity[res];
+}
+
+void
+DCRASMTPolicy::updatePolicy(const std::list<ThreadID> &active_threads)
+{
+    if (active_threads.empty())
+        return;
+
+    const unsigned num_active = active_threads.size();
+    const unsigned num_fast = std::count_if(
+        active_threads.begin(), active_threads.end(),
+        [this](ThreadID tid) { return !isLongLatency(tid); });
+
+    for (size_t res = 0; res < limits.size(); res++) {
+        const unsigned slow_limit = std::min<unsigned>(capacity[res],
+            (double)capacity[res] / num_active *
+            (1.0 + sharingFactor * num_fast));
+
+        for (ThreadID tid : active_threads) {
+            limits[res][tid] =
+                isLongLatency(tid) ? slow_limit : capacity[res];
+        }
+    }
+
+    for (ThreadID tid : active_threads) {
+        if (isLongLatency(tid) && num_active > 1)
+            ++stats.limitedCycles[tid];
+    }
+}
+
+} // namespace o3
+} // namespace gem5
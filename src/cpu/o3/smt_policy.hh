@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_O3_SMT_POLICY_HH__
+#define __CPU_O3_SMT_POLICY_HH__
+
+#include <array>
+#include <list>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "cpu/inst_seq.hh"
+#include "cpu/o3/limits.hh"
+#include "params/BaseSMTPolicy.hh"
+#include "params/DCRASMTPolicy.hh"
+#include "params/FlushSMTPolicy.hh"
+#include "params/ICountSMTPolicy.hh"
+#include "params/StallSMTPolicy.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+/** Shared back-end resources an SMT policy may partition. */
+enum class SMTResource
+{
+    ROB,
+    IQ,
+    LQ,
+    SQ,
+    Num
+};
+
+/**
+ * Per-thread pipeline occupancy, sampled by the CPU once per cycle and
+ * handed to the SMT policy.
+ */
+struct SMTThreadOccupancy
+{
+    /** Instructions fetched but not yet issued (the ICOUNT metric). */
+    unsigned preIssue = 0;
+    /** Entries used in each of the shared resources. */
+    std::array<unsigned, (size_t)SMTResource::Num> entries{};
+    /**
+     * Sequence number of the ROB head if it is a load that has been
+     * issued and is still waiting for its data, 0 otherwise.
+     */
+    InstSeqNum pendingHeadLoad = 0;
+};
+
+/**
+ * Base class of the pluggable SMT fetch and resource sharing policies.
+ * The policy decides which thread fetches every cycle, whether a thread
+ * is allowed to fetch at all, whether a thread should be flushed, and
+ * how many entries of the shared resources each thread may allocate.
+ * When a policy is attached to the CPU it overrides smtFetchPolicy and
+ * further restricts the static smtROBPolicy, smtIQPolicy and
+ * smtLSQPolicy partitions.
+ */
+class BaseSMTPolicy : public SimObject
+{
+  public:
+    PARAMS(BaseSMTPolicy);
+    BaseSMTPolicy(const Params &p);
+
+    /**
+     * Update the policy with this cycle's occupancy of every active
+     * thread.
+     *
+     * @param active_threads The threads currently active in the CPU.
+     * @param occupancy Occupancy of every thread, indexed by thread ID.
+     * @param now The current CPU cycle.
+     */
+    void update(const std::list<ThreadID> &active_threads,
+                const SMTThreadOccupancy *occupancy, Cycles now);
+
+    /**
+     * Pick the thread to fetch from.
+     *
+     * @param candidates Threads that are able to fetch this cycle and
+     *        that are not gated by canFetch(); never empty.
+     * @return The selected thread.
+     */
+    virtual ThreadID selectFetchThread(
+        const std::vector<ThreadID> &candidates) = 0;
+
+    /**
+     * Forget the occupancy and the pending load of a thread that is
+     * deactivated, so that the policy does not act on them until the
+     * thread is sampled again.
+     */
+    virtual void deactivateThread(ThreadID tid);
+
+    /** Whether a thread is allowed to fetch this cycle. */
+    virtual bool canFetch(ThreadID tid) { return true; }
+
+    /**
+     * Whether the instructions younger than the ROB head of a thread
+     * should be squashed. Asked once per cycle after update().
+     */
+    virtual bool shouldFlush(ThreadID tid) { return false; }
+
+    /** Maximum number of entries of a resource a thread may allocate. */
+    virtual unsigned
+    allocationLimit(SMTResource res, ThreadID tid) const
+    {
+        return capacity[(size_t)res];
+    }
+
+    /**
+     * Number of entries a thread may still allocate in a resource, as
+     * seen at the last update. Can be negative if the limit shrunk
+     * below the current occupancy.
+     */
+    int
+    headroom(SMTResource res, ThreadID tid) const
+    {
+        return (int)allocationLimit(res, tid) -
+            (int)occupancy[tid].entries[(size_t)res];
+    }
+
+    /** Whether a thread is waiting for a long-latency load. */
+    bool
+    isLongLatency(ThreadID tid) const
+    {
+        return longLatency[tid];
+    }
+
+  protected:
+    /**
+     * Hook called at the end of update() once the occupancy and the
+     * long-latency state of all threads is known.
+     */
+    virtual void updatePolicy(const std::list<ThreadID> &active_threads) {}
+
+    /** Number of hardware threads. */
+    const ThreadID numThreads;
+
+    /** Total number of entries in each shared resource. */
+    std::array<unsigned, (size_t)SMTResource::Num> capacity;
+
+    /** Load latency above which a thread is considered to have missed. */
+    const Cycles missLatencyThreshold;
+
+    /** Occupancy of each thread at the last update. */
+    std::array<SMTThreadOccupancy, MaxThreads> occupancy;
+
+    /** Pending load at the ROB head and when it was first seen. */
+    std::array<InstSeqNum, MaxThreads> headLoad;
+    std::array<Cycles, MaxThreads> headLoadSince;
+
+    /** Whether each thread is waiting for a long-latency load. */
+    std::array<bool, MaxThreads> longLatency;
+
+  public:
+    struct SMTPolicyStats : public statistics::Group
+    {
+        SMTPolicyStats(BaseSMTPolicy *policy);
+
+        /** Number of cycles each thread was sampled. */
+        statistics::Vector cycles;
+        /** Accumulated per-thread occupancies. */
+        statistics::Vector preIssueOccupancy;
+        statistics::Vector robOccupancy;
+        statistics::Vector iqOccupancy;
+        statistics::Vector lqOccupancy;
+        statistics::Vector sqOccupancy;
+        /** Average per-thread occupancies. */
+        statistics::Formula avgPreIssueOccupancy;
+        statistics::Formula avgROBOccupancy;
+        statistics::Formula avgIQOccupancy;
+        statistics::Formula avgLQOccupancy;
+        statistics::Formula avgSQOccupancy;
+        /** Number of times each thread was selected to fetch. */
+        statistics::Vector fetchSelected;
+        /** Number of long-latency loads detected per thread. */
+        statistics::Vector longLatencyLoads;
+        /** Cycles each thread spent waiting for a long-latency load. */
+        statistics::Vector longLatencyCycles;
+        /** Cycles each thread was not allowed to fetch. */
+        statistics::Vector fetchGatedCycles;
+        /** Number of flushes triggered per thread. */
+        statistics::Vector flushes;
+        /** Cycles each thread ran with a reduced allocation limit. */
+        statistics::Vector limitedCycles;
+    } stats;
+};
+
+/**
+ * ICOUNT: give fetch priority to the thread with the fewest instructions
+ * in the decode, rename and issue stages. Ties are broken round-robin.
+ */
+class ICountSMTPolicy : public BaseSMTPolicy
+{
+  public:
+    PARAMS(ICountSMTPolicy);
+    ICountSMTPolicy(const Params &p);
+
+    ThreadID selectFetchThread(
+        const std::vector<ThreadID> &candidates) override;
+
+  protected:
+    /** Thread selected last, used to break ties. */
+    ThreadID lastSelected;
+};
+
+/** STALL: ICOUNT, but stop fetching for threads with a long miss. */
+class StallSMTPolicy : public ICountSMTPolicy
+{
+  public:
+    PARAMS(StallSMTPolicy);
+    StallSMTPolicy(const Params &p);
+
+    bool canFetch(ThreadID tid) override;
+};
+
+/**
+ * FLUSH: STALL, and also squash everything younger than the missing load
+ * once per miss so its ROB, IQ and LSQ entries return to the other
+ * threads.
+ */
+class FlushSMTPolicy : public StallSMTPolicy
+{
+  public:
+    PARAMS(FlushSMTPolicy);
+    FlushSMTPolicy(const Params &p);
+
+    bool shouldFlush(ThreadID tid) override;
+
+    void deactivateThread(ThreadID tid) override;
+
+  protected:
+    /** Last load each thread was flushed for. */
+    std::array<InstSeqNum, MaxThreads> flushedLoad;
+};
+
+/**
+ * DCRA: ICOUNT fetch with dynamic partitioning of the shared resources.
+ * Threads without a pending long-latency load may use every entry, slow
+ * threads are limited to E/T * (1 + C * F) entries.
+ */
+class DCRASMTPolicy : public ICountSMTPolicy
+{
+  public:
+    PARAMS(DCRASMTPolicy);
+    DCRASMTPolicy(const Params &p);
+
+    unsigned allocationLimit(SMTResource res, ThreadID tid) const override;
+
+    void deactivateThread(ThreadID tid) override;
+
+  protected:
+    void updatePolicy(const std::list<ThreadID> &active_threads) override;
+
+    /** Sharing factor C. */
+    const double sharingFactor;
+
+    /** Current limit of each resource for each thread. */
+    std::array<std::array<unsigned, MaxThreads>,
+               (size_t)SMTResource::Num> limits;
+};
+
+} // namespace o3
+} // namespace gem5
+
+#endif // __CPU_O3_SMT_POLICY_HH__
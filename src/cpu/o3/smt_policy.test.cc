@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <list>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "cpu/o3/smt_policy.hh"
+#include "params/DCRASMTPolicy.hh"
+#include "params/FlushSMTPolicy.hh"
+#include "params/ICountSMTPolicy.hh"
+#include "params/StallSMTPolicy.hh"
+
+using namespace gem5;
+using namespace gem5::o3;
+
+// The version tags are declared as extern
+namespace gem5
+{
+std::set<std::string> version_tags;
+} // namespace gem5
+
+namespace
+{
+
+const unsigned numThreads = 3;
+const unsigned numROBEntries = 96;
+const Cycles missLatency(10);
+
+/** Parameters of a policy for three threads */
+template <class Params>
+Params
+policyParams()
+{
+    Params p;
+    p.name = "smt_policy";
+    p.eventq_index = 0;
+    p.numThreads = numThreads;
+    p.numROBEntries = numROBEntries;
+    p.numIQEntries = 64;
+    p.LQEntries = 32;
+    p.SQEntries = 32;
+    p.missLatencyThreshold = missLatency;
+    return p;
+}
+
+/** Occupancy of a thread with a pre-issue count and a head load */
+SMTThreadOccupancy
+threadOccupancy(unsigned pre_issue, InstSeqNum head_load = 0)
+{
+    SMTThreadOccupancy occ;
+    occ.preIssue = pre_issue;
+    occ.entries[(size_t)SMTResource::ROB] = 2 * pre_issue + 2;
+    occ.entries[(size_t)SMTResource::IQ] = pre_issue;
+    occ.pendingHeadLoad = head_load;
+    return occ;
+}
+
+/** Sample the occupancy of the active threads at a cycle */
+void
+sample(BaseSMTPolicy &policy, const std::list<ThreadID> &active,
+       const std::vector<SMTThreadOccupancy> &occupancy, Cycles now)
+{
+    SMTThreadOccupancy occ[MaxThreads];
+    for (ThreadID tid = 0; tid < occupancy.size(); tid++)
+        occ[tid] = occupancy[tid];
+    policy.update(active, occ, now);
+}
+
+const std::list<ThreadID> allThreads = {0, 1, 2};
+const std::vector<ThreadID> allCandidates = {0, 1, 2};
+
+} // anonymous namespace
+
+TEST(SMTPolicyTest, ICountPicksTheFewestPreIssueInsts)
+{
+    ICountSMTPolicy policy(policyParams<ICountSMTPolicyParams>());
+    sample(policy, allThreads, {threadOccupancy(5), threadOccupancy(2),
+                                threadOccupancy(7)}, Cycles(0));
+
+    EXPECT_EQ(policy.selectFetchThread(allCandidates), 1);
+    EXPECT_EQ(policy.selectFetchThread({0, 2}), 0);
+    EXPECT_EQ(policy.selectFetchThread({2}), 2);
+}
+
+TEST(SMTPolicyTest, ICountTiesTakeTurns)
+{
+    ICountSMTPolicy policy(policyParams<ICountSMTPolicyParams>());
+    sample(policy, allThreads, {threadOccupancy(4), threadOccupancy(4),
+                                threadOccupancy(4)}, Cycles(0));
+
+    EXPECT_EQ(policy.selectFetchThread(allCandidates), 1);
+    EXPECT_EQ(policy.selectFetchThread(allCandidates), 2);
+    EXPECT_EQ(policy.selectFetchThread(allCandidates), 0);
+    EXPECT_EQ(policy.selectFetchThread(allCandidates), 1);
+}
+
+TEST(SMTPolicyTest, StallGatesLongLatencyThreads)
+{
+    StallSMTPolicy policy(policyParams<StallSMTPolicyParams>());
+
+    // the load of thread 0 blocks the ROB head until it misses
+    for (Cycles now(0); now < missLatency; ++now) {
+        sample(policy, allThreads, {threadOccupancy(1, 100),
+                                    threadOccupancy(3),
+                                    threadOccupancy(3)}, now);
+        EXPECT_TRUE(policy.canFetch(0));
+    }
+    sample(policy, allThreads, {threadOccupancy(1, 100),
+                                threadOccupancy(3), threadOccupancy(3)},
+           missLatency);
+    EXPECT_FALSE(policy.canFetch(0));
+    EXPECT_TRUE(policy.canFetch(1));
+    EXPECT_TRUE(policy.isLongLatency(0));
+
+    // a new load at the head starts over
+    sample(policy, allThreads, {threadOccupancy(1, 101),
+                                threadOccupancy(3), threadOccupancy(3)},
+           Cycles(missLatency + 1));
+    EXPECT_TRUE(policy.canFetch(0));
+}
+
+TEST(SMTPolicyTest, FlushOncePerMiss)
+{
+    FlushSMTPolicy policy(policyParams<FlushSMTPolicyParams>());
+    sample(policy, allThreads, {threadOccupancy(4, 100), threadOccupancy(3),
+                                threadOccupancy(3)}, Cycles(0));
+    EXPECT_FALSE(policy.shouldFlush(0));
+
+    sample(policy, allThreads, {threadOccupancy(4, 100), threadOccupancy(3),
+                                threadOccupancy(3)}, missLatency);
+    EXPECT_FALSE(policy.canFetch(0));
+    EXPECT_TRUE(policy.shouldFlush(0));
+    EXPECT_FALSE(policy.shouldFlush(0));
+    EXPECT_FALSE(policy.shouldFlush(1));
+
+    // nothing is younger than a load alone in the ROB
+    SMTThreadOccupancy alone = threadOccupancy(0, 200);
+    alone.entries[(size_t)SMTResource::ROB] = 1;
+    sample(policy, allThreads, {alone, threadOccupancy(3),
+                                threadOccupancy(3)}, Cycles(20));
+    sample(policy, allThreads, {alone, threadOccupancy(3),
+                                threadOccupancy(3)}, Cycles(30));
+    EXPECT_TRUE(policy.isLongLatency(0));
+    EXPECT_FALSE(policy.shouldFlush(0));
+}
+
+TEST(SMTPolicyTest, DCRALimitsSlowThreads)
+{
+    DCRASMTPolicyParams p = policyParams<DCRASMTPolicyParams>();
+    p.sharingFactor = 0.5;
+    DCRASMTPolicy policy(p);
+
+    sample(policy, allThreads, {threadOccupancy(4, 100), threadOccupancy(3),
+                                threadOccupancy(3)}, Cycles(0));
+    EXPECT_EQ(policy.allocationLimit(SMTResource::ROB, 0), numROBEntries);
+
+    // a slow thread gets E / T * (1 + C * F) entries, with two fast
+    // threads
+    sample(policy, allThreads, {threadOccupancy(4, 100), threadOccupancy(3),
+                                threadOccupancy(3)}, missLatency);
+    EXPECT_EQ(policy.allocationLimit(SMTResource::ROB, 0), 64);
+    EXPECT_EQ(policy.allocationLimit(SMTResource::IQ, 0), 42);
+    EXPECT_EQ(policy.allocationLimit(SMTResource::ROB, 1), numROBEntries);
+    EXPECT_EQ(policy.headroom(SMTResource::ROB, 0), 64 - 10);
+    EXPECT_EQ(policy.headroom(SMTResource::ROB, 1), numROBEntries - 8);
+
+    // ICOUNT still picks the thread to fetch
+    EXPECT_EQ(policy.selectFetchThread(allCandidates), 1);
+}
+
+TEST(SMTPolicyTest, DeactivatedThreadsAreCleared)
+{
+    const std::vector<SMTThreadOccupancy> busy = {
+        threadOccupancy(6), threadOccupancy(40, 100), threadOccupancy(8)};
+
+    ICountSMTPolicy icount(policyParams<ICountSMTPolicyParams>());
+    FlushSMTPolicy flush(policyParams<FlushSMTPolicyParams>());
+    DCRASMTPolicyParams p = policyParams<DCRASMTPolicyParams>();
+    p.sharingFactor = 0.5;
+    DCRASMTPolicy dcra(p);
+
+    for (BaseSMTPolicy *policy : {(BaseSMTPolicy *)&icount,
+                                  (BaseSMTPolicy *)&flush,
+                                  (BaseSMTPolicy *)&dcra}) {
+        sample(*policy, allThreads, busy, Cycles(0));
+        sample(*policy, allThreads, busy, missLatency);
+        EXPECT_TRUE(policy->isLongLatency(1));
+
+        // thread 1 halts, and the others keep running
+        policy->deactivateThread(1);
+        sample(*policy, {0, 2}, busy, Cycles(missLatency + 1));
+
+        EXPECT_FALSE(policy->isLongLatency(1));
+        EXPECT_TRUE(policy->canFetch(1));
+        EXPECT_FALSE(policy->shouldFlush(1));
+        EXPECT_EQ(policy->headroom(SMTResource::ROB, 1), numROBEntries);
+
+        // once woken up, it is not held back by the instructions it had
+        EXPECT_EQ(policy->selectFetchThread(allCandidates), 1);
+    }
+}
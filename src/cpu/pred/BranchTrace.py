@@ -0,0 +1,83 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.objects.Probe import ProbeListenerObject
+from m5.params import *
+from m5.proxy import *
+from m5.SimObject import *
+
+
+class BranchTraceFormat(ScopedEnum):
+    vals = ["Branch", "Inst"]
+
+
+class BranchTraceRecorder(ProbeListenerObject):
+    """Records the committed branches of a branch predictor into a
+    protobuf branch trace (proto/branch.proto) that can be replayed by
+    the BranchTraceReplayer. Attach it to the predictor through the
+    manager parameter."""
+
+    type = "BranchTraceRecorder"
+    cxx_class = "gem5::branch_prediction::BranchTraceRecorder"
+    cxx_header = "cpu/pred/trace_recorder.hh"
+
+    cxx_exports = [PyBindMethod("stopRecording")]
+
+    # CPU whose retired instructions are counted so that the trace
+    # carries the instruction counts needed for MPKI.
+    cpu = Param.BaseCPU(Parent.any, "CPU to count retired instructions on")
+
+    # Branch trace output file, defaults to <name>.trc.gz in the output
+    # directory. A .gz suffix enables compression.
+    trace_file = Param.String("", "Branch trace output file")
+
+
+class BranchTraceReplayer(SimObject):
+    """Replays a recorded branch stream through one or more branch
+    predictors without a CPU. Call replay() after m5.instantiate() and
+    dump the statistics to obtain accuracy, MPKI and the host replay
+    rate of every predictor. Predictors are replayed in parallel."""
+
+    type = "BranchTraceReplayer"
+    cxx_class = "gem5::branch_prediction::BranchTraceReplayer"
+    cxx_header = "cpu/pred/trace_replayer.hh"
+
+    cxx_exports = [PyBindMethod("replay")]
+
+    numThreads = Param.Unsigned(1, "Number of hardware threads in the trace")
+    predictors = VectorParam.BranchPredictor("Branch predictors under test")
+    trace_file = Param.String("Trace to replay")
+    trace_format = Param.BranchTraceFormat(
+        "Branch",
+        "Trace format: Branch (branch.proto) or Inst (InstPBTrace, branches "
+        "are inferred from PC discontinuities)",
+    )
+    max_branches = Param.UInt64(
+        0, "Stop after this many branches (0 replays the whole trace)"
+    )
+    replay_threads = Param.Unsigned(
+        0, "Host threads used for replay (0 uses one per host core)"
+    )
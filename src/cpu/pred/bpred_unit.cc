@@ -83,6 +83,8 @@ BPredUnit::regProbePoints()
 {
     ppBranches = pmuProbePoint("Branches");
     ppMisses = pmuProbePoint("Misses");
+    ppCommittedBranches.reset(new ProbePointArg<CommittedBranch>(
+                getProbeManager(), "CommittedBranches"));
 }
 
 void
@@ -101,9 +103,20 @@ BPredUnit::predict(const StaticInstPtr &inst, const InstSeqNum &seqNum,
 {
     /** Perform the prediction. */
     PredictorHistory* bpu_history = nullptr;
+
+    // The fall-through address is only needed to report the instruction
+    // size to trace recorders. Avoid the extra PC copy otherwise.
+    Addr fall_through = 0;
+    if (ppCommittedBranches->hasListeners()) {
+        std::unique_ptr<PCStateBase> next_pc(pc.clone());
+        inst->advancePC(*next_pc);
+        fall_through = next_pc->instAddr();
+    }
+
     bool taken  = predict(inst, seqNum, pc, tid, bpu_history);
 
     assert(bpu_history!=nullptr);
+    bpu_history->fallThrough = fall_through;
 
     /** Push the record into the history buffer */
     predHist[tid].push_front(bpu_history);
@@ -374,6 +387,20 @@ BPredUnit::commitBranch(ThreadID tid, PredictorHistory* &hist)
                 hist->inst,
                 hist->target->instAddr());
 
+    if (ppCommittedBranches->hasListeners()) {
+        CommittedBranch info;
+        info.tid = tid;
+        info.seqNum = hist->seqNum;
+        info.pc = hist->pc;
+        info.target = hist->target->instAddr();
+        info.instSize = hist->fallThrough > hist->pc ?
+                        hist->fallThrough - hist->pc : 0;
+        info.type = hist->type;
+        info.taken = hist->actuallyTaken;
+        info.mispredicted = hist->mispredict;
+        ppCommittedBranches->notify(info);
+    }
+
     // Commit also Indirect predictor and RAS
     if (iPred) {
         iPred->commit(tid, hist->seqNum,
@@ -605,6 +632,28 @@ BPredUnit::squash(const InstSeqNum &squashed_sn,
 }
 
 
+const PCStateBase *
+BPredUnit::peekTakenTarget(ThreadID tid, Addr inst_pc)
+{
+    const PCStateBase *target = btb->peek(tid, inst_pc);
+    if (!target)
+        return nullptr;
+
+    const StaticInstPtr inst = btb->getInst(tid, inst_pc);
+    if (inst && inst->isCondCtrl()) {
+        // Look up the direction and immediately drop the history again
+        // so that the predictor state is left untouched.
+        void *bp_history = nullptr;
+        const bool taken = lookup(tid, inst_pc, bp_history);
+        squash(tid, bp_history);
+        if (!taken)
+            return nullptr;
+    }
+
+    return target;
+}
+
+
 void
 BPredUnit::dump()
 {
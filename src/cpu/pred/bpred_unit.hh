@@ -55,6 +55,7 @@
 #include "enums/TargetProvider.hh"
 #include "params/BranchPredictor.hh"
 #include "sim/probe/pmu.hh"
+#include "sim/probe/probe.hh"
 #include "sim/sim_object.hh"
 
 namespace gem5
@@ -63,6 +64,25 @@ namespace gem5
 namespace branch_prediction
 {
 
+/**
+ * Outcome of a branch at commit. Passed to listeners of the
+ * "CommittedBranches" probe point, e.g. to record a branch trace that
+ * can be replayed offline by the BranchTraceReplayer.
+ */
+struct CommittedBranch
+{
+    ThreadID tid;
+    InstSeqNum seqNum;
+    Addr pc;
+    /** The resolved next PC (branch target or fall-through). */
+    Addr target;
+    /** Instruction size in bytes, or 0 if it could not be determined. */
+    unsigned instSize;
+    BranchType type;
+    bool taken;
+    bool mispredicted;
+};
+
 /**
  * Basically a wrapper class to hold both the branch predictor
  * and the BTB.
@@ -128,6 +148,26 @@ class BPredUnit : public SimObject
     void squash(const InstSeqNum &squashed_sn, const PCStateBase &corr_target,
                 bool actually_taken, ThreadID tid, bool from_commit=true);
 
+    /**
+     * Predicts whether a taken branch sits at the given PC and where it
+     * goes, without recording history or touching BTB statistics and
+     * replacement state. Branches are only found if they hit in the BTB;
+     * conditional ones additionally consult the direction predictor with
+     * the current (non-speculative along the run-ahead path) history.
+     * Used by the run-ahead of a decoupled front end.
+     * @param tid The thread id.
+     * @param inst_pc The PC to look up.
+     * @return The predicted target or nullptr if no taken branch is
+     * predicted at this PC.
+     */
+    const PCStateBase *peekTakenTarget(ThreadID tid, Addr inst_pc);
+
+    /**
+     * The alignment the predictor and BTB tables are indexed at. Every
+     * PC within an aligned slot of this size finds the same entries.
+     */
+    unsigned instAlignment() const { return 1U << instShiftAmt; }
+
   protected:
 
     /** *******************************************************
@@ -324,6 +364,12 @@ class BPredUnit : public SimObject
         /** The predicted target */
         std::unique_ptr<PCStateBase> target;
 
+        /**
+         * Address of the next sequential instruction. Only tracked while
+         * the CommittedBranches probe has listeners.
+         */
+        Addr fallThrough = 0;
+
         /**
          * Pointer to the history objects passed back from the branch
          * predictor subcomponents.
@@ -462,6 +508,9 @@ class BPredUnit : public SimObject
     /** Miss-predicted branches */
     probing::PMUUPtr ppMisses;
 
+    /** Outcome of every committed branch */
+    std::unique_ptr<ProbePointArg<CommittedBranch>> ppCommittedBranches;
+
     /** @} */
 };
 
@@ -88,6 +88,15 @@ class BranchTargetBuffer : public ClockedObject
      */
     virtual const StaticInstPtr getInst(ThreadID tid, Addr instPC) = 0;
 
+    /** Looks up an address in the BTB without updating statistics or
+     *  replacement state. Intended for run-ahead users such as a
+     *  decoupled front end that must not disturb the BTB.
+     *  @param inst_PC The address of the branch to look up.
+     *  @return The target of the branch or nullptr if the branch is not
+     *          in the BTB.
+     */
+    virtual const PCStateBase *peek(ThreadID tid, Addr instPC) = 0;
+
 
     /** Updates the BTB with the target of a branch.
      *  @param inst_pc The address of the branch being updated.
@@ -110,6 +110,18 @@ SimpleBTB::getInst(ThreadID tid, Addr instPC)
     return nullptr;
 }
 
+const PCStateBase *
+SimpleBTB::peek(ThreadID tid, Addr instPC)
+{
+    BTBEntry *entry = btb.findEntry({instPC, tid});
+
+    if (entry) {
+        return entry->target.get();
+    }
+
+    return nullptr;
+}
+
 void
 SimpleBTB::update(ThreadID tid, Addr instPC,
                   const PCStateBase &target,
@@ -66,6 +66,7 @@ class SimpleBTB : public BranchTargetBuffer
                 BranchType type = BranchType::NoBranch,
                 StaticInstPtr inst = nullptr) override;
     const StaticInstPtr getInst(ThreadID tid, Addr instPC) override;
+    const PCStateBase *peek(ThreadID tid, Addr instPC) override;
 
   private:
 
@@ -37,6 +37,8 @@
 
 #include "cpu/pred/tage_base.hh"
 
+#include <algorithm>
+
 #include "base/intmath.hh"
 #include "base/logging.hh"
 #include "debug/Fetch.hh"
@@ -126,6 +128,24 @@ TAGEBase::init()
     // implementation
     assert(tagTableTagWidths[0] == 0);
 
+    // The tag match of all the tables is computed as a bit mask
+    fatal_if(nHistoryTables >= 64, "TAGE supports at most 63 tagged tables");
+
+    indexMasks.resize(nHistoryTables + 1, 0);
+    tagMasks.resize(nHistoryTables + 1, 0);
+    pcShifts.resize(nHistoryTables + 1, 0);
+    pathHistLengths.resize(nHistoryTables + 1, 0);
+    noSkipMask = 0;
+    for (int i = 1; i <= nHistoryTables; i++) {
+        indexMasks[i] = (1ULL << logTagTableSizes[i]) - 1;
+        tagMasks[i] = (1ULL << tagTableTagWidths[i]) - 1;
+        pcShifts[i] = abs(logTagTableSizes[i] - i) + 1;
+        pathHistLengths[i] = std::min<int>(histLengths[i], pathHistBits);
+        if (noSkip[i]) {
+            noSkipMask |= 1ULL << i;
+        }
+    }
+
     for (auto& history : threadHistory) {
         history.computeIndices = new FoldedHistory[nHistoryTables+1];
         history.computeTags[0] = new FoldedHistory[nHistoryTables+1];
@@ -165,8 +185,17 @@ TAGEBase::initFoldedHistories(ThreadHistory & history)
 void
 TAGEBase::buildTageTables()
 {
+    // Allocate all the tables in a single block
+    size_t num_entries = 0;
+    for (int i = 1; i <= nHistoryTables; i++) {
+        num_entries += 1ULL << logTagTableSizes[i];
+    }
+    tageStorage.resize(num_entries);
+
+    TageEntry *entries = tageStorage.data();
     for (int i = 1; i <= nHistoryTables; i++) {
-        gtable[i] = new TageEntry[1<<(logTagTableSizes[i])];
+        gtable[i] = entries;
+        entries += 1ULL << logTagTableSizes[i];
     }
 }
 
@@ -212,34 +241,14 @@ TAGEBase::bindex(Addr pc_in) const
 int
 TAGEBase::F(int A, int size, int bank) const
 {
-    int A1, A2;
-
-    A = A & ((1ULL << size) - 1);
-    A1 = (A & ((1ULL << logTagTableSizes[bank]) - 1));
-    A2 = (A >> logTagTableSizes[bank]);
-    A2 = ((A2 << bank) & ((1ULL << logTagTableSizes[bank]) - 1))
-       + (A2 >> (logTagTableSizes[bank] - bank));
-    A = A1 ^ A2;
-    A = ((A << bank) & ((1ULL << logTagTableSizes[bank]) - 1))
-      + (A >> (logTagTableSizes[bank] - bank));
-    return (A);
+    return foldPathHist(A, size, bank);
 }
 
 // gindex computes a full hash of pc, ghist and pathHist
 int
 TAGEBase::gindex(ThreadID tid, Addr pc, int bank) const
 {
-    int index;
-    int hlen = (histLengths[bank] > pathHistBits) ? pathHistBits :
-                                                    histLengths[bank];
-    const unsigned int shiftedPc = pc >> instShiftAmt;
-    index =
-        shiftedPc ^
-        (shiftedPc >> ((int) abs(logTagTableSizes[bank] - bank) + 1)) ^
-        threadHistory[tid].computeIndices[bank].comp ^
-        F(threadHistory[tid].pathHist, hlen, bank);
-
-    return (index & ((1ULL << (logTagTableSizes[bank])) - 1));
+    return baseIndex(threadHistory[tid], pc >> instShiftAmt, bank);
 }
 
 
@@ -247,11 +256,7 @@ TAGEBase::gindex(ThreadID tid, Addr pc, int bank) const
 uint16_t
 TAGEBase::gtag(ThreadID tid, Addr pc, int bank) const
 {
-    int tag = (pc >> instShiftAmt) ^
-              threadHistory[tid].computeTags[0][bank].comp ^
-              (threadHistory[tid].computeTags[1][bank].comp << 1);
-
-    return (tag & ((1ULL << tagTableTagWidths[bank]) - 1));
+    return baseTag(threadHistory[tid], pc >> instShiftAmt, bank);
 }
 
 
@@ -343,10 +348,13 @@ TAGEBase::calculateIndicesAndTags(ThreadID tid, Addr branch_pc,
     // computes the table addresses and the partial tags
     for (int i = 1; i <= nHistoryTables; i++) {
         tableIndices[i] = gindex(tid, branch_pc, i);
-        bi->tableIndices[i] = tableIndices[i];
         tableTags[i] = gtag(tid, branch_pc, i);
-        bi->tableTags[i] = tableTags[i];
     }
+
+    std::copy(tableIndices + 1, tableIndices + nHistoryTables + 1,
+              bi->tableIndices + 1);
+    std::copy(tableTags + 1, tableTags + nHistoryTables + 1,
+              bi->tableTags + 1);
 }
 
 unsigned
@@ -372,23 +380,24 @@ TAGEBase::tagePredict(ThreadID tid, Addr branch_pc,
 
         bi->hitBank = 0;
         bi->altBank = 0;
-        //Look for the bank with longest matching history
-        for (int i = nHistoryTables; i > 0; i--) {
-            if (noSkip[i] &&
-                gtable[i][tableIndices[i]].tag == tableTags[i]) {
-                bi->hitBank = i;
-                bi->hitBankIndex = tableIndices[bi->hitBank];
-                break;
-            }
+        // Compare the tags of all the banks at once, the longest matching
+        // history is then the highest bit set and the alternate bank the
+        // next one
+        uint64_t hits = 0;
+        for (int i = 1; i <= nHistoryTables; i++) {
+            hits |= uint64_t(gtable[i][tableIndices[i]].tag ==
+                             tableTags[i]) << i;
         }
-        //Look for the alternate bank
-        for (int i = bi->hitBank - 1; i > 0; i--) {
-            if (noSkip[i] &&
-                gtable[i][tableIndices[i]].tag == tableTags[i]) {
-                bi->altBank = i;
-                bi->altBankIndex = tableIndices[bi->altBank];
-                break;
-            }
+        hits &= noSkipMask;
+
+        if (hits) {
+            bi->hitBank = floorLog2(hits);
+            bi->hitBankIndex = tableIndices[bi->hitBank];
+            hits &= ~(1ULL << bi->hitBank);
+        }
+        if (hits) {
+            bi->altBank = floorLog2(hits);
+            bi->altBankIndex = tableIndices[bi->altBank];
         }
         //computes the prediction and the alternate prediction
         if (bi->hitBank > 0) {
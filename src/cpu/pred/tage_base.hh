@@ -71,13 +71,13 @@ class TAGEBase : public SimObject
   protected:
     // Prediction Structures
 
-    // Tage Entry
+    // Tage Entry, ordered to pack into 4 bytes
     struct TageEntry
     {
-        int8_t ctr;
         uint16_t tag;
+        int8_t ctr;
         uint8_t u;
-        TageEntry() : ctr(0), tag(0), u(0) { }
+        TageEntry() : tag(0), ctr(0), u(0) { }
     };
 
     // Folded History Table - compressed history
@@ -361,7 +361,7 @@ class TAGEBase : public SimObject
 
     /**
      * On a prediction, calculates the TAGE indices and tags for
-     * all the different history lengths
+     * all the different history lengths, with gindex and gtag.
      */
     virtual void calculateIndicesAndTags(
         ThreadID tid, Addr branch_pc, BranchInfo* bi);
@@ -437,6 +437,10 @@ class TAGEBase : public SimObject
     std::vector<bool> btableHysteresis;
     TageEntry **gtable;
 
+    // Contiguous storage for all the tagged tables allocated by the base
+    // buildTageTables(); gtable points into it.
+    std::vector<TageEntry> tageStorage;
+
     // Keep per-thread histories to
     // support SMT.
     struct ThreadHistory
@@ -463,6 +467,45 @@ class TAGEBase : public SimObject
 
     std::vector<ThreadHistory> threadHistory;
 
+    /**
+     * The hash functions of the base implementation of F, gindex and
+     * gtag. They only use the per-table constants computed at init
+     * time, rather than working out the masks and shifts on each call.
+     */
+    int
+    foldPathHist(int A, int size, int bank) const
+    {
+        const int log_size = logTagTableSizes[bank];
+        const int mask = indexMasks[bank];
+        int A1, A2;
+
+        A = A & ((1ULL << size) - 1);
+        A1 = (A & mask);
+        A2 = (A >> log_size);
+        A2 = ((A2 << bank) & mask) + (A2 >> (log_size - bank));
+        A = A1 ^ A2;
+        A = ((A << bank) & mask) + (A >> (log_size - bank));
+        return A;
+    }
+
+    int
+    baseIndex(const ThreadHistory &t_hist, unsigned shifted_pc,
+              int bank) const
+    {
+        const int index = shifted_pc ^ (shifted_pc >> pcShifts[bank]) ^
+            t_hist.computeIndices[bank].comp ^
+            foldPathHist(t_hist.pathHist, pathHistLengths[bank], bank);
+        return index & indexMasks[bank];
+    }
+
+    int
+    baseTag(const ThreadHistory &t_hist, unsigned shifted_pc, int bank) const
+    {
+        const int tag = shifted_pc ^ t_hist.computeTags[0][bank].comp ^
+            (t_hist.computeTags[1][bank].comp << 1);
+        return tag & tagMasks[bank];
+    }
+
     /**
      * Initialization of the folded histories
      */
@@ -472,6 +515,12 @@ class TAGEBase : public SimObject
     int *tableIndices;
     int *tableTags;
 
+    // Per-table hashing constants, one contiguous array per constant
+    std::vector<int> indexMasks;
+    std::vector<int> tagMasks;
+    std::vector<int> pcShifts;
+    std::vector<int> pathHistLengths;
+
     std::vector<int8_t> useAltPredForNewlyAllocated;
     int64_t tCounter;
     uint64_t logUResetPeriod;
@@ -484,6 +533,8 @@ class TAGEBase : public SimObject
     // (for the base TAGE implementation all are active)
     // Some other classes use this for handling associativity
     std::vector<bool> noSkip;
+    // Same as noSkip, bit i set if table i is active
+    uint64_t noSkipMask;
 
     const bool speculativeHistUpdate;
 
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <memory>
+#include <random>
+
+#include "cpu/pred/tage_base.hh"
+#include "params/TAGEBase.hh"
+
+using namespace gem5;
+using namespace gem5::branch_prediction;
+
+// The version tags are declared as extern
+namespace gem5
+{
+std::set<std::string> version_tags;
+} // namespace gem5
+
+namespace
+{
+
+/** Parameters of the default TAGEBase, with a smaller history buffer */
+TAGEBaseParams
+tageParams()
+{
+    TAGEBaseParams p;
+    p.name = "tage";
+    p.eventq_index = 0;
+    p.numThreads = 1;
+    p.instShiftAmt = 2;
+    p.nHistoryTables = 7;
+    p.minHist = 5;
+    p.maxHist = 130;
+    p.tagTableTagWidths = {0, 9, 9, 10, 10, 11, 11, 12};
+    p.logTagTableSizes = {13, 9, 9, 9, 9, 9, 9, 9};
+    p.logRatioBiModalHystEntries = 2;
+    p.tagTableCounterBits = 3;
+    p.tagTableUBits = 2;
+    p.histBufferSize = 4096;
+    p.pathHistBits = 16;
+    p.logUResetPeriod = 18;
+    p.numUseAltOnNa = 1;
+    p.initialTCounterValue = 1 << 17;
+    p.useAltOnNaBits = 4;
+    p.maxNumAlloc = 1;
+    p.speculativeHistUpdate = true;
+    return p;
+}
+
+class TestTAGE : public TAGEBase
+{
+  public:
+    using TAGEBase::TAGEBase;
+
+    /** The index hash as it was before its constants were precomputed */
+    int
+    refIndex(ThreadID tid, Addr pc, int bank) const
+    {
+        const int log_size = logTagTableSizes[bank];
+        const int size_mask = (1ULL << log_size) - 1;
+        const int hlen = std::min<int>(histLengths[bank], pathHistBits);
+
+        int a = threadHistory[tid].pathHist & ((1ULL << hlen) - 1);
+        int a1 = a & size_mask;
+        int a2 = a >> log_size;
+        a2 = ((a2 << bank) & size_mask) + (a2 >> (log_size - bank));
+        a = a1 ^ a2;
+        a = ((a << bank) & size_mask) + (a >> (log_size - bank));
+
+        const unsigned shifted_pc = pc >> instShiftAmt;
+        const int index = shifted_pc ^
+            (shifted_pc >> (std::abs(log_size - bank) + 1)) ^
+            threadHistory[tid].computeIndices[bank].comp ^ a;
+        return index & size_mask;
+    }
+
+    /** The tag hash as it was before its constants were precomputed */
+    uint16_t
+    refTag(ThreadID tid, Addr pc, int bank) const
+    {
+        const int tag = (pc >> instShiftAmt) ^
+            threadHistory[tid].computeTags[0][bank].comp ^
+            (threadHistory[tid].computeTags[1][bank].comp << 1);
+        return tag & ((1ULL << tagTableTagWidths[bank]) - 1);
+    }
+
+    int numTables() const { return nHistoryTables; }
+    int pathHist(ThreadID tid) const { return threadHistory[tid].pathHist; }
+};
+
+/** A TAGE that only overrides the hash functions */
+class RehashTAGE : public TestTAGE
+{
+  public:
+    using TestTAGE::TestTAGE;
+
+    int
+    gindex(ThreadID tid, Addr pc, int bank) const override
+    {
+        return TAGEBase::gindex(tid, pc, bank) ^ 1;
+    }
+
+    uint16_t
+    gtag(ThreadID tid, Addr pc, int bank) const override
+    {
+        return TAGEBase::gtag(tid, pc, bank) ^ 2;
+    }
+};
+
+/**
+ * Run a random branch stream through the speculative history update,
+ * and call a check on the histories after each branch.
+ */
+template <typename Check>
+void
+runBranches(TestTAGE &tage, Check check)
+{
+    std::mt19937 rng(1);
+    for (int i = 0; i < 2000; i++) {
+        const Addr pc = 0x400000 + (rng() % 1024) * 4;
+        std::unique_ptr<TAGEBase::BranchInfo> bi(tage.makeBranchInfo());
+        tage.tagePredict(0, pc, true, bi.get());
+        tage.updateHistories(0, pc, rng() % 3 != 0, bi.get(), true,
+                             StaticInstPtr(), pc + 64);
+        check(pc ^ (rng() % 4096) * 4);
+    }
+}
+
+TEST(TAGEBaseTest, IndicesAndTagsMatchTheHashes)
+{
+    TestTAGE tage(tageParams());
+    tage.init();
+
+    bool saw_history = false;
+    runBranches(tage, [&](Addr pc) {
+        saw_history |= tage.pathHist(0) != 0;
+        TAGEBase::BranchInfo bi(tage);
+        tage.calculateIndicesAndTags(0, pc, &bi);
+        for (int i = 1; i <= tage.numTables(); i++) {
+            ASSERT_EQ(bi.tableIndices[i], tage.gindex(0, pc, i));
+            ASSERT_EQ(bi.tableTags[i], tage.gtag(0, pc, i));
+            ASSERT_EQ(bi.tableIndices[i], tage.refIndex(0, pc, i));
+            ASSERT_EQ(bi.tableTags[i], tage.refTag(0, pc, i));
+        }
+    });
+    EXPECT_TRUE(saw_history);
+}
+
+TEST(TAGEBaseTest, OverriddenHashesAreUsed)
+{
+    RehashTAGE tage(tageParams());
+    tage.init();
+
+    runBranches(tage, [&](Addr pc) {
+        TAGEBase::BranchInfo bi(tage);
+        tage.calculateIndicesAndTags(0, pc, &bi);
+        for (int i = 1; i <= tage.numTables(); i++) {
+            ASSERT_EQ(bi.tableIndices[i], tage.refIndex(0, pc, i) ^ 1);
+            ASSERT_EQ(bi.tableTags[i], tage.refTag(0, pc, i) ^ 2);
+        }
+    });
+}
+
+} // anonymous namespace
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/pred/trace_recorder.hh"
+
+#include <algorithm>
+
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "cpu/base.hh"
+#include "proto/branch.pb.h"
+#include "sim/probe/pmu.hh"
+
+namespace gem5
+{
+
+namespace branch_prediction
+{
+
+BranchTraceRecorder::BranchTraceRecorder(const BranchTraceRecorderParams &p)
+    : ProbeListenerObject(p),
+      cpu(p.cpu),
+      traceStream(nullptr),
+      numBranches(0),
+      retiredInsts(0)
+{
+    fatal_if(!cpu, "%s: a CPU is needed to count the instructions of the "
+             "trace\n", name());
+
+    const std::string filename = simout.resolve(
+        p.trace_file != "" ? p.trace_file : name() + ".trc.gz");
+    traceStream = new ProtoOutputStream(filename);
+
+    // Register a callback to compensate for the destructor not
+    // being called. The callback forces the stream to flush and
+    // closes the output file.
+    registerExitCallback([this]() { closeStreams(); });
+}
+
+void
+BranchTraceRecorder::regProbeListeners()
+{
+    listeners.push_back(new ProbeListenerArg<BranchTraceRecorder,
+            CommittedBranch>(this, "CommittedBranches",
+                &BranchTraceRecorder::recordBranch));
+
+    listeners.push_back(new ProbeListenerArgFunc<uint64_t>(
+        cpu->getProbeManager(), "RetiredInsts",
+        [this](const uint64_t &insts) { retiredInsts += insts; }));
+}
+
+void
+BranchTraceRecorder::startup()
+{
+    ProtoMessage::BranchHeader header_msg;
+    header_msg.set_obj_id(name());
+    traceStream->write(header_msg);
+}
+
+uint64_t
+BranchTraceRecorder::stopRecording()
+{
+    for (auto *listener : listeners)
+        delete listener;
+    listeners.clear();
+
+    closeStreams();
+    return numBranches;
+}
+
+void
+BranchTraceRecorder::closeStreams()
+{
+    if (traceStream != nullptr) {
+        delete traceStream;
+        traceStream = nullptr;
+    }
+}
+
+void
+BranchTraceRecorder::recordBranch(const CommittedBranch &branch)
+{
+    ProtoMessage::Branch branch_msg;
+
+    branch_msg.set_pc(branch.pc);
+    branch_msg.set_target(branch.target);
+    branch_msg.set_taken(branch.taken);
+    branch_msg.set_type(
+        static_cast<ProtoMessage::Branch::BranchType>(branch.type));
+    if (branch.instSize)
+        branch_msg.set_inst_size(branch.instSize);
+    branch_msg.set_inst_count(std::max<uint64_t>(retiredInsts, 1));
+    retiredInsts = 0;
+    if (branch.tid)
+        branch_msg.set_tid(branch.tid);
+
+    traceStream->write(branch_msg);
+    numBranches++;
+}
+
+} // namespace branch_prediction
+} // namespace gem5
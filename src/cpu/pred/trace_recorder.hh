@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Probe listener that records the committed branches of a BPredUnit into
+ * a protobuf branch trace for offline replay.
+ */
+
+#ifndef __CPU_PRED_TRACE_RECORDER_HH__
+#define __CPU_PRED_TRACE_RECORDER_HH__
+
+#include <cstdint>
+
+#include "cpu/pred/bpred_unit.hh"
+#include "params/BranchTraceRecorder.hh"
+#include "proto/protoio.hh"
+#include "sim/probe/probe.hh"
+
+namespace gem5
+{
+
+class BaseCPU;
+
+namespace branch_prediction
+{
+
+class BranchTraceRecorder : public ProbeListenerObject
+{
+  public:
+    BranchTraceRecorder(const BranchTraceRecorderParams &p);
+
+    void regProbeListeners() override;
+
+    void startup() override;
+
+    /**
+     * Stop recording and close the trace, so that it can be replayed
+     * in the same simulation. Exported to Python.
+     *
+     * @return The number of branches recorded.
+     */
+    uint64_t stopRecording();
+
+  private:
+    /** Write one committed branch to the trace. */
+    void recordBranch(const CommittedBranch &branch);
+
+    void closeStreams();
+
+    /** CPU whose retired instructions are counted. */
+    BaseCPU *cpu;
+
+    ProtoOutputStream *traceStream;
+
+    /** Number of branches recorded. */
+    uint64_t numBranches;
+
+    /**
+     * Instructions retired since the previous recorded branch. Branches
+     * commit in the predictor slightly after they retire, so counts are
+     * attributed approximately per branch but exact in total.
+     */
+    uint64_t retiredInsts;
+};
+
+} // namespace branch_prediction
+} // namespace gem5
+
+#endif // __CPU_PRED_TRACE_RECORDER_HH__
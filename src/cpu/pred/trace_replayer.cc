@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/pred/trace_replayer.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+
+#include "arch/generic/pcstate.hh"
+#include "base/logging.hh"
+#include "proto/branch.pb.h"
+#include "proto/inst.pb.h"
+#include "proto/protoio.hh"
+
+namespace gem5
+{
+
+namespace branch_prediction
+{
+
+TraceBranchInst::TraceBranchInst(BranchType type, size_t inst_size)
+    : StaticInst("trace_branch", No_OpClass)
+{
+    flags[IsControl] = true;
+
+    switch (type) {
+      case BranchType::Return:
+        flags[IsReturn] = true;
+        flags[IsIndirectControl] = true;
+        flags[IsUncondControl] = true;
+        break;
+      case BranchType::CallDirect:
+        flags[IsCall] = true;
+        flags[IsDirectControl] = true;
+        flags[IsUncondControl] = true;
+        break;
+      case BranchType::CallIndirect:
+        flags[IsCall] = true;
+        flags[IsIndirectControl] = true;
+        flags[IsUncondControl] = true;
+        break;
+      case BranchType::DirectCond:
+        flags[IsDirectControl] = true;
+        flags[IsCondControl] = true;
+        break;
+      case BranchType::DirectUncond:
+        flags[IsDirectControl] = true;
+        flags[IsUncondControl] = true;
+        break;
+      case BranchType::IndirectCond:
+        flags[IsIndirectControl] = true;
+        flags[IsCondControl] = true;
+        break;
+      case BranchType::IndirectUncond:
+        flags[IsIndirectControl] = true;
+        flags[IsUncondControl] = true;
+        break;
+      default:
+        panic("Unexpected branch type %s in trace\n", toString(type));
+    }
+
+    size(inst_size);
+}
+
+Fault
+TraceBranchInst::execute(ExecContext *xc, trace::InstRecord *traceData) const
+{
+    panic("Trace branches can only be used for prediction\n");
+}
+
+void
+TraceBranchInst::advancePC(PCStateBase &pc) const
+{
+    pc.set(pc.instAddr() + size());
+}
+
+std::unique_ptr<PCStateBase>
+TraceBranchInst::buildRetPC(const PCStateBase &cur_pc,
+                            const PCStateBase &call_pc) const
+{
+    std::unique_ptr<PCStateBase> ret_pc(call_pc.clone());
+    advancePC(*ret_pc);
+    return ret_pc;
+}
+
+std::string
+TraceBranchInst::generateDisassembly(Addr pc,
+                                     const loader::SymbolTable *symtab) const
+{
+    return mnemonic;
+}
+
+BranchTraceReplayer::BranchTraceReplayer(const Params &p)
+    : SimObject(p),
+      predictors(p.predictors),
+      traceFile(p.trace_file),
+      traceFormat(p.trace_format),
+      numThreads(p.numThreads),
+      maxBranches(p.max_branches),
+      replayThreads(p.replay_threads)
+{
+    fatal_if(predictors.empty(), "%s: at least one branch predictor is "
+             "required\n", name());
+
+    for (auto *predictor : predictors)
+        stats.emplace_back(new ReplayStats(predictor));
+}
+
+void
+BranchTraceReplayer::loadBranchTrace(Trace &trace) const
+{
+    ProtoInputStream input(traceFile);
+
+    ProtoMessage::BranchHeader header;
+    fatal_if(!input.read(header), "%s: failed to read branch trace header "
+             "from %s\n", name(), traceFile);
+    inform("%s: loading branch trace '%s' recorded by %s\n", name(),
+           traceFile, header.obj_id());
+
+    ProtoMessage::Branch msg;
+    uint32_t insts = 0;
+    uint64_t total_insts = 0;
+    while ((!maxBranches || trace.size() < maxBranches) && input.read(msg)) {
+        insts += msg.inst_count();
+        total_insts += msg.inst_count();
+
+        const auto type = static_cast<BranchType>(msg.type());
+        if (type == BranchType::NoBranch)
+            continue;
+
+        fatal_if(msg.tid() >= numThreads, "%s: trace thread %d exceeds the "
+                 "configured %d threads\n", name(), msg.tid(), numThreads);
+        fatal_if(msg.inst_size() == 0 || msg.inst_size() > UINT8_MAX,
+                 "%s: invalid instruction size %d for branch at %#x\n",
+                 name(), msg.inst_size(), msg.pc());
+
+        trace.push_back({msg.pc(), msg.target(), insts,
+                         static_cast<uint8_t>(msg.inst_size()), type,
+                         msg.taken(), static_cast<ThreadID>(msg.tid())});
+        insts = 0;
+    }
+
+    warn_if(!trace.empty() && !total_insts, "%s: branch trace '%s' has no "
+            "instruction counts, MPKI is not available\n", name(),
+            traceFile);
+}
+
+void
+BranchTraceReplayer::loadInstTrace(Trace &trace) const
+{
+    ProtoInputStream input(traceFile);
+
+    ProtoMessage::InstHeader header;
+    fatal_if(!input.read(header), "%s: failed to read instruction trace "
+             "header from %s\n", name(), traceFile);
+    inform("%s: inferring branches from instruction trace '%s' recorded "
+           "by %s\n", name(), traceFile, header.obj_id());
+
+    // Instruction traces carry no control-flow information. Every PC
+    // discontinuity is a taken branch; a PC that was once seen taking a
+    // branch and later falls through is a not-taken branch. Branches that
+    // are never taken are invisible, and the branch type is unknown, so
+    // all inferred branches are treated as direct conditional branches.
+    std::unordered_set<Addr> branch_pcs;
+    ProtoMessage::Inst msg;
+    bool have_prev = false;
+    Addr prev_pc = 0;
+    unsigned prev_size = 0;
+    uint32_t insts = 0;
+
+    while ((!maxBranches || trace.size() < maxBranches) && input.read(msg)) {
+        const Addr pc = msg.pc();
+
+        if (have_prev) {
+            const bool taken = pc != prev_pc + prev_size;
+            if (taken)
+                branch_pcs.insert(prev_pc);
+
+            if (taken || branch_pcs.count(prev_pc)) {
+                trace.push_back({prev_pc, pc, insts,
+                                 static_cast<uint8_t>(prev_size),
+                                 BranchType::DirectCond, taken, 0});
+                insts = 0;
+            }
+        }
+
+        ++insts;
+        prev_pc = pc;
+        prev_size = msg.has_inst_bytes() ? msg.inst_bytes().size() :
+                                           sizeof(uint32_t);
+        have_prev = true;
+    }
+}
+
+void
+BranchTraceReplayer::replayOne(BPredUnit *predictor, ReplayStats &stats,
+                               const Trace &trace) const
+{
+    // Synthetic instructions are reference counted without atomics, so
+    // every replay builds its own set rather than sharing it across
+    // host threads.
+    std::map<std::pair<BranchType, unsigned>, StaticInstPtr> insts;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    InstSeqNum seq_num = 0;
+    GenericISA::SimplePCState<4> pc(0);
+    GenericISA::SimplePCState<4> next_pc(0);
+
+    for (const auto &rec : trace) {
+        StaticInstPtr &inst = insts[{rec.type, rec.instSize}];
+        if (!inst)
+            inst = new TraceBranchInst(rec.type, rec.instSize);
+
+        pc.set(rec.pc);
+        next_pc.set(rec.target);
+
+        ++seq_num;
+        const bool pred_taken = predictor->predict(inst, seq_num, pc,
+                                                   rec.tid);
+        const bool mispredict = pred_taken != rec.taken ||
+                                pc.instAddr() != next_pc.instAddr();
+
+        stats.insts += rec.instCount;
+        ++stats.branches;
+        if (inst->isCondCtrl()) {
+            ++stats.condBranches;
+            if (pred_taken != rec.taken)
+                ++stats.condMispredicted;
+        }
+
+        if (mispredict) {
+            ++stats.mispredicted;
+            if (pred_taken && rec.taken)
+                ++stats.targetMispredicted;
+
+            predictor->squash(seq_num, next_pc, rec.taken, rec.tid);
+        }
+
+        predictor->update(seq_num, rec.tid);
+    }
+
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    stats.hostSeconds += elapsed.count();
+}
+
+uint64_t
+BranchTraceReplayer::replay()
+{
+    Trace trace;
+    if (traceFormat == BranchTraceFormat::Inst)
+        loadInstTrace(trace);
+    else
+        loadBranchTrace(trace);
+
+    unsigned workers = replayThreads ? replayThreads :
+                       std::max(1U, std::thread::hardware_concurrency());
+    workers = std::min<size_t>(workers, predictors.size());
+
+    inform("%s: replaying %d branches through %d predictor(s) on %d "
+           "host thread(s)\n", name(), trace.size(), predictors.size(),
+           workers);
+
+    std::atomic<size_t> next(0);
+    auto worker = [&]() {
+        for (size_t i = next++; i < predictors.size(); i = next++)
+            replayOne(predictors[i], *stats[i], trace);
+    };
+
+    if (workers <= 1) {
+        worker();
+    } else {
+        std::vector<std::thread> pool;
+        for (unsigned i = 0; i < workers; ++i)
+            pool.emplace_back(worker);
+        for (auto &thread : pool)
+            thread.join();
+    }
+
+    return trace.size();
+}
+
+BranchTraceReplayer::ReplayStats::ReplayStats(statistics::Group *parent)
+    : statistics::Group(parent, "replay"),
+      ADD_STAT(insts, statistics::units::Count::get(),
+               "Number of instructions covered by the trace"),
+      ADD_STAT(branches, statistics::units::Count::get(),
+               "Number of branches replayed"),
+      ADD_STAT(condBranches, statistics::units::Count::get(),
+               "Number of conditional branches replayed"),
+      ADD_STAT(mispredicted, statistics::units::Count::get(),
+               "Number of branches whose next PC was mispredicted"),
+      ADD_STAT(condMispredicted, statistics::units::Count::get(),
+               "Number of conditional branches with a wrong direction"),
+      ADD_STAT(targetMispredicted, statistics::units::Count::get(),
+               "Number of taken branches predicted taken with a wrong "
+               "target"),
+      ADD_STAT(accuracy, statistics::units::Ratio::get(),
+               "Fraction of branches with a correct next PC",
+               1 - mispredicted / branches),
+      ADD_STAT(condAccuracy, statistics::units::Ratio::get(),
+               "Fraction of conditional branches with a correct direction",
+               1 - condMispredicted / condBranches),
+      ADD_STAT(mpki, statistics::units::Rate<
+                statistics::units::Count, statistics::units::Count>::get(),
+               "Mispredictions per thousand instructions",
+               mispredicted * 1000 / insts),
+      ADD_STAT(hostSeconds, statistics::units::Second::get(),
+               "Host time spent replaying the trace"),
+      ADD_STAT(branchRate, statistics::units::Rate<
+                statistics::units::Count, statistics::units::Second>::get(),
+               "Branches replayed per host second",
+               branches / hostSeconds)
+{
+    accuracy.precision(6);
+    condAccuracy.precision(6);
+    mpki.precision(3);
+    branchRate.precision(0);
+}
+
+} // namespace branch_prediction
+} // namespace gem5
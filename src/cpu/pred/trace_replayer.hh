@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Trace-driven branch predictor replay. Drives one or more BPredUnits
+ * directly from a recorded branch stream, without a CPU, caches or the
+ * event queue, so that predictor accuracy and host throughput can be
+ * measured in isolation.
+ */
+
+#ifndef __CPU_PRED_TRACE_REPLAYER_HH__
+#define __CPU_PRED_TRACE_REPLAYER_HH__
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "cpu/pred/bpred_unit.hh"
+#include "cpu/pred/branch_type.hh"
+#include "cpu/static_inst.hh"
+#include "enums/BranchTraceFormat.hh"
+#include "params/BranchTraceReplayer.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+namespace branch_prediction
+{
+
+/**
+ * Synthetic control instruction standing in for the traced branch. It
+ * only carries the flags the predictor looks at (getBranchType) and its
+ * size, which is needed to compute fall-through and return addresses.
+ */
+class TraceBranchInst : public StaticInst
+{
+  public:
+    TraceBranchInst(BranchType type, size_t inst_size);
+
+    Fault execute(ExecContext *xc,
+                  trace::InstRecord *traceData) const override;
+
+    void advancePC(PCStateBase &pc) const override;
+
+    std::unique_ptr<PCStateBase> buildRetPC(
+            const PCStateBase &cur_pc,
+            const PCStateBase &call_pc) const override;
+
+    std::string generateDisassembly(
+            Addr pc, const loader::SymbolTable *symtab) const override;
+};
+
+/**
+ * Replays a branch stream through a set of predictors. The stream is
+ * either a branch trace (proto/branch.proto), as written by the
+ * BranchTraceRecorder, or an InstPBTrace instruction trace from which
+ * taken branches are inferred from PC discontinuities.
+ *
+ * The trace is decoded once into memory and then replayed through every
+ * predictor. Predictors share no state, so they are replayed on separate
+ * host threads, which makes it cheap to sweep many configurations in one
+ * process.
+ */
+class BranchTraceReplayer : public SimObject
+{
+  public:
+    PARAMS(BranchTraceReplayer);
+    BranchTraceReplayer(const Params &p);
+
+    /**
+     * Replay the trace through all predictors. Every branch is predicted,
+     * corrected on a misprediction and then committed before the next one
+     * is looked up, i.e. the predictors always see correct-path history.
+     * Exported to Python so that configuration scripts can call it
+     * directly after m5.instantiate().
+     *
+     * @return The number of branches replayed per predictor.
+     */
+    uint64_t replay();
+
+  private:
+    /** Compact in-memory form of one traced branch. */
+    struct TraceRecord
+    {
+        Addr pc;
+        /** The next PC after the branch (target or fall-through). */
+        Addr target;
+        /** Instructions retired since the previous record. */
+        uint32_t instCount;
+        uint8_t instSize;
+        BranchType type;
+        bool taken;
+        ThreadID tid;
+    };
+
+    typedef std::vector<TraceRecord> Trace;
+
+    /** Decode a proto/branch.proto trace. */
+    void loadBranchTrace(Trace &trace) const;
+
+    /** Infer the branch stream of an InstPBTrace instruction trace. */
+    void loadInstTrace(Trace &trace) const;
+
+    struct ReplayStats : public statistics::Group
+    {
+        ReplayStats(statistics::Group *parent);
+
+        statistics::Scalar insts;
+        statistics::Scalar branches;
+        statistics::Scalar condBranches;
+        statistics::Scalar mispredicted;
+        statistics::Scalar condMispredicted;
+        statistics::Scalar targetMispredicted;
+        statistics::Formula accuracy;
+        statistics::Formula condAccuracy;
+        statistics::Formula mpki;
+        statistics::Scalar hostSeconds;
+        statistics::Formula branchRate;
+    };
+
+    /** Replay the decoded trace through a single predictor. */
+    void replayOne(BPredUnit *predictor, ReplayStats &stats,
+                   const Trace &trace) const;
+
+    const std::vector<BPredUnit *> predictors;
+    const std::string traceFile;
+    const BranchTraceFormat traceFormat;
+    const unsigned numThreads;
+
+    /** Stop after this many branches (0 replays the whole trace). */
+    const uint64_t maxBranches;
+
+    /** Host threads used for replay (0 picks one per host core). */
+    const unsigned replayThreads;
+
+    /**
+     * Per-predictor replay statistics. They are registered below the
+     * predictor they belong to, next to its own BPredUnit statistics.
+     */
+    std::vector<std::unique_ptr<ReplayStats>> stats;
+};
+
+} // namespace branch_prediction
+} // namespace gem5
+
+#endif // __CPU_PRED_TRACE_REPLAYER_HH__
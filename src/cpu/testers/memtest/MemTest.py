@@ -64,6 +64,12 @@ class MemTest(ClockedObject):
     percent_uncacheable = Param.Percent(10, "Percentage uncacheable")
     percent_atomic = Param.Percent(0, "Percentage atomics")
 
+    # Cache maintenance operations clean, and possibly invalidate, the
+    # line down to the point of coherence. On completion the memory
+    # below must hold the last value written, this relies on the
+    # classic memory system backing store
+    percent_cmos = Param.Percent(0, "Percentage cache maintenance operations")
+
     # Determine how often to print progress messages and what timeout
     # to use for checking progress of both requests and responses
     progress_interval = Param.Counter(
@@ -94,6 +94,8 @@ MemTest::MemTest(const Params &p)
       percentFunctional(p.percent_functional),
       percentUncacheable(p.percent_uncacheable),
       percentAtomic(p.percent_atomic),
+      percentCmos(p.percent_cmos),
+      system(p.system),
       requestorId(p.system->getRequestorId(this)),
       blockSize(p.system->cacheLineSize()),
       blockAddrMask(blockSize - 1),
@@ -194,6 +196,30 @@ MemTest::completeRequest(PacketPtr pkt, bool functional)
 
             if (maxLoads != 0 && numReads >= maxLoads)
                 exitSimLoop("maximum number of loads reached");
+        } else if (pkt->isClean()) {
+            // whatever we wrote here before the cache maintenance
+            // operation must have reached the memory below the point
+            // of coherence by the time it completes
+            auto ref = referenceData.find(req->getPaddr());
+            auto &physmem = system->getPhysMem();
+            if (ref != referenceData.end() &&
+                physmem.isMemAddr(req->getPaddr())) {
+                uint8_t mem_data;
+                RequestPtr mem_req = std::make_shared<Request>(
+                    req->getPaddr(), 1, 0, requestorId);
+                Packet mem_pkt(mem_req, MemCmd::ReadReq);
+                mem_pkt.dataStatic(&mem_data);
+                physmem.functionalAccess(&mem_pkt);
+                if (mem_data != ref->second) {
+                    panic("%s: %s of %x (blk %x) @ cycle %d "
+                          "leaves %x in memory, expected %x\n", name(),
+                          pkt->cmdString(), req->getPaddr(),
+                          blockAlign(req->getPaddr()), curTick(),
+                          mem_data, ref->second);
+                }
+            }
+
+            stats.numCmos++;
         } else {
             assert(pkt->isWrite());
 
@@ -227,7 +253,9 @@ MemTest::MemTestStats::MemTestStats(statistics::Group *parent)
       ADD_STAT(numWrites, statistics::units::Count::get(),
                "number of write accesses completed"),
       ADD_STAT(numAtomics, statistics::units::Count::get(),
-               "number of atomic accesses completed")
+               "number of atomic accesses completed"),
+      ADD_STAT(numCmos, statistics::units::Count::get(),
+               "number of cache maintenance operations completed")
 {
 
 }
@@ -274,6 +302,9 @@ MemTest::tick()
 
     bool do_functional = (rng->random(0, 100) < percentFunctional) &&
         !uncacheable;
+    // only draw when enabled, to keep the sequence of existing tests
+    bool do_cmo = percentCmos && !uncacheable && !do_functional &&
+        rng->random(0, 100) < percentCmos;
     RequestPtr req = std::make_shared<Request>(paddr, 1, flags, requestorId);
     req->setContext(id);
 
@@ -286,7 +317,20 @@ MemTest::tick()
     PacketPtr pkt = nullptr;
     uint8_t *pkt_data = new uint8_t[1];
 
-    if (cmd < percentReads) {
+    if (do_cmo) {
+        req->setFlags(Request::CLEAN | Request::DST_POC);
+        if (rng->random(0, 1))
+            req->setFlags(Request::INVALIDATE);
+
+        DPRINTF(MemTest,
+                "Initiating clean%s at addr %x (blk %x)\n",
+                req->isCacheInvalidate() ? " and invalidate" : "",
+                req->getPaddr(), blockAlign(req->getPaddr()));
+
+        pkt = new Packet(req, req->isCacheInvalidate() ?
+                         MemCmd::CleanInvalidReq : MemCmd::CleanSharedReq);
+        pkt->dataDynamic(pkt_data);
+    } else if (cmd < percentReads) {
         // start by ensuring there is a reference value if we have not
         // seen this address before
         [[maybe_unused]] uint8_t ref_data = 0;
@@ -55,6 +55,8 @@
 namespace gem5
 {
 
+class System;
+
 /**
  * The MemTest class tests a cache coherent memory system by
  * generating false sharing and verifying the read data against a
@@ -133,6 +135,9 @@ class MemTest : public ClockedObject
     const unsigned percentFunctional;
     const unsigned percentUncacheable;
     const unsigned percentAtomic;
+    const unsigned percentCmos;
+
+    System *const system;
 
     /** Request id for all generated traffic */
     RequestorID requestorId;
@@ -185,6 +190,7 @@ class MemTest : public ClockedObject
         statistics::Scalar numReads;
         statistics::Scalar numWrites;
         statistics::Scalar numAtomics;
+        statistics::Scalar numCmos;
     } stats;
 
     /**
@@ -0,0 +1,70 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.objects.ClockedObject import ClockedObject
+from m5.params import *
+
+# CXLMemDevice models the link and protocol front end of a CXL.mem
+# type-3 memory expander. The device-side memory controller, e.g. a
+# MemCtrl with a DRAM interface covering the same range, is connected
+# to the mem_side_port.
+
+
+class CXLMemDevice(ClockedObject):
+    type = "CXLMemDevice"
+    cxx_header = "mem/cxl_mem_device.hh"
+    cxx_class = "gem5::CXLMemDevice"
+
+    mem_side_port = RequestPort(
+        "This port sends requests to the device-side memory controller"
+    )
+    cpu_side_port = ResponsePort(
+        "This port receives requests from the host and sends responses"
+    )
+
+    range = Param.AddrRange("Host-managed device memory range")
+
+    req_size = Param.Unsigned(32, "The number of requests to buffer")
+    resp_size = Param.Unsigned(32, "The number of responses to buffer")
+
+    # The default link is a x16 PCIe 5.0 link with 68B flits, each with
+    # four 16B slots, a 2B CRC and a 2B protocol ID
+    num_lanes = Param.Unsigned(16, "Number of lanes of the link")
+    lane_speed = Param.UInt64(32, "Speed of each lane (Gb/s)")
+    slot_size = Param.Unsigned(16, "Size of a header or data slot (bytes)")
+    slots_per_flit = Param.Unsigned(4, "Number of slots in a flit")
+    flit_overhead = Param.Unsigned(
+        4, "CRC and protocol ID bytes of a flit"
+    )
+
+    # The latency of a message once its last flit is sent, in each
+    # direction of the link
+    link_latency = Param.Latency(
+        "10ns", "PHY, retimer and flight latency of the link"
+    )
+    protocol_latency = Param.Latency(
+        "25ns", "Link and transaction layer latency of the host and device"
+    )
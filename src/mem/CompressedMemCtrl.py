@@ -0,0 +1,59 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.objects.Compressors import BDI
+from m5.objects.MemCtrl import *
+from m5.params import *
+from m5.proxy import *
+
+
+# CompressedMemCtrl keeps the lines of its dram compressed, in the style
+# of LCP and Compresso, and only transfers the bursts that hold the
+# compressed data of a line. The compressed size of each line is kept in
+# metadata blocks at the top of the dram, which the controller caches.
+# The metadata region is not part of the address range the controller
+# serves, so the dram range can not be interleaved. Compressors that
+# need a parent cache, such as FrequentValues, are not supported.
+class CompressedMemCtrl(MemCtrl):
+    type = "CompressedMemCtrl"
+    cxx_header = "mem/compressed_mem_ctrl.hh"
+    cxx_class = "gem5::memory::CompressedMemCtrl"
+
+    compressor = Param.BaseCacheCompressor(
+        BDI(), "Compressor applied to the lines"
+    )
+    line_size = Param.Unsigned(
+        Parent.cache_line_size, "Size of a compressed line in bytes"
+    )
+    metadata_bits_per_line = Param.Unsigned(
+        4, "Size of the metadata of a line in bits"
+    )
+    metadata_cache_size = Param.MemorySize(
+        "32KiB", "Capacity of the metadata cache"
+    )
+    metadata_cache_assoc = Param.Unsigned(
+        8, "Associativity of the metadata cache"
+    )
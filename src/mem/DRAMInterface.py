@@ -70,6 +70,14 @@ class DRAMInterface(MemInterface):
     # performance being lower when enabled
     enable_dram_powerdown = Param.Bool(False, "Enable powerdown states")
 
+    # Refresh ranks that have nothing queued without scheduling any
+    # events, and account for the refreshes when the rank is next used
+    # or the stats are dumped. This only applies when the powerdown
+    # states are disabled, since idle ranks otherwise self-refresh.
+    lazy_idle_refresh = Param.Bool(
+        False, "Refresh idle ranks without events"
+    )
+
     # For power modelling we need to know if the DRAM has a DLL or not
     dll = Param.Bool(True, "DRAM has DLL or not")
 
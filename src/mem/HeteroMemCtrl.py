@@ -43,6 +43,14 @@ from m5.params import *
 from m5.proxy import *
 
 
+# Organisation of the dram when used as a cache of the nvm. An alloy
+# cache is direct mapped and keeps each tag with its line in the dram,
+# so every access reads the line to check the tag. A set-associative
+# cache keeps its tags in SRAM, so only the data goes to the dram.
+class DRAMCacheOrg(Enum):
+    vals = ["uncached", "alloy", "set_assoc"]
+
+
 # HeteroMemCtrl controls a dram and an nvm interface
 # Both memory interfaces share the data and command bus
 class HeteroMemCtrl(MemCtrl):
@@ -54,3 +62,25 @@ class HeteroMemCtrl(MemCtrl):
     # The dram interface `dram` used by HeteroMemCtrl is defined in
     # the MemCtrl
     nvm = Param.NVMInterface("NVM memory interface to use")
+
+    # By default the dram and nvm have their own address ranges. When
+    # the dram caches the nvm, only the nvm range is exposed, and the
+    # size of the dram range sets the capacity of the cache, so the
+    # dram should then not be in the address map
+    dram_cache_org = Param.DRAMCacheOrg(
+        "uncached", "Organisation of the dram as a cache of the nvm"
+    )
+    dram_cache_assoc = Param.Unsigned(
+        8, "Associativity of the set-associative dram cache"
+    )
+    dram_cache_tag_latency = Param.Latency(
+        "2ns", "SRAM tag lookup latency of the set-associative dram cache"
+    )
+    dram_cache_write_allocate = Param.Bool(
+        True, "Allocate lines in the dram cache on write misses"
+    )
+    dram_cache_write_back = Param.Bool(
+        True,
+        "Write dirty lines back to the nvm on eviction, rather than "
+        "writing through to the nvm",
+    )
@@ -0,0 +1,51 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.objects.MemCtrl import *
+from m5.params import *
+from m5.proxy import *
+
+
+# MultiChannelMemCtrl serves several independent DRAM channels from a
+# single controller, with shared queues and a single scheduling loop,
+# rather than one MemCtrl per channel behind an interleaving crossbar
+class MultiChannelMemCtrl(MemCtrl):
+    type = "MultiChannelMemCtrl"
+    cxx_header = "mem/multi_channel_mem_ctrl.hh"
+    cxx_class = "gem5::memory::MultiChannelMemCtrl"
+
+    # The channels are selected by their, typically interleaved,
+    # address ranges. The first channel is also the controller's
+    # `dram` interface
+    channels = VectorParam.DRAMInterface("DRAM interfaces, one per channel")
+    dram = Self.channels[0]
+
+    # When a channel is forced to switch to writes, also switch the
+    # other channels that are above the low write threshold, so that
+    # the channels drain their writes together
+    coordinated_write_drain = Param.Bool(
+        False, "Drain writes in all channels together"
+    )
@@ -0,0 +1,53 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.objects.AddrMapper import AddrMapper
+from m5.params import *
+
+
+class TieredMemoryManager(AddrMapper):
+    """
+    Moves the hot pages of a slow memory tier to a fast one, swapping
+    them with cold pages of the fast tier at the end of every epoch.
+    """
+
+    type = "TieredMemoryManager"
+    cxx_header = "mem/tiered_memory_manager.hh"
+    cxx_class = "gem5::TieredMemoryManager"
+
+    fast_range = Param.AddrRange("Address range of the fast tier")
+    slow_range = Param.AddrRange("Address range of the slow tier")
+
+    page_size = Param.MemorySize("4KiB", "Granularity of the migrations")
+    epoch = Param.Latency("100us", "Time between migration decisions")
+    sample_interval = Param.Unsigned(1, "Count every n-th access")
+    promotion_threshold = Param.Unsigned(
+        8, "Sampled accesses in an epoch to promote a page"
+    )
+    max_migrations = Param.Unsigned(16, "Maximum promotions per epoch")
+    copy_bandwidth = Param.MemoryBandwidth(
+        "10GiB/s", "Bandwidth of the copies between the tiers"
+    )
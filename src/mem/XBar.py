@@ -100,6 +100,15 @@ class BaseXBar(ClockedObject):
         False, "Perform address mapping for the default port"
     )
 
+    # Release layers lazily, based on when they were last occupied
+    # until, rather than with an event per transfer, and carry the
+    # route back to the requestor in the packet sender state rather
+    # than in the routing table. Layer release events are then only
+    # scheduled when a port is waiting for a retry.
+    fast_path = Param.Bool(
+        False, "Release idle layers lazily and route responses via the packet"
+    )
+
 
 class NoncoherentXBar(BaseXBar):
     type = "NoncoherentXBar"
@@ -151,9 +160,17 @@ class SnoopFilter(SimObject):
 
     system = Param.System(Parent.any, "System that the crossbar belongs to.")
 
-    # Sanity check on max capacity to track, adjust if needed.
+    # Sanity check on max capacity to track, adjust if needed. With a
+    # non-zero associativity this is the modelled capacity instead.
     max_capacity = Param.MemorySize("8MiB", "Maximum capacity of snoop filter")
 
+    # Associativity of a capacity-limited snoop filter. Lines evicted
+    # from a full set are back-invalidated in the caches above. The
+    # default of 0 keeps the filter unbounded.
+    assoc = Param.Unsigned(
+        0, "Associativity of the snoop filter, 0 for an unbounded filter"
+    )
+
 
 # We use a coherent crossbar to connect multiple requestors to the L2
 # caches. Normally this crossbar would be part of the cache itself.
@@ -242,15 +242,16 @@ class AddrMapper : public SimObject
     void recvMemBackdoorReq(const MemBackdoorReq &req,
                             MemBackdoorPtr &backdoor);
 
-    Tick recvAtomic(PacketPtr pkt);
+    virtual Tick recvAtomic(PacketPtr pkt);
 
     Tick recvAtomicSnoop(PacketPtr pkt);
 
-    Tick recvAtomicBackdoor(PacketPtr pkt, MemBackdoorPtr& backdoor);
+    virtual Tick recvAtomicBackdoor(PacketPtr pkt,
+                                    MemBackdoorPtr& backdoor);
 
-    bool recvTimingReq(PacketPtr pkt);
+    virtual bool recvTimingReq(PacketPtr pkt);
 
-    bool recvTimingResp(PacketPtr pkt);
+    virtual bool recvTimingResp(PacketPtr pkt);
 
     void recvTimingSnoopReq(PacketPtr pkt);
 
@@ -114,6 +114,9 @@ class BaseCache(ClockedObject):
     partitioning_manager = Param.PartitionManager(
         NULL, "Cache partitioning manager"
     )
+    utility_monitor = Param.UtilityMonitor(
+        NULL, "Monitor of the occupancy and utility of the partitions"
+    )
 
     compressor = Param.BaseCacheCompressor(NULL, "Cache compressor.")
     replace_expansions = Param.Bool(
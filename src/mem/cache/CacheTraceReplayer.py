@@ -0,0 +1,91 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.objects.Prefetcher import BasePrefetcher
+from m5.objects.ReplacementPolicies import *
+from m5.objects.Tags import *
+from m5.params import *
+from m5.proxy import *
+from m5.SimObject import *
+
+
+class TraceCacheModel(SimObject):
+    """A functional model of a cache, made of its tags, replacement
+    policy and prefetcher, to be driven by a CacheTraceReplayer. The
+    parameters the tags take from their cache are provided here."""
+
+    type = "TraceCacheModel"
+    cxx_class = "gem5::TraceCacheModel"
+    cxx_header = "mem/cache/cache_trace_replayer.hh"
+
+    system = Param.System(Parent.any, "System the model belongs to")
+
+    size = Param.MemorySize("Capacity")
+    assoc = Param.Int("Associativity")
+
+    tag_latency = Param.Cycles(1, "Tag lookup latency")
+    warmup_percentage = Param.Percent(
+        0, "Percentage of tags to be touched to warm up the cache"
+    )
+    sequential_access = Param.Bool(
+        False, "Whether to access tags and data sequentially"
+    )
+
+    replacement_policy = Param.BaseReplacementPolicy(
+        LRURP(), "Replacement policy"
+    )
+    partitioning_manager = Param.PartitionManager(
+        NULL, "Cache partitioning manager"
+    )
+    tags = Param.BaseTags(BaseSetAssoc(), "Tag store")
+
+    prefetcher = Param.BasePrefetcher(NULL, "Prefetcher")
+    prefetches_per_access = Param.Unsigned(
+        1, "Prefetches taken from the prefetcher after each access"
+    )
+
+
+class CacheTraceReplayer(SimObject):
+    """Replays a packet trace (proto/packet.proto) through one or more
+    cache models without a timing simulation. Call replay() after
+    m5.instantiate() and dump the statistics to obtain the hit rate,
+    prefetch accuracy and coverage, and the host replay rate of every
+    model. Models are replayed in parallel."""
+
+    type = "CacheTraceReplayer"
+    cxx_class = "gem5::CacheTraceReplayer"
+    cxx_header = "mem/cache/cache_trace_replayer.hh"
+
+    cxx_exports = [PyBindMethod("replay")]
+
+    models = VectorParam.TraceCacheModel("Cache models under test")
+    trace_file = Param.String("Packet trace to replay")
+    max_accesses = Param.UInt64(
+        0, "Stop after this many accesses (0 replays the whole trace)"
+    )
+    replay_threads = Param.Unsigned(
+        0, "Host threads used for replay (0 uses one per host core)"
+    )
@@ -0,0 +1,57 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.objects.ClockedObject import ClockedObject
+from m5.params import *
+from m5.proxy import *
+
+
+class VictimCache(ClockedObject):
+    """A small fully-associative victim cache, to be placed between a
+    private L1 cache and the next level. It captures the lines written
+    back by the L1 and returns them on a later L1 miss, exchanging the
+    line with the L1. Only writebacks carry data, so clean lines are
+    only captured if the L1 has writeback_clean set. Requests it cannot
+    serve are passed on unchanged, and it takes part in coherence for
+    the lines it holds, so it must sit directly below a single cache."""
+
+    type = "VictimCache"
+    cxx_class = "gem5::VictimCache"
+    cxx_header = "mem/cache/victim_cache.hh"
+
+    system = Param.System(Parent.any, "System we belong to")
+
+    size = Param.MemorySize("4KiB", "Capacity")
+
+    hit_latency = Param.Cycles(
+        2, "Latency of an L1 miss serviced by the victim cache"
+    )
+    forward_latency = Param.Cycles(
+        0, "Latency added to responses and snoop responses passed through"
+    )
+
+    cpu_side = ResponsePort("Upstream port, towards the L1 cache")
+    mem_side = RequestPort("Downstream port, towards the next level")
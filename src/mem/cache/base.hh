@@ -87,6 +87,7 @@ namespace prefetch
 namespace partitioning_policy
 {
     class PartitionManager;
+    class UtilityMonitor;
 }
 class MSHR;
 class RequestPort;
@@ -358,6 +359,9 @@ class BaseCache : public ClockedObject
     /** Partitioning manager */
     partitioning_policy::PartitionManager* partitionManager;
 
+    /** Monitor of the occupancy and utility of the partitions */
+    partitioning_policy::UtilityMonitor* utilityMonitor;
+
     /** Prefetcher */
     prefetch::Base *prefetcher;
 
@@ -990,6 +990,38 @@ Cache::cleanEvictBlk(CacheBlk *blk)
     return pkt;
 }
 
+PacketPtr
+Cache::writecleanWriteback(PacketPtr wb_pkt, Request::Flags dest,
+                           PacketId id)
+{
+    assert(wb_pkt->cmd == MemCmd::WritebackDirty);
+
+    RequestPtr req = std::make_shared<Request>(
+        wb_pkt->getAddr(), blkSize, 0, Request::wbRequestorId);
+
+    if (wb_pkt->isSecure())
+        req->setFlags(Request::SECURE);
+
+    req->taskId(wb_pkt->req->taskId());
+
+    PacketPtr pkt = new Packet(req, MemCmd::WriteClean, blkSize, id);
+
+    if (dest) {
+        req->setFlags(dest);
+        pkt->setWriteThrough();
+    }
+
+    // an Owned line is passed on with sharers, as for a block
+    if (wb_pkt->hasSharers())
+        pkt->setHasSharers();
+
+    pkt->allocate();
+    pkt->setData(wb_pkt->getConstPtr<uint8_t>());
+    DPRINTF(Cache, "Create %s from %s\n", pkt->print(), wb_pkt->print());
+
+    return pkt;
+}
+
 /////////////////////////////////////////////////////
 //
 // Snoop path: requests coming in from the memory side
@@ -1332,8 +1364,11 @@ Cache::recvTimingSnoopReq(PacketPtr pkt)
         // the difference being that instead of querying the block
         // state to determine if it is dirty and writable, we use the
         // command and fields of the writeback packet
+        // as for blocks, we do not respond to cache maintenance
+        // operations, the dirty data is written below with a
+        // WriteClean instead
         bool respond = wb_pkt->cmd == MemCmd::WritebackDirty &&
-            pkt->needsResponse();
+            pkt->needsResponse() && !pkt->isClean();
         bool have_writable = !wb_pkt->hasSharers();
         bool invalidate = pkt->isInvalidate();
 
@@ -1354,6 +1389,22 @@ Cache::recvTimingSnoopReq(PacketPtr pkt)
                                    false, false);
         }
 
+        if (pkt->isClean() && wb_pkt->cmd == MemCmd::WritebackDirty) {
+            // as in handleSnoop, the WriteClean carries the id of the
+            // cache maintenance operation, so that its destination
+            // only completes the operation once the data has arrived,
+            // and the queued writeback is left with a clean copy so
+            // that the dirty data is only written once
+            PacketList writebacks;
+            writebacks.push_back(
+                writecleanWriteback(wb_pkt, pkt->req->getDest(), pkt->id));
+            wb_pkt->cmd = MemCmd::WritebackClean;
+            Tick forward_time = clockEdge(forwardLatency) +
+                pkt->headerDelay;
+            doWritebacks(writebacks, forward_time);
+            pkt->setSatisfied();
+        }
+
         if (invalidate && wb_pkt->cmd != MemCmd::WriteClean) {
             // Invalidation trumps our writeback... discard here
             // Note: markInService will remove entry from writeback buffer.
@@ -147,6 +147,19 @@ class Cache : public BaseCache
      */
     PacketPtr cleanEvictBlk(CacheBlk *blk);
 
+    /**
+     * Create a WriteClean request for the data of a dirty writeback
+     * waiting in the write buffer, the same way writecleanBlk does for
+     * a dirty block.
+     *
+     * @param wb_pkt The WritebackDirty in the write buffer.
+     * @param dest The destination of the cache maintenance operation.
+     * @param id The id of the cache maintenance operation.
+     * @return The WriteClean request for the data.
+     */
+    PacketPtr writecleanWriteback(PacketPtr wb_pkt, Request::Flags dest,
+                                  PacketId id);
+
     PacketPtr createMissPacket(PacketPtr cpu_pkt, CacheBlk *blk,
                                bool needs_writable,
                                bool is_whole_line_write) const override;
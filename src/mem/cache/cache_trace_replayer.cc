@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/cache_trace_replayer.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "base/logging.hh"
+#include "mem/cache/cache_blk.hh"
+#include "mem/cache/prefetch/base.hh"
+#include "mem/cache/tags/base.hh"
+#include "proto/packet.pb.h"
+#include "proto/protoio.hh"
+#include "sim/cur_tick.hh"
+#include "sim/eventq.hh"
+#include "sim/system.hh"
+
+namespace gem5
+{
+
+bool
+TraceCacheModel::TraceAccessor::inCache(Addr addr, bool is_secure) const
+{
+    return model.tags->findBlock({addr, is_secure});
+}
+
+bool
+TraceCacheModel::TraceAccessor::hasBeenPrefetched(Addr addr,
+                                                  bool is_secure) const
+{
+    CacheBlk *blk = model.tags->findBlock({addr, is_secure});
+    return blk && blk->wasPrefetched();
+}
+
+bool
+TraceCacheModel::TraceAccessor::hasBeenPrefetched(Addr addr, bool is_secure,
+                                                  RequestorID requestor) const
+{
+    CacheBlk *blk = model.tags->findBlock({addr, is_secure});
+    return blk && blk->wasPrefetched() &&
+           blk->getSrcRequestorId() == requestor;
+}
+
+TraceCacheModel::TraceCacheModel(const Params &p)
+    : SimObject(p),
+      tags(p.tags),
+      prefetcher(p.prefetcher),
+      blkSize(p.system->cacheLineSize()),
+      prefetchesPerAccess(p.prefetches_per_access),
+      requestorId(p.system->getRequestorId(this)),
+      accessor(*this),
+      stats(*this)
+{
+    tags->tagsInit();
+
+    // stand in for the cache, but without probe points, as accesses
+    // are fed to the prefetcher directly
+    if (prefetcher)
+        prefetcher->setParentInfo(p.system, nullptr, blkSize);
+}
+
+CacheBlk *
+TraceCacheModel::allocateBlock(const PacketPtr pkt)
+{
+    std::vector<CacheBlk*> evict_blks;
+    CacheBlk *victim = tags->findVictim({pkt->getAddr(), pkt->isSecure()},
+                                        blkSize * 8, evict_blks);
+    if (!victim)
+        return nullptr;
+
+    for (CacheBlk *blk : evict_blks) {
+        if (!blk->isValid())
+            continue;
+
+        if (blk->wasPrefetched()) {
+            ++stats.unusedPrefetches;
+            if (prefetcher)
+                prefetcher->prefetchUnused();
+        }
+        tags->invalidate(blk);
+    }
+
+    tags->insertBlock(pkt, victim);
+    victim->setCoherenceBits(CacheBlk::ReadableBit);
+
+    if (prefetcher)
+        prefetcher->notifyFill(CacheAccessProbeArg(pkt, accessor));
+
+    return victim;
+}
+
+void
+TraceCacheModel::access(const TraceRecord &rec, std::vector<uint8_t> &data)
+{
+    RequestPtr req;
+    if (rec.pc) {
+        req = std::make_shared<Request>(rec.addr, rec.size, rec.flags,
+                                        requestorId, rec.pc, 0);
+        req->setPaddr(rec.addr);
+    } else {
+        req = std::make_shared<Request>(rec.addr, rec.size, rec.flags,
+                                        requestorId);
+    }
+
+    Packet pkt(req, rec.write ? MemCmd::WriteReq : MemCmd::ReadReq);
+    if (rec.write) {
+        if (data.size() < rec.size)
+            data.resize(rec.size);
+        pkt.dataStatic(data.data());
+    }
+
+    ++stats.accesses;
+
+    Cycles lat;
+    CacheBlk *blk = tags->accessBlock(&pkt, lat);
+    if (blk) {
+        ++stats.hits;
+
+        // notify before the prefetched bit is cleared, so that the
+        // prefetcher sees its useful prefetches
+        if (prefetcher)
+            prefetcher->probeNotify(CacheAccessProbeArg(&pkt, accessor),
+                                    false);
+
+        if (blk->wasPrefetched()) {
+            ++stats.usefulPrefetches;
+            blk->clearPrefetched();
+        }
+    } else {
+        ++stats.misses;
+
+        if (prefetcher)
+            prefetcher->probeNotify(CacheAccessProbeArg(&pkt, accessor),
+                                    true);
+
+        allocateBlock(&pkt);
+    }
+}
+
+void
+TraceCacheModel::issuePrefetches()
+{
+    for (unsigned i = 0; i < prefetchesPerAccess; ++i) {
+        PacketPtr pf = prefetcher->getPacket();
+        if (!pf)
+            break;
+
+        if (tags->findBlock({pf->getAddr(), pf->isSecure()})) {
+            ++stats.prefetchesInCache;
+            prefetcher->pfHitInCache();
+        } else if (CacheBlk *blk = allocateBlock(pf)) {
+            ++stats.prefetches;
+            blk->setPrefetched();
+        }
+
+        delete pf;
+    }
+}
+
+void
+TraceCacheModel::replay(const Trace &trace)
+{
+    std::vector<uint8_t> data;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (const auto &rec : trace) {
+        // keep time moving forward, for the replacement policies
+        curEventQueue()->setCurTick(std::max(curTick() + 1, rec.tick));
+
+        access(rec, data);
+        if (prefetcher)
+            issuePrefetches();
+    }
+
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    stats.hostSeconds += elapsed.count();
+}
+
+TraceCacheModel::ModelStats::ModelStats(TraceCacheModel &model)
+    : statistics::Group(&model),
+      ADD_STAT(accesses, statistics::units::Count::get(),
+               "Number of accesses replayed"),
+      ADD_STAT(hits, statistics::units::Count::get(),
+               "Number of accesses that hit"),
+      ADD_STAT(misses, statistics::units::Count::get(),
+               "Number of accesses that missed"),
+      ADD_STAT(hitRate, statistics::units::Ratio::get(),
+               "Fraction of the accesses that hit", hits / accesses),
+      ADD_STAT(prefetches, statistics::units::Count::get(),
+               "Number of prefetches filled"),
+      ADD_STAT(prefetchesInCache, statistics::units::Count::get(),
+               "Number of prefetches dropped as already in the cache"),
+      ADD_STAT(usefulPrefetches, statistics::units::Count::get(),
+               "Number of prefetched blocks accessed"),
+      ADD_STAT(unusedPrefetches, statistics::units::Count::get(),
+               "Number of prefetched blocks evicted without an access"),
+      ADD_STAT(accuracy, statistics::units::Ratio::get(),
+               "Fraction of the filled prefetches that were accessed",
+               usefulPrefetches / prefetches),
+      ADD_STAT(coverage, statistics::units::Ratio::get(),
+               "Fraction of the misses avoided by prefetching",
+               usefulPrefetches / (usefulPrefetches + misses)),
+      ADD_STAT(hostSeconds, statistics::units::Second::get(),
+               "Host time spent replaying the trace"),
+      ADD_STAT(accessRate, statistics::units::Rate<
+                statistics::units::Count, statistics::units::Second>::get(),
+               "Accesses replayed per host second",
+               accesses / hostSeconds)
+{
+    accessRate.precision(0);
+}
+
+CacheTraceReplayer::CacheTraceReplayer(const Params &p)
+    : SimObject(p),
+      models(p.models),
+      traceFile(p.trace_file),
+      maxAccesses(p.max_accesses),
+      replayThreads(p.replay_threads)
+{
+    fatal_if(models.empty(), "%s: at least one cache model is required\n",
+             name());
+}
+
+void
+CacheTraceReplayer::loadTrace(TraceCacheModel::Trace &trace) const
+{
+    ProtoInputStream input(traceFile);
+
+    ProtoMessage::PacketHeader header;
+    fatal_if(!input.read(header), "%s: failed to read packet trace header "
+             "from %s\n", name(), traceFile);
+    inform("%s: loading packet trace '%s' recorded by %s\n", name(),
+           traceFile, header.obj_id());
+
+    ProtoMessage::Packet msg;
+    while ((!maxAccesses || trace.size() < maxAccesses) && input.read(msg)) {
+        const MemCmd cmd(msg.cmd());
+        if (!cmd.isRead() && !cmd.isWrite())
+            continue;
+
+        trace.push_back({msg.tick(), msg.addr(), msg.has_pc() ? msg.pc() : 0,
+                         msg.has_flags() ? msg.flags() : 0, msg.size(),
+                         cmd.isWrite()});
+    }
+}
+
+uint64_t
+CacheTraceReplayer::replay()
+{
+    TraceCacheModel::Trace trace;
+    loadTrace(trace);
+
+    unsigned workers = replayThreads ? replayThreads :
+                       std::max(1U, std::thread::hardware_concurrency());
+    workers = std::min<size_t>(workers, models.size());
+
+    inform("%s: replaying %d accesses through %d model(s) on %d host "
+           "thread(s)\n", name(), trace.size(), models.size(), workers);
+
+    std::atomic<size_t> next(0);
+    auto worker = [&]() {
+        // every host thread keeps its own time, as the models advance
+        // it to the tick of each access
+        EventQueue queue(name() + ".replay");
+        curEventQueue(&queue);
+
+        for (size_t i = next++; i < models.size(); i = next++) {
+            queue.setCurTick(0);
+            models[i]->replay(trace);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned i = 0; i < workers; ++i)
+        pool.emplace_back(worker);
+    for (auto &thread : pool)
+        thread.join();
+
+    return trace.size();
+}
+
+} // namespace gem5
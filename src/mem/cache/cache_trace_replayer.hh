@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Trace-driven evaluation of cache configurations. Replays a memory
+ * trace through models made of the tags, replacement policy and
+ * prefetcher of a cache, without the timing of the cache, so that hit
+ * rates and prefetcher accuracy and coverage can be obtained quickly.
+ */
+
+#ifndef __MEM_CACHE_CACHE_TRACE_REPLAYER_HH__
+#define __MEM_CACHE_CACHE_TRACE_REPLAYER_HH__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "mem/cache/cache_probe_arg.hh"
+#include "mem/packet.hh"
+#include "mem/request.hh"
+#include "params/CacheTraceReplayer.hh"
+#include "params/TraceCacheModel.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+class BaseTags;
+class CacheBlk;
+
+namespace prefetch
+{
+class Base;
+} // namespace prefetch
+
+/**
+ * A functional model of a cache, made of its tags, with their
+ * replacement policy, and of its prefetcher. Every access allocates on
+ * a miss, and prefetches are filled as soon as they are taken from the
+ * prefetcher, a configurable number after each access.
+ */
+class TraceCacheModel : public SimObject
+{
+  public:
+    PARAMS(TraceCacheModel);
+    TraceCacheModel(const Params &p);
+
+    /** Compact in-memory form of one traced access. */
+    struct TraceRecord
+    {
+        Tick tick;
+        Addr addr;
+        Addr pc;
+        Request::FlagsType flags;
+        uint32_t size;
+        bool write;
+    };
+
+    typedef std::vector<TraceRecord> Trace;
+
+    /**
+     * Replay a trace through the model. Models share no state, so
+     * different models can be replayed on different host threads. The
+     * calling thread must have its own event queue, as the time of the
+     * model is advanced to the tick of each access.
+     */
+    void replay(const Trace &trace);
+
+  private:
+    class TraceAccessor : public CacheAccessor
+    {
+      public:
+        TraceAccessor(const TraceCacheModel &_model) : model(_model) {}
+
+        bool inCache(Addr addr, bool is_secure) const override;
+
+        bool hasBeenPrefetched(Addr addr, bool is_secure) const override;
+
+        bool hasBeenPrefetched(Addr addr, bool is_secure,
+                               RequestorID requestor) const override;
+
+        bool
+        inMissQueue(Addr addr, bool is_secure) const override
+        {
+            return false;
+        }
+
+        bool coalesce() const override { return false; }
+
+      private:
+        const TraceCacheModel &model;
+    };
+
+    /** Look up and fill the tags for one access. */
+    void access(const TraceRecord &rec, std::vector<uint8_t> &data);
+
+    /**
+     * Allocate a block for a packet, evicting the victims.
+     *
+     * @return The new block.
+     */
+    CacheBlk *allocateBlock(const PacketPtr pkt);
+
+    /** Fill the prefetches the prefetcher has ready. */
+    void issuePrefetches();
+
+    BaseTags *tags;
+
+    prefetch::Base *prefetcher;
+
+    const unsigned blkSize;
+
+    /** Prefetches taken from the prefetcher after each access */
+    const unsigned prefetchesPerAccess;
+
+    const RequestorID requestorId;
+
+    TraceAccessor accessor;
+
+    struct ModelStats : public statistics::Group
+    {
+        ModelStats(TraceCacheModel &model);
+
+        statistics::Scalar accesses;
+        statistics::Scalar hits;
+        statistics::Scalar misses;
+        statistics::Formula hitRate;
+
+        statistics::Scalar prefetches;
+        statistics::Scalar prefetchesInCache;
+        statistics::Scalar usefulPrefetches;
+        statistics::Scalar unusedPrefetches;
+        statistics::Formula accuracy;
+        statistics::Formula coverage;
+
+        statistics::Scalar hostSeconds;
+        statistics::Formula accessRate;
+    } stats;
+};
+
+/**
+ * Replays a packet trace (proto/packet.proto), as written by a
+ * CommMonitor's MemTraceProbe, through a set of cache models. The
+ * trace is decoded once into memory and then replayed through every
+ * model, on a pool of host threads.
+ */
+class CacheTraceReplayer : public SimObject
+{
+  public:
+    PARAMS(CacheTraceReplayer);
+    CacheTraceReplayer(const Params &p);
+
+    /**
+     * Replay the trace through all models. Exported to Python so that
+     * configuration scripts can call it after m5.instantiate().
+     *
+     * @return The number of accesses replayed per model.
+     */
+    uint64_t replay();
+
+  private:
+    /** Decode the packet trace. */
+    void loadTrace(TraceCacheModel::Trace &trace) const;
+
+    const std::vector<TraceCacheModel *> models;
+
+    const std::string traceFile;
+
+    /** Stop after this many accesses, 0 replays the whole trace */
+    const uint64_t maxAccesses;
+
+    /** Host threads, 0 uses one per host core */
+    const unsigned replayThreads;
+};
+
+} // namespace gem5
+
+#endif // __MEM_CACHE_CACHE_TRACE_REPLAYER_HH__
@@ -64,6 +64,13 @@ class BaseCacheCompressor(SimObject):
         "to finish decompression (e.g., due to shifting and packaging).",
     )
 
+    memo_entries = Param.Unsigned(
+        0,
+        "Number of entries of the direct-mapped table that memoizes the "
+        "compressed size of recently seen line contents (0 disables it). "
+        "Hits skip the compressor, so its own stats only count misses.",
+    )
+
 
 class BaseDictionaryCompressor(BaseCacheCompressor):
     type = "BaseDictionaryCompressor"
@@ -74,6 +81,11 @@ class BaseDictionaryCompressor(BaseCacheCompressor):
     dictionary_size = Param.Int(
         Parent.cache_line_size, "Number of dictionary entries"
     )
+    vectorized = Param.Bool(
+        True,
+        "Classify lines with flat, allocation-free loops instead of "
+        "building their patterns, when the compressor supports it",
+    )
 
 
 class Base64Delta8(BaseDictionaryCompressor):
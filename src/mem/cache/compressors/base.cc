@@ -36,8 +36,10 @@
 #include <climits>
 #include <cmath>
 #include <cstdint>
+#include <memory>
 #include <string>
 
+#include "base/intmath.hh"
 #include "base/logging.hh"
 #include "base/trace.hh"
 #include "debug/CacheComp.hh"
@@ -88,8 +90,19 @@ Base::Base(const Params &p)
     compExtraLatency(p.comp_extra_latency),
     decompChunksPerCycle(p.decomp_chunks_per_cycle),
     decompExtraLatency(p.decomp_extra_latency),
-    cache(nullptr), stats(*this)
+    cache(nullptr), memo(p.memo_entries),
+    memoIndexBits(p.memo_entries ? floorLog2(p.memo_entries) : 0),
+    stats(*this)
 {
+    fatal_if(!memo.empty() && !isPowerOf2(memo.size()),
+        "The number of memoization entries must be a power of two.");
+    for (auto& entry : memo) {
+        entry.data.resize(blkSize / sizeof(uint64_t));
+    }
+    #ifdef DEBUG_COMPRESSION
+    fatal_if(!memo.empty(), "Memoized compressions cannot be decompressed.");
+    #endif
+
     fatal_if(64 % chunkSizeBits,
         "64 must be a multiple of the chunk granularity.");
 
@@ -146,9 +159,53 @@ Base::fromChunks(const std::vector<Chunk>& chunks, uint64_t* data) const
     }
 }
 
+Base::MemoEntry&
+Base::getMemoEntry(const uint64_t* data)
+{
+    uint64_t hash = 0;
+    for (std::size_t i = 0; i < blkSize / sizeof(uint64_t); i++) {
+        hash = (hash ^ data[i]) * 0x9e3779b97f4a7c15;
+    }
+    return memoIndexBits ? memo[hash >> (64 - memoIndexBits)] : memo[0];
+}
+
+void
+Base::updateStats(std::size_t comp_size_bits, bool failed)
+{
+    if (failed) {
+        stats.failedCompressions++;
+    }
+    stats.compressions++;
+    stats.compressionSizeBits += comp_size_bits;
+    if (comp_size_bits != 0) {
+        stats.compressionSize[1 + std::ceil(std::log2(comp_size_bits))]++;
+    } else {
+        stats.compressionSize[0]++;
+    }
+}
+
 std::unique_ptr<Base::CompressionData>
 Base::compress(const uint64_t* data, Cycles& comp_lat, Cycles& decomp_lat)
 {
+    // If this line has been compressed recently, reuse the outcome
+    MemoEntry* memo_entry = nullptr;
+    if (!memo.empty()) {
+        memo_entry = &getMemoEntry(data);
+        if (memo_entry->valid && std::equal(memo_entry->data.begin(),
+            memo_entry->data.end(), data)) {
+            stats.memoHits++;
+            comp_lat = memo_entry->compLat;
+            decomp_lat = memo_entry->decompLat;
+            updateStats(memo_entry->sizeBits, memo_entry->failed);
+
+            std::unique_ptr<CompressionData> comp_data =
+                std::make_unique<CompressionData>();
+            comp_data->setSizeBits(memo_entry->sizeBits);
+            return comp_data;
+        }
+        stats.memoMisses++;
+    }
+
     // Apply compression
     std::unique_ptr<CompressionData> comp_data =
         compress(toChunks(data), comp_lat, decomp_lat);
@@ -169,19 +226,24 @@ Base::compress(const uint64_t* data, Cycles& comp_lat, Cycles& decomp_lat)
     // Get compression size. If compressed size is greater than the size
     // threshold, the compression is seen as unsuccessful
     std::size_t comp_size_bits = comp_data->getSizeBits();
-    if (comp_size_bits > sizeThreshold * CHAR_BIT) {
+    const bool failed = comp_size_bits > sizeThreshold * CHAR_BIT;
+    if (failed) {
         comp_size_bits = blkSize * CHAR_BIT;
         comp_data->setSizeBits(comp_size_bits);
-        stats.failedCompressions++;
     }
 
     // Update stats
-    stats.compressions++;
-    stats.compressionSizeBits += comp_size_bits;
-    if (comp_size_bits != 0) {
-        stats.compressionSize[1 + std::ceil(std::log2(comp_size_bits))]++;
-    } else {
-        stats.compressionSize[0]++;
+    updateStats(comp_size_bits, failed);
+
+    // Memoize the outcome
+    if (memo_entry) {
+        memo_entry->valid = true;
+        std::copy(data, data + memo_entry->data.size(),
+            memo_entry->data.begin());
+        memo_entry->sizeBits = comp_size_bits;
+        memo_entry->failed = failed;
+        memo_entry->compLat = comp_lat;
+        memo_entry->decompLat = decomp_lat;
     }
 
     // Print debug information
@@ -245,7 +307,11 @@ Base::BaseStats::BaseStats(Base& _compressor)
                 statistics::units::Bit, statistics::units::Count>::get(),
              "Average compression size"),
     ADD_STAT(decompressions, statistics::units::Count::get(),
-             "Total number of decompressions")
+             "Total number of decompressions"),
+    ADD_STAT(memoHits, statistics::units::Count::get(),
+             "Number of compressions served by the memoization table"),
+    ADD_STAT(memoMisses, statistics::units::Count::get(),
+             "Number of compressions that missed in the memoization table")
 {
 }
 
@@ -269,6 +335,9 @@ Base::BaseStats::regStats()
     avgCompressionSizeBits.flags(statistics::total | statistics::nozero |
         statistics::nonan);
     avgCompressionSizeBits = compressionSizeBits / compressions;
+
+    memoHits.flags(statistics::nozero);
+    memoMisses.flags(statistics::nozero);
 }
 
 } // namespace compression
@@ -37,6 +37,7 @@
 #define __MEM_CACHE_COMPRESSORS_BASE_HH__
 
 #include <cstdint>
+#include <vector>
 
 #include "base/compiler.hh"
 #include "base/statistics.hh"
@@ -128,6 +129,30 @@ class Base : public SimObject
     /** Pointer to the parent cache. */
     BaseCache* cache;
 
+    /**
+     * An entry of the memoization table. It holds the contents of a line
+     * and the outcome of its last compression.
+     */
+    struct MemoEntry
+    {
+        bool valid = false;
+        std::vector<uint64_t> data;
+        std::size_t sizeBits = 0;
+        bool failed = false;
+        Cycles compLat;
+        Cycles decompLat;
+    };
+
+    /**
+     * Direct-mapped table, indexed by a hash of the line contents, that
+     * memoizes compressions. Compressors are deterministic functions of
+     * the line contents, so a hit can skip the compression altogether.
+     */
+    std::vector<MemoEntry> memo;
+
+    /** Number of bits used to index the memoization table. */
+    const unsigned memoIndexBits;
+
     struct BaseStats : public statistics::Group
     {
         const Base& compressor;
@@ -153,8 +178,30 @@ class Base : public SimObject
 
         /** Number of decompressions performed. */
         statistics::Scalar decompressions;
+
+        /** Number of compressions served by the memoization table. */
+        statistics::Scalar memoHits;
+
+        /** Number of compressions that missed in the memoization table. */
+        statistics::Scalar memoMisses;
     } stats;
 
+    /**
+     * Get the memoization table entry a line maps to.
+     *
+     * @param data The line.
+     * @return The entry.
+     */
+    MemoEntry& getMemoEntry(const uint64_t* data);
+
+    /**
+     * Account a compression in the stats.
+     *
+     * @param comp_size_bits Size of the compressed line, in bits.
+     * @param failed Whether the line could not be compressed enough.
+     */
+    void updateStats(std::size_t comp_size_bits, bool failed);
+
     /**
      * This function splits the raw data into chunks, so that it can be
      * parsed by the compressor.
@@ -205,6 +252,9 @@ class Base : public SimObject
     /** The cache can only be set once. */
     virtual void setCache(BaseCache *_cache);
 
+    /** Get the size of the uncompressed lines, in bytes. */
+    std::size_t getBlockSize() const { return blkSize; }
+
     /**
      * Apply the compression process to the cache line. Ignores compression
      * cycles.
@@ -37,6 +37,7 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "base/bitfield.hh"
 #include "mem/cache/compressors/dictionary_compressor.hh"
@@ -116,10 +117,19 @@ class BaseDelta : public DictionaryCompressor<BaseType>
         return pattern_names[number];
     }
 
+    /** Size of each pattern, in bits. */
+    std::array<std::size_t, NUM_PATTERNS> patternSizeBits;
+
+    /** Scratch storage for the bases found by the vectorized kernel. */
+    std::vector<BaseType> scanBases;
+
     void resetDictionary() override;
 
     void addToDictionary(DictionaryEntry data) override;
 
+    bool scan(const std::vector<Base::Chunk>& chunks,
+        std::size_t& size_bits) override;
+
     std::unique_ptr<Base::CompressionData> compress(
         const std::vector<Base::Chunk>& chunks,
         Cycles& comp_lat, Cycles& decomp_lat) override;
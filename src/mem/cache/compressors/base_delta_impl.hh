@@ -33,9 +33,12 @@
 #ifndef __MEM_CACHE_COMPRESSORS_BASE_DELTA_IMPL_HH__
 #define __MEM_CACHE_COMPRESSORS_BASE_DELTA_IMPL_HH__
 
+#include <climits>
+
 #include "debug/CacheComp.hh"
 #include "mem/cache/compressors/base_delta.hh"
 #include "mem/cache/compressors/dictionary_compressor_impl.hh"
+#include "mem/cache/compressors/line_scan.hh"
 
 namespace gem5
 {
@@ -45,8 +48,13 @@ namespace compression
 
 template <class BaseType, std::size_t DeltaSizeBits>
 BaseDelta<BaseType, DeltaSizeBits>::BaseDelta(const Params &p)
-    : DictionaryCompressor<BaseType>(p)
+    : DictionaryCompressor<BaseType>(p),
+      scanBases((this->blkSize * CHAR_BIT) / this->chunkSizeBits + 1)
 {
+    const DictionaryEntry zero =
+        DictionaryCompressor<BaseType>::toDictionaryEntry(0);
+    patternSizeBits[X] = PatternX(zero, -1).getSizeBits();
+    patternSizeBits[M] = PatternM(zero, 0).getSizeBits();
 }
 
 template <class BaseType, std::size_t DeltaSizeBits>
@@ -69,6 +77,25 @@ BaseDelta<BaseType, DeltaSizeBits>::addToDictionary(DictionaryEntry data)
         DictionaryCompressor<BaseType>::numEntries++] = data;
 }
 
+template <class BaseType, std::size_t DeltaSizeBits>
+bool
+BaseDelta<BaseType, DeltaSizeBits>::scan(
+    const std::vector<Base::Chunk>& chunks, std::size_t& size_bits)
+{
+    // Every chunk that is not within a delta of a known base becomes a
+    // new base, allocating an entry
+    const std::size_t num_x =
+        line_scan::countDeltaBases<BaseType, DeltaSizeBits>(chunks.data(),
+        chunks.size(), scanBases.data());
+    const std::size_t num_m = chunks.size() - num_x;
+    DictionaryCompressor<BaseType>::numEntries += num_x;
+
+    DictionaryCompressor<BaseType>::dictionaryStats.patterns[X] += num_x;
+    DictionaryCompressor<BaseType>::dictionaryStats.patterns[M] += num_m;
+    size_bits = num_x * patternSizeBits[X] + num_m * patternSizeBits[M];
+    return true;
+}
+
 template <class BaseType, std::size_t DeltaSizeBits>
 std::unique_ptr<Base::CompressionData>
 BaseDelta<BaseType, DeltaSizeBits>::compress(
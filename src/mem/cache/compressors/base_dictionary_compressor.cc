@@ -42,7 +42,7 @@ namespace compression
 
 BaseDictionaryCompressor::BaseDictionaryCompressor(const Params &p)
   : Base(p), dictionarySize(p.dictionary_size),
-    numEntries(0), dictionaryStats(stats, *this)
+    numEntries(0), vectorized(p.vectorized), dictionaryStats(stats, *this)
 {
 }
 
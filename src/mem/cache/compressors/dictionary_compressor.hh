@@ -73,6 +73,13 @@ class BaseDictionaryCompressor : public Base
     /** Number of valid entries in the dictionary. */
     std::size_t numEntries;
 
+    /**
+     * Whether lines are classified with the kernels of line_scan.hh,
+     * instead of building their patterns one by one, when the compressor
+     * provides them.
+     */
+    const bool vectorized;
+
     struct DictionaryStats : public statistics::Group
     {
         const BaseDictionaryCompressor& compressor;
@@ -236,6 +243,22 @@ class DictionaryCompressor : public BaseDictionaryCompressor
     virtual std::unique_ptr<DictionaryCompressor::CompData>
     instantiateDictionaryCompData() const;
 
+    /**
+     * Classify a line without instantiating its patterns. Compressors that
+     * have a vectorized kernel must update the pattern stats and the number
+     * of dictionary entries exactly as the pattern-based path would, and
+     * return the same size.
+     *
+     * @param chunks The cache line to be compressed.
+     * @param size_bits The size of the line's patterns, in bits.
+     * @return Whether the line was classified.
+     */
+    virtual bool
+    scan(const std::vector<Chunk>& chunks, std::size_t& size_bits)
+    {
+        return false;
+    }
+
     /**
      * Apply compression.
      *
@@ -395,6 +418,12 @@ class DictionaryCompressor<T>::CompData : public CompressionData
     /** The patterns matched in the original line. */
     std::vector<std::unique_ptr<Pattern>> entries;
 
+    /**
+     * The original values, when the line was classified by a vectorized
+     * kernel and thus has no patterns.
+     */
+    std::vector<T> values;
+
     CompData();
     ~CompData() = default;
 
@@ -135,8 +135,17 @@ DictionaryCompressor<T>::compress(const std::vector<Chunk>& chunks)
     // Reset dictionary
     resetDictionary();
 
-    // Compress every value sequentially
+    // A vectorized kernel only determines the size of the line, so the
+    // values are kept to be able to decompress it
     CompData* const comp_data_ptr = static_cast<CompData*>(comp_data.get());
+    std::size_t size_bits;
+    if (vectorized && scan(chunks, size_bits)) {
+        comp_data_ptr->values.assign(chunks.begin(), chunks.end());
+        comp_data_ptr->setSizeBits(size_bits);
+        return comp_data;
+    }
+
+    // Compress every value sequentially
     for (const auto& value : chunks) {
         std::unique_ptr<Pattern> pattern = compressValue(value);
         DPRINTF(CacheComp, "Compressed %016x to %s\n", value,
@@ -193,7 +202,7 @@ DictionaryCompressor<T>::decompress(const CompressionData* comp_data,
     resetDictionary();
 
     // Decompress every entry sequentially
-    std::vector<T> decomp_values;
+    std::vector<T> decomp_values = casted_comp_data->values;
     for (const auto& entry : casted_comp_data->entries) {
         const T value = decompressValue(&*entry);
         decomp_values.push_back(value);
@@ -28,7 +28,10 @@
 
 #include "mem/cache/compressors/fpc.hh"
 
+#include <climits>
+
 #include "mem/cache/compressors/dictionary_compressor_impl.hh"
+#include "mem/cache/compressors/line_scan.hh"
 #include "params/FPC.hh"
 
 namespace gem5
@@ -78,8 +81,25 @@ FPC::FPCCompData::addEntry(std::unique_ptr<Pattern> pattern)
 }
 
 FPC::FPC(const Params &p)
-  : DictionaryCompressor<uint32_t>(p), zeroRunSizeBits(p.zero_run_bits)
+  : DictionaryCompressor<uint32_t>(p), zeroRunSizeBits(p.zero_run_bits),
+    scanPatterns((blkSize * CHAR_BIT) / chunkSizeBits)
 {
+    const DictionaryEntry zero = toDictionaryEntry(0);
+    ZeroRun zero_run(zero, -1);
+    zero_run.setRealSize(zeroRunSizeBits);
+    patternSizeBits[ZERO_RUN] = zero_run.getSizeBits();
+    patternSizeBits[SIGN_EXTENDED_4_BITS] =
+        SignExtended4Bits(zero, -1).getSizeBits();
+    patternSizeBits[SIGN_EXTENDED_1_BYTE] =
+        SignExtended1Byte(zero, -1).getSizeBits();
+    patternSizeBits[SIGN_EXTENDED_HALFWORD] =
+        SignExtendedHalfword(zero, -1).getSizeBits();
+    patternSizeBits[ZERO_PADDED_HALFWORD] =
+        ZeroPaddedHalfword(zero, -1).getSizeBits();
+    patternSizeBits[SIGN_EXTENDED_TWO_HALFWORDS] =
+        SignExtendedTwoHalfwords(zero, -1).getSizeBits();
+    patternSizeBits[REP_BYTES] = RepBytes(zero, -1).getSizeBits();
+    patternSizeBits[UNCOMPRESSED] = Uncompressed(zero, -1).getSizeBits();
 }
 
 void
@@ -98,5 +118,39 @@ FPC::instantiateDictionaryCompData() const
         new FPCCompData(zeroRunSizeBits));
 }
 
+bool
+FPC::scan(const std::vector<Chunk>& chunks, std::size_t& size_bits)
+{
+    static_assert((int(line_scan::FPC_ZERO_RUN) == ZERO_RUN) &&
+        (int(line_scan::FPC_SIGN_EXTENDED_4_BITS) == SIGN_EXTENDED_4_BITS) &&
+        (int(line_scan::FPC_SIGN_EXTENDED_1_BYTE) == SIGN_EXTENDED_1_BYTE) &&
+        (int(line_scan::FPC_SIGN_EXTENDED_HALFWORD) ==
+            SIGN_EXTENDED_HALFWORD) &&
+        (int(line_scan::FPC_ZERO_PADDED_HALFWORD) == ZERO_PADDED_HALFWORD) &&
+        (int(line_scan::FPC_SIGN_EXTENDED_TWO_HALFWORDS) ==
+            SIGN_EXTENDED_TWO_HALFWORDS) &&
+        (int(line_scan::FPC_REP_BYTES) == REP_BYTES) &&
+        (int(line_scan::FPC_UNCOMPRESSED) == UNCOMPRESSED),
+        "The kernel's patterns must match FPC's");
+
+    line_scan::fpcPatterns(chunks.data(), chunks.size(),
+        scanPatterns.data());
+    std::array<std::size_t, NUM_PATTERNS> counts = {};
+    for (std::size_t i = 0; i < chunks.size(); i++) {
+        counts[scanPatterns[i]]++;
+    }
+
+    // Only the first zero of each run takes up space
+    size_bits = patternSizeBits[ZERO_RUN] * line_scan::fpcZeroRuns(
+        scanPatterns.data(), chunks.size(), zeroRunSizeBits);
+    for (int i = 0; i < NUM_PATTERNS; i++) {
+        dictionaryStats.patterns[i] += counts[i];
+        if (i != ZERO_RUN) {
+            size_bits += counts[i] * patternSizeBits[i];
+        }
+    }
+    return true;
+}
+
 } // namespace compression
 } // namespace gem5
@@ -35,6 +35,7 @@
 #ifndef __MEM_CACHE_COMPRESSORS_FPC_HH__
 #define __MEM_CACHE_COMPRESSORS_FPC_HH__
 
+#include <array>
 #include <cstdint>
 #include <map>
 #include <memory>
@@ -93,6 +94,15 @@ class FPC : public DictionaryCompressor<uint32_t>
      */
     const int zeroRunSizeBits;
 
+    /**
+     * Size of each pattern, in bits. The size of a zero run is the size of
+     * the first zero of the run.
+     */
+    std::array<std::size_t, NUM_PATTERNS> patternSizeBits;
+
+    /** Scratch storage for the patterns found by the vectorized kernel. */
+    std::vector<uint8_t> scanPatterns;
+
     uint64_t getNumPatterns() const override { return NUM_PATTERNS; }
 
     std::string
@@ -128,6 +138,9 @@ class FPC : public DictionaryCompressor<uint32_t>
     std::unique_ptr<DictionaryCompressor::CompData>
     instantiateDictionaryCompData() const override;
 
+    bool scan(const std::vector<Chunk>& chunks,
+        std::size_t& size_bits) override;
+
   public:
     typedef FPCParams Params;
     FPC(const Params &p);
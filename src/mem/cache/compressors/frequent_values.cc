@@ -58,6 +58,10 @@ FrequentValues::FrequentValues(const Params &p)
 {
     fatal_if((numVFTEntries - 1) > mask(chunkSizeBits),
         "There are more VFT entries than possible values.");
+
+    // The encoding of a line depends on the values seen before it
+    fatal_if(p.memo_entries, "The compressed size of a line is not "
+        "a function of its contents, so it cannot be memoized.");
 }
 
 std::unique_ptr<Base::CompressionData>
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file
+ * Flat, allocation-free kernels that classify the chunks of a cache line
+ * the same way the dictionary compressors' pattern factories do. Every
+ * loop has a fixed trip count and no data-dependent branch, so that the
+ * compiler can turn it into vector code.
+ */
+
+#ifndef __MEM_CACHE_COMPRESSORS_LINE_SCAN_HH__
+#define __MEM_CACHE_COMPRESSORS_LINE_SCAN_HH__
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "base/bitfield.hh"
+
+namespace gem5
+{
+
+namespace compression
+{
+
+namespace line_scan
+{
+
+/**
+ * Count the chunks of a line that are equal to a value.
+ *
+ * @param chunks The chunks of the line.
+ * @param num_chunks Number of chunks.
+ * @param value The value being searched for.
+ * @return The number of chunks equal to value.
+ */
+inline std::size_t
+countEqual(const uint64_t* chunks, std::size_t num_chunks, uint64_t value)
+{
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < num_chunks; i++) {
+        count += (chunks[i] == value);
+    }
+    return count;
+}
+
+/**
+ * Whether the difference between a value and a base fits in a signed
+ * DeltaSizeBits container. Mirrors DeltaPattern::isValidDelta().
+ */
+template <class T, std::size_t DeltaSizeBits>
+inline bool
+isValidDelta(T value, T base)
+{
+    using SignedT = std::make_signed_t<T>;
+    const SignedT limit = DeltaSizeBits ? mask(DeltaSizeBits - 1) : 0;
+    const SignedT delta = static_cast<SignedT>(static_cast<T>(value - base));
+    return (delta >= -limit) & (delta <= limit);
+}
+
+/**
+ * Assign the chunks of a line to bases the way the base-delta compressors
+ * do: a chunk within a delta of any known base (initially only the
+ * implicit zero base) is a delta match, otherwise it becomes a new base.
+ *
+ * @param chunks The chunks of the line.
+ * @param num_chunks Number of chunks.
+ * @param bases Storage for at least num_chunks + 1 bases.
+ * @return The number of new bases, i.e., chunks that did not match.
+ */
+template <class T, std::size_t DeltaSizeBits>
+std::size_t
+countDeltaBases(const uint64_t* chunks, std::size_t num_chunks, T* bases)
+{
+    bases[0] = 0;
+    std::size_t num_bases = 1;
+    for (std::size_t i = 0; i < num_chunks; i++) {
+        const T value = chunks[i];
+        bool match = false;
+        for (std::size_t j = 0; j < num_bases; j++) {
+            match |= isValidDelta<T, DeltaSizeBits>(value, bases[j]);
+        }
+
+        // The slot past the last base is scratch space, so the value can
+        // be written unconditionally
+        bases[num_bases] = value;
+        num_bases += !match;
+    }
+    return num_bases - 1;
+}
+
+/**
+ * The FPC patterns, in the order in which FPC checks them. This must be
+ * kept in sync with FPC::PatternNumber.
+ */
+enum FPCPattern
+{
+    FPC_ZERO_RUN, FPC_SIGN_EXTENDED_4_BITS, FPC_SIGN_EXTENDED_1_BYTE,
+    FPC_SIGN_EXTENDED_HALFWORD, FPC_ZERO_PADDED_HALFWORD,
+    FPC_SIGN_EXTENDED_TWO_HALFWORDS, FPC_REP_BYTES, FPC_UNCOMPRESSED,
+    FPC_NUM_PATTERNS
+};
+
+/**
+ * Get the first FPC pattern a word matches. The patterns are checked in
+ * reverse order so that every check is a select instead of a branch.
+ *
+ * @param data The word.
+ * @return The pattern number.
+ */
+inline uint8_t
+fpcPattern(uint32_t data)
+{
+    const int16_t halfwords[2] = {
+        int16_t(data & mask(16)),
+        int16_t((data >> 16) & mask(16))
+    };
+
+    uint8_t pattern = FPC_UNCOMPRESSED;
+    pattern = (((data & mask(8)) * 0x01010101) == data) ?
+        FPC_REP_BYTES : pattern;
+    pattern = ((halfwords[0] == (uint16_t)szext<8>(halfwords[0])) &
+        (halfwords[1] == (uint16_t)szext<8>(halfwords[1]))) ?
+        FPC_SIGN_EXTENDED_TWO_HALFWORDS : pattern;
+    pattern = ((data & mask(16)) == 0) ? FPC_ZERO_PADDED_HALFWORD : pattern;
+    pattern = (data == (uint32_t)szext<16>(data)) ?
+        FPC_SIGN_EXTENDED_HALFWORD : pattern;
+    pattern = (data == (uint32_t)szext<8>(data)) ?
+        FPC_SIGN_EXTENDED_1_BYTE : pattern;
+    pattern = (data == (uint32_t)szext<4>(data)) ?
+        FPC_SIGN_EXTENDED_4_BITS : pattern;
+    pattern = (data == 0) ? FPC_ZERO_RUN : pattern;
+    return pattern;
+}
+
+/**
+ * Classify every word of a line with fpcPattern().
+ *
+ * @param chunks The chunks of the line; only their 32 LSBs are used.
+ * @param num_chunks Number of chunks.
+ * @param patterns Output with the pattern number of each chunk.
+ */
+inline void
+fpcPatterns(const uint64_t* chunks, std::size_t num_chunks,
+    uint8_t* patterns)
+{
+    for (std::size_t i = 0; i < num_chunks; i++) {
+        patterns[i] = fpcPattern(chunks[i]);
+    }
+}
+
+/**
+ * Count the zero runs of a classified line. Consecutive zero words share
+ * a run until its length field saturates, at which point a new one is
+ * started; only the first word of each run takes up space.
+ *
+ * @param patterns The pattern number of each chunk.
+ * @param num_chunks Number of chunks.
+ * @param run_size_bits Number of bits of the zero run length field.
+ * @return The number of zero runs.
+ */
+inline std::size_t
+fpcZeroRuns(const uint8_t* patterns, std::size_t num_chunks,
+    int run_size_bits)
+{
+    const std::size_t max_run_length = mask(run_size_bits);
+    std::size_t num_runs = 0;
+    std::size_t run_length = 0;
+    bool in_run = false;
+    for (std::size_t i = 0; i < num_chunks; i++) {
+        const bool zero = (patterns[i] == FPC_ZERO_RUN);
+        const bool new_run = zero & (!in_run | (run_length == max_run_length));
+        num_runs += new_run;
+        run_length = new_run ? 0 : run_length + 1;
+        in_run = zero;
+    }
+    return num_runs;
+}
+
+} // namespace line_scan
+} // namespace compression
+} // namespace gem5
+
+#endif //__MEM_CACHE_COMPRESSORS_LINE_SCAN_HH__
@@ -0,0 +1,484 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "base/bitfield.hh"
+#include "base/stats/info.hh"
+#include "mem/cache/compressors/base_delta_impl.hh"
+#include "mem/cache/compressors/dictionary_compressor_impl.hh"
+#include "mem/cache/compressors/fpc.hh"
+#include "mem/cache/compressors/line_scan.hh"
+#include "mem/cache/compressors/repeated_qwords.hh"
+#include "mem/cache/compressors/zero.hh"
+#include "params/Base16Delta8.hh"
+#include "params/Base32Delta16.hh"
+#include "params/Base32Delta8.hh"
+#include "params/Base64Delta16.hh"
+#include "params/Base64Delta32.hh"
+#include "params/Base64Delta8.hh"
+#include "params/FPC.hh"
+#include "params/RepeatedQwordsCompressor.hh"
+#include "params/ZeroCompressor.hh"
+
+// The version tags are declared as extern
+namespace gem5
+{
+std::set<std::string> version_tags;
+} // namespace gem5
+
+using namespace gem5;
+using namespace gem5::compression;
+
+namespace
+{
+
+/** Size of the lines being tested, in bytes. */
+const std::size_t blkSize = 64;
+
+/** Number of random lines per test. */
+const int numLines = 20000;
+
+/**
+ * Generate a line whose qwords mix the kinds of values the compressors
+ * look for: zeros, small signed values, values close to a common base,
+ * repeated bytes, and random values.
+ */
+std::vector<uint64_t>
+randomLine(std::mt19937_64& rng)
+{
+    const uint64_t base = rng();
+    const unsigned kinds = 1 + rng() % 6;
+    std::vector<uint64_t> line(blkSize / sizeof(uint64_t));
+    for (auto& qword : line) {
+        const uint64_t value = rng();
+        switch (rng() % kinds) {
+          case 0: qword = 0; break;
+          case 1: qword = sext<8>(value & mask(8)); break;
+          case 2: qword = base + sext<16>(value & mask(16)); break;
+          case 3: qword = (value & mask(8)) * 0x0101010101010101; break;
+          case 4: qword = (value & mask(16)) << 16; break;
+          default: qword = value; break;
+        }
+    }
+    return line;
+}
+
+/** Split a line into chunks, the way Base::toChunks() does. */
+std::vector<uint64_t>
+toChunks(const std::vector<uint64_t>& line, unsigned chunk_size_bits)
+{
+    const unsigned chunks_per_qword = 64 / chunk_size_bits;
+    std::vector<uint64_t> chunks;
+    for (const uint64_t qword : line) {
+        for (unsigned i = 0; i < chunks_per_qword; i++) {
+            chunks.push_back(bits(qword, (i + 1) * chunk_size_bits - 1,
+                i * chunk_size_bits));
+        }
+    }
+    return chunks;
+}
+
+/**
+ * Scalar reference of the zero compressor: every non-zero value is
+ * uncompressed and allocates a dictionary entry.
+ */
+std::size_t
+zeroSize(const std::vector<uint64_t>& chunks)
+{
+    std::size_t size_bits = 0;
+    std::size_t num_entries = 0;
+    for (const uint64_t value : chunks) {
+        if (value != 0) {
+            size_bits += 64;
+            num_entries++;
+        }
+    }
+    return (num_entries > 0) ? blkSize * 8 : size_bits;
+}
+
+/**
+ * Scalar reference of the repeated qwords compressor: a value matches
+ * only the first dictionary entry.
+ */
+std::size_t
+repeatedQwordsSize(const std::vector<uint64_t>& chunks)
+{
+    std::size_t size_bits = 0;
+    std::vector<uint64_t> dictionary;
+    for (const uint64_t value : chunks) {
+        if (dictionary.empty() || (dictionary[0] != value)) {
+            size_bits += 64;
+            dictionary.push_back(value);
+        }
+    }
+    return (dictionary.size() > 1) ? blkSize * 8 : size_bits;
+}
+
+/**
+ * Scalar reference of the base-delta compressors: a value is matched
+ * against every base in the dictionary, which initially holds a zero
+ * base, and becomes a new base if none is close enough.
+ */
+template <class T, std::size_t DeltaSizeBits>
+std::size_t
+baseDeltaSize(const std::vector<uint64_t>& chunks)
+{
+    const std::size_t x_size_bits = 8 * sizeof(T) + 1 + DeltaSizeBits;
+    const std::size_t m_size_bits = 1 + DeltaSizeBits;
+    const typename std::make_signed<T>::type limit =
+        mask(DeltaSizeBits - 1);
+
+    std::size_t size_bits = 0;
+    std::vector<T> dictionary = {0};
+    for (const uint64_t chunk : chunks) {
+        const T value = chunk;
+        bool match = false;
+        for (const T base : dictionary) {
+            const typename std::make_signed<T>::type delta = value - base;
+            if ((delta >= -limit) && (delta <= limit)) {
+                match = true;
+                break;
+            }
+        }
+        if (match) {
+            size_bits += m_size_bits;
+        } else {
+            size_bits += x_size_bits;
+            dictionary.push_back(value);
+        }
+    }
+
+    const int diff = 2 - int(dictionary.size());
+    if (diff < 0) {
+        return blkSize * 8;
+    }
+    return size_bits + 8 * sizeof(T) * diff;
+}
+
+/** Size of each FPC pattern, excluding zero runs, in bits. */
+const std::size_t fpcSizeBits[] = {0, 7, 11, 19, 19, 19, 11, 35};
+
+/**
+ * Scalar reference of FPC: a word takes the first pattern it matches,
+ * and zero words are grouped in runs of limited length.
+ */
+std::size_t
+fpcSize(const std::vector<uint64_t>& chunks, int zero_run_bits)
+{
+    std::size_t size_bits = 0;
+    bool in_run = false;
+    int run_length = 0;
+    for (const uint64_t chunk : chunks) {
+        const uint32_t data = chunk;
+        const int16_t halfwords[2] = {
+            int16_t(data & mask(16)),
+            int16_t((data >> 16) & mask(16))
+        };
+        int pattern;
+        if (data == 0) {
+            pattern = line_scan::FPC_ZERO_RUN;
+        } else if (data == (uint32_t)szext<4>(data)) {
+            pattern = line_scan::FPC_SIGN_EXTENDED_4_BITS;
+        } else if (data == (uint32_t)szext<8>(data)) {
+            pattern = line_scan::FPC_SIGN_EXTENDED_1_BYTE;
+        } else if (data == (uint32_t)szext<16>(data)) {
+            pattern = line_scan::FPC_SIGN_EXTENDED_HALFWORD;
+        } else if ((data & mask(16)) == 0) {
+            pattern = line_scan::FPC_ZERO_PADDED_HALFWORD;
+        } else if ((halfwords[0] == (uint16_t)szext<8>(halfwords[0])) &&
+            (halfwords[1] == (uint16_t)szext<8>(halfwords[1]))) {
+            pattern = line_scan::FPC_SIGN_EXTENDED_TWO_HALFWORDS;
+        } else if ((((data >> 8) & mask(8)) == (data & mask(8))) &&
+            (((data >> 16) & mask(8)) == (data & mask(8))) &&
+            ((data >> 24) == (data & mask(8)))) {
+            pattern = line_scan::FPC_REP_BYTES;
+        } else {
+            pattern = line_scan::FPC_UNCOMPRESSED;
+        }
+
+        if (pattern == line_scan::FPC_ZERO_RUN) {
+            if (!in_run || (run_length == mask(zero_run_bits))) {
+                size_bits += 3 + zero_run_bits;
+                run_length = 0;
+            } else {
+                run_length++;
+            }
+            in_run = true;
+        } else {
+            size_bits += fpcSizeBits[pattern];
+            in_run = false;
+        }
+    }
+    return size_bits;
+}
+
+/** Size of a base-delta line, using the kernel. */
+template <class T, std::size_t DeltaSizeBits>
+std::size_t
+baseDeltaKernelSize(const std::vector<uint64_t>& chunks)
+{
+    std::vector<T> bases(chunks.size() + 1);
+    const std::size_t num_x =
+        line_scan::countDeltaBases<T, DeltaSizeBits>(chunks.data(),
+        chunks.size(), bases.data());
+    const std::size_t num_m = chunks.size() - num_x;
+    if (num_x > 1) {
+        return blkSize * 8;
+    }
+    return num_x * (8 * sizeof(T) + 1 + DeltaSizeBits) +
+        num_m * (1 + DeltaSizeBits) + 8 * sizeof(T) * (1 - num_x);
+}
+
+/** Check a base-delta configuration against its scalar reference. */
+template <class T, std::size_t DeltaSizeBits>
+void
+checkBaseDelta()
+{
+    std::mt19937_64 rng(DeltaSizeBits * sizeof(T));
+    for (int i = 0; i < numLines; i++) {
+        const std::vector<uint64_t> chunks =
+            toChunks(randomLine(rng), 8 * sizeof(T));
+        ASSERT_EQ((baseDeltaKernelSize<T, DeltaSizeBits>(chunks)),
+            (baseDeltaSize<T, DeltaSizeBits>(chunks)));
+    }
+}
+
+/**
+ * A compressor whose decompression can be called, to check that the
+ * lines it compresses can be restored.
+ */
+template <class C>
+class TestCompressor : public C
+{
+  public:
+    using C::C;
+    using C::decompress;
+};
+
+/** Fill in the parameters shared by the dictionary compressors. */
+template <class Params>
+Params
+makeParams(unsigned chunk_size_bits)
+{
+    Params params;
+    params.name = "compressor";
+    params.eventq_index = 0;
+    params.block_size = blkSize;
+    params.chunk_size_bits = chunk_size_bits;
+    // Never clamp the size, so that it is compared as is
+    params.size_threshold_percentage = 100;
+    params.comp_chunks_per_cycle = 1;
+    params.comp_extra_latency = Cycles(0);
+    params.decomp_chunks_per_cycle = 1;
+    params.decomp_extra_latency = Cycles(0);
+    params.memo_entries = 0;
+    params.dictionary_size = blkSize;
+    params.vectorized = true;
+    return params;
+}
+
+/** Get the pattern counts of a dictionary compressor. */
+const statistics::VectorInfo*
+getPatternStats(const statistics::Group& compressor)
+{
+    for (const statistics::Info* info : compressor.getStats()) {
+        if (info->name == "patterns") {
+            return dynamic_cast<const statistics::VectorInfo*>(info);
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Compress the same random lines with a compressor that classifies them
+ * with its kernel and with one that builds their patterns, and check
+ * that both give the same sizes and pattern counts. The lines must also
+ * be restored by the decompression of the former.
+ */
+template <class C>
+void
+checkVectorized(typename C::Params params, unsigned seed)
+{
+    params.vectorized = false;
+    const typename C::Params scalar_params = params;
+    TestCompressor<C> scalar(scalar_params);
+    params.vectorized = true;
+    const typename C::Params vectorized_params = params;
+    TestCompressor<C> vectorized(vectorized_params);
+
+    scalar.regStats();
+    vectorized.regStats();
+    const statistics::VectorInfo* const scalar_patterns =
+        getPatternStats(scalar);
+    const statistics::VectorInfo* const vectorized_patterns =
+        getPatternStats(vectorized);
+    ASSERT_NE(scalar_patterns, nullptr);
+    ASSERT_NE(vectorized_patterns, nullptr);
+
+    std::mt19937_64 rng(seed);
+    for (int i = 0; i < numLines; i++) {
+        std::vector<uint64_t> line = randomLine(rng);
+        // Make some of the lines entirely repeated
+        if (i % 4 == 0) {
+            std::fill(line.begin(), line.end(), line[0]);
+        }
+
+        Cycles scalar_comp_lat, scalar_decomp_lat;
+        const std::unique_ptr<Base::CompressionData> scalar_data =
+            static_cast<Base&>(scalar).compress(line.data(),
+            scalar_comp_lat, scalar_decomp_lat);
+        Cycles vectorized_comp_lat, vectorized_decomp_lat;
+        const std::unique_ptr<Base::CompressionData> vectorized_data =
+            static_cast<Base&>(vectorized).compress(line.data(),
+            vectorized_comp_lat, vectorized_decomp_lat);
+
+        ASSERT_EQ(vectorized_data->getSizeBits(),
+            scalar_data->getSizeBits());
+        ASSERT_EQ(vectorized_comp_lat, scalar_comp_lat);
+        ASSERT_EQ(vectorized_decomp_lat, scalar_decomp_lat);
+        ASSERT_EQ(vectorized_patterns->value(), scalar_patterns->value());
+
+        std::vector<uint64_t> decomp_line(line.size());
+        vectorized.decompress(vectorized_data.get(), decomp_line.data());
+        ASSERT_EQ(decomp_line, line);
+    }
+}
+
+} // anonymous namespace
+
+/** The zero kernel must give the same sizes as the scalar path. */
+TEST(LineScanTest, Zero)
+{
+    std::mt19937_64 rng(1);
+    for (int i = 0; i < numLines; i++) {
+        const std::vector<uint64_t> chunks = toChunks(randomLine(rng), 64);
+        const std::size_t num_x = chunks.size() -
+            line_scan::countEqual(chunks.data(), chunks.size(), 0);
+        ASSERT_EQ(num_x ? blkSize * 8 : 0, zeroSize(chunks));
+    }
+
+    const std::vector<uint64_t> zeros(blkSize / sizeof(uint64_t), 0);
+    ASSERT_EQ(line_scan::countEqual(zeros.data(), zeros.size(), 0),
+        zeros.size());
+}
+
+/** The repeated qwords kernel must give the same sizes as the scalar path. */
+TEST(LineScanTest, RepeatedQwords)
+{
+    std::mt19937_64 rng(2);
+    for (int i = 0; i < numLines; i++) {
+        std::vector<uint64_t> chunks = toChunks(randomLine(rng), 64);
+        // Make some of the lines entirely repeated
+        if (i % 4 == 0) {
+            std::fill(chunks.begin(), chunks.end(), chunks[0]);
+        }
+        const std::size_t num_x = chunks.size() - line_scan::countEqual(
+            chunks.data() + 1, chunks.size() - 1, chunks[0]);
+        ASSERT_EQ((num_x > 1) ? blkSize * 8 : 64 * num_x,
+            repeatedQwordsSize(chunks));
+    }
+}
+
+/** The base-delta kernel must give the same sizes as the scalar path. */
+TEST(LineScanTest, BaseDelta)
+{
+    checkBaseDelta<uint64_t, 8>();
+    checkBaseDelta<uint64_t, 16>();
+    checkBaseDelta<uint64_t, 32>();
+    checkBaseDelta<uint32_t, 8>();
+    checkBaseDelta<uint32_t, 16>();
+    checkBaseDelta<uint16_t, 8>();
+}
+
+/** The FPC kernel must give the same sizes as the scalar path. */
+TEST(LineScanTest, FPC)
+{
+    std::mt19937_64 rng(3);
+    for (const int zero_run_bits : {1, 3}) {
+        for (int i = 0; i < numLines; i++) {
+            const std::vector<uint64_t> chunks =
+                toChunks(randomLine(rng), 32);
+            std::vector<uint8_t> patterns(chunks.size());
+            line_scan::fpcPatterns(chunks.data(), chunks.size(),
+                patterns.data());
+
+            std::size_t size_bits = (3 + zero_run_bits) *
+                line_scan::fpcZeroRuns(patterns.data(), chunks.size(),
+                zero_run_bits);
+            for (const uint8_t pattern : patterns) {
+                size_bits += fpcSizeBits[pattern];
+            }
+            ASSERT_EQ(size_bits, fpcSize(chunks, zero_run_bits));
+        }
+    }
+}
+
+/** The zero compressor must not depend on the use of its kernel. */
+TEST(LineScanTest, ZeroCompressor)
+{
+    checkVectorized<Zero>(makeParams<ZeroCompressorParams>(64), 4);
+}
+
+/** The repeated qwords compressor must not depend on its kernel. */
+TEST(LineScanTest, RepeatedQwordsCompressor)
+{
+    checkVectorized<RepeatedQwords>(
+        makeParams<RepeatedQwordsCompressorParams>(64), 5);
+}
+
+/** The base-delta compressors must not depend on their kernel. */
+TEST(LineScanTest, BaseDeltaCompressors)
+{
+    checkVectorized<Base64Delta8>(makeParams<Base64Delta8Params>(64), 6);
+    checkVectorized<Base64Delta16>(makeParams<Base64Delta16Params>(64), 7);
+    checkVectorized<Base64Delta32>(makeParams<Base64Delta32Params>(64), 8);
+    checkVectorized<Base32Delta8>(makeParams<Base32Delta8Params>(32), 9);
+    checkVectorized<Base32Delta16>(makeParams<Base32Delta16Params>(32), 10);
+    checkVectorized<Base16Delta8>(makeParams<Base16Delta8Params>(16), 11);
+}
+
+/** FPC must not depend on the use of its kernel. */
+TEST(LineScanTest, FPCCompressor)
+{
+    for (const int zero_run_bits : {1, 3}) {
+        FPCParams params = makeParams<FPCParams>(32);
+        params.zero_run_bits = zero_run_bits;
+        checkVectorized<FPC>(params, 12 + zero_run_bits);
+    }
+}
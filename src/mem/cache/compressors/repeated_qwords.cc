@@ -36,6 +36,7 @@
 #include "base/trace.hh"
 #include "debug/CacheComp.hh"
 #include "mem/cache/compressors/dictionary_compressor_impl.hh"
+#include "mem/cache/compressors/line_scan.hh"
 #include "params/RepeatedQwordsCompressor.hh"
 
 namespace gem5
@@ -47,6 +48,8 @@ namespace compression
 RepeatedQwords::RepeatedQwords(const Params &p)
     : DictionaryCompressor<uint64_t>(p)
 {
+    patternSizeBits[X] = PatternX(toDictionaryEntry(0), -1).getSizeBits();
+    patternSizeBits[M] = PatternM(toDictionaryEntry(0), 0).getSizeBits();
 }
 
 void
@@ -56,6 +59,23 @@ RepeatedQwords::addToDictionary(DictionaryEntry data)
     dictionary[numEntries++] = data;
 }
 
+bool
+RepeatedQwords::scan(const std::vector<Chunk>& chunks,
+    std::size_t& size_bits)
+{
+    // Only the first chunk's entry can be matched, so every chunk that
+    // differs from it is stored uncompressed, allocating an entry
+    const std::size_t num_m = line_scan::countEqual(chunks.data() + 1,
+        chunks.size() - 1, chunks[0]);
+    const std::size_t num_x = chunks.size() - num_m;
+    numEntries += num_x;
+
+    dictionaryStats.patterns[M] += num_m;
+    dictionaryStats.patterns[X] += num_x;
+    size_bits = num_m * patternSizeBits[M] + num_x * patternSizeBits[X];
+    return true;
+}
+
 std::unique_ptr<Base::CompressionData>
 RepeatedQwords::compress(const std::vector<Chunk>& chunks,
     Cycles& comp_lat, Cycles& decomp_lat)
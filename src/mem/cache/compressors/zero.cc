@@ -36,6 +36,7 @@
 #include "base/trace.hh"
 #include "debug/CacheComp.hh"
 #include "mem/cache/compressors/dictionary_compressor_impl.hh"
+#include "mem/cache/compressors/line_scan.hh"
 #include "params/ZeroCompressor.hh"
 
 namespace gem5
@@ -47,6 +48,8 @@ namespace compression
 Zero::Zero(const Params &p)
     : DictionaryCompressor<uint64_t>(p)
 {
+    patternSizeBits[X] = PatternX(toDictionaryEntry(0), -1).getSizeBits();
+    patternSizeBits[Z] = PatternZ(toDictionaryEntry(0), -1).getSizeBits();
 }
 
 void
@@ -56,6 +59,21 @@ Zero::addToDictionary(DictionaryEntry data)
     dictionary[numEntries++] = data;
 }
 
+bool
+Zero::scan(const std::vector<Chunk>& chunks, std::size_t& size_bits)
+{
+    // Every non-zero chunk is stored uncompressed, allocating an entry
+    const std::size_t num_z =
+        line_scan::countEqual(chunks.data(), chunks.size(), 0);
+    const std::size_t num_x = chunks.size() - num_z;
+    numEntries += num_x;
+
+    dictionaryStats.patterns[Z] += num_z;
+    dictionaryStats.patterns[X] += num_x;
+    size_bits = num_z * patternSizeBits[Z] + num_x * patternSizeBits[X];
+    return true;
+}
+
 std::unique_ptr<Base::CompressionData>
 Zero::compress(const std::vector<Chunk>& chunks, Cycles& comp_lat,
     Cycles& decomp_lat)
@@ -94,8 +94,14 @@ class Zero : public DictionaryCompressor<uint64_t>
         return PatternFactory::getPattern(bytes, dict_bytes, match_location);
     }
 
+    /** Size of each pattern, in bits. */
+    std::array<std::size_t, NUM_PATTERNS> patternSizeBits;
+
     void addToDictionary(DictionaryEntry data) override;
 
+    bool scan(const std::vector<Chunk>& chunks,
+        std::size_t& size_bits) override;
+
     std::unique_ptr<Base::CompressionData> compress(
         const std::vector<Base::Chunk>& chunks,
         Cycles& comp_lat, Cycles& decomp_lat) override;
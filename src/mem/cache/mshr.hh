@@ -378,12 +378,6 @@ class MSHR : public QueueEntry, public Printable
      */
     void promoteIf(const std::function<bool (Target &)>& pred);
 
-    /**
-     * Pointer to this MSHR on the ready list.
-     * @sa MissQueue, MSHRQueue::readyList
-     */
-    Iterator readyIter;
-
     /**
      * Pointer to this MSHR on the allocated list.
      * @sa MissQueue, MSHRQueue::allocatedList
@@ -72,10 +72,8 @@ MSHRQueue::allocate(Addr blk_addr, unsigned blk_size, PacketPtr pkt,
             allocatedList.size() + 1, numEntries);
 
     mshr->allocate(blk_addr, blk_size, pkt, when_ready, order, alloc_on_fill);
-    mshr->allocIter = allocatedList.insert(allocatedList.end(), mshr);
-    mshr->readyIter = addToReadyList(mshr);
+    insertAllocated(mshr);
 
-    allocated += 1;
     return mshr;
 }
 
@@ -94,9 +92,7 @@ void
 MSHRQueue::moveToFront(MSHR *mshr)
 {
     if (!mshr->inService) {
-        assert(mshr == *(mshr->readyIter));
-        readyList.erase(mshr->readyIter);
-        mshr->readyIter = readyList.insert(readyList.begin(), mshr);
+        moveToReadyFront(mshr);
     }
 }
 
@@ -104,18 +100,14 @@ void
 MSHRQueue::delay(MSHR *mshr, Tick delay_ticks)
 {
     mshr->delay(delay_ticks);
-    auto it = std::find_if(mshr->readyIter, readyList.end(),
-                            [mshr] (const MSHR* _mshr) {
-                                return mshr->readyTime >= _mshr->readyTime;
-                            });
-    readyList.splice(it, readyList, mshr->readyIter);
+    updateReadyList(mshr);
 }
 
 void
 MSHRQueue::markInService(MSHR *mshr, bool pending_modified_resp)
 {
     mshr->markInService(pending_modified_resp);
-    readyList.erase(mshr->readyIter);
+    removeFromReadyList(mshr);
     _numInService += 1;
 }
 
@@ -129,7 +121,7 @@ MSHRQueue::markPending(MSHR *mshr)
      * @ todo might want to add rerequests to front of pending list for
      * performance.
      */
-    mshr->readyIter = addToReadyList(mshr);
+    addToReadyList(mshr);
 }
 
 bool
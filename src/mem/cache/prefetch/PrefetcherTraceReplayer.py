@@ -0,0 +1,53 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.params import *
+from m5.proxy import *
+from m5.SimObject import *
+
+
+class PrefetcherTraceReplayer(SimObject):
+    """Replays a packet trace (proto/packet.proto) through a prefetcher
+    without a cache. Call replay() after m5.instantiate() and dump the
+    statistics to obtain the host replay rate, next to the statistics of
+    the prefetcher."""
+
+    type = "PrefetcherTraceReplayer"
+    cxx_class = "gem5::prefetch::TraceReplayer"
+    cxx_header = "mem/cache/prefetch/trace_replayer.hh"
+
+    cxx_exports = [PyBindMethod("replay")]
+
+    system = Param.System(Parent.any, "System the replayer belongs to")
+    prefetcher = Param.BasePrefetcher("Prefetcher under test")
+    block_size = Param.Int(Parent.cache_line_size, "Block size in bytes")
+    trace_file = Param.String("Packet trace to replay")
+    max_accesses = Param.UInt64(
+        0, "Stop after this many accesses (0 replays the whole trace)"
+    )
+    prefetches_per_access = Param.Unsigned(
+        1, "Prefetches taken from the prefetcher after each access"
+    )
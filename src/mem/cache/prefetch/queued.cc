@@ -38,6 +38,7 @@
 #include "mem/cache/prefetch/queued.hh"
 
 #include <cassert>
+#include <vector>
 
 #include "arch/generic/tlb.hh"
 #include "base/logging.hh"
@@ -111,13 +112,13 @@ Queued::Queued(const QueuedPrefetcherParams &p)
 Queued::~Queued()
 {
     // Delete the queued prefetch packets
-    for (DeferredPacket &p : pfq) {
+    for (DeferredPacket &p : pfq.packets) {
         delete p.pkt;
     }
 }
 
 void
-Queued::printQueue(const std::list<DeferredPacket> &queue) const
+Queued::printQueue(const PrefetchQueue &queue) const
 {
     int pos = 0;
     std::string queue_name = "";
@@ -128,8 +129,8 @@ Queued::printQueue(const std::list<DeferredPacket> &queue) const
         queue_name = "PFTransQ";
     }
 
-    for (const_iterator it = queue.cbegin(); it != queue.cend();
-                                                            it++, pos++) {
+    for (const_iterator it = queue.packets.cbegin();
+         it != queue.packets.cend(); it++, pos++) {
         Addr vaddr = it->pfInfo.getAddr();
         /* Set paddr to 0 if not yet translated */
         Addr paddr = it->pkt ? it->pkt->getAddr() : 0;
@@ -178,20 +179,21 @@ Queued::notify(const CacheAccessProbeArg &acc, const PrefetchInfo &pfi)
 
     // Squash queued prefetches if demand miss to same line
     if (queueSquash) {
-        auto itr = pfq.begin();
-        while (itr != pfq.end()) {
-            if (blockAddress(itr->pfInfo.getAddr()) == blk_addr &&
-                itr->pfInfo.isSecure() == is_secure) {
-                DPRINTF(HWPrefetch, "Removing pf candidate addr: %#x "
-                        "(cl: %#x), demand request going to the same addr\n",
-                        itr->pfInfo.getAddr(),
-                        blockAddress(itr->pfInfo.getAddr()));
-                delete itr->pkt;
-                itr = pfq.erase(itr);
-                statsQueued.pfRemovedDemand++;
-            } else {
-                ++itr;
-            }
+        std::vector<iterator> squashed;
+        auto range = pfq.blocks.equal_range(blk_addr);
+        for (auto entry = range.first; entry != range.second; ++entry) {
+            if (entry->second->pfInfo.isSecure() == is_secure)
+                squashed.push_back(entry->second);
+        }
+
+        for (iterator itr : squashed) {
+            DPRINTF(HWPrefetch, "Removing pf candidate addr: %#x "
+                    "(cl: %#x), demand request going to the same addr\n",
+                    itr->pfInfo.getAddr(),
+                    blockAddress(itr->pfInfo.getAddr()));
+            delete itr->pkt;
+            removeFromQueue(pfq, itr);
+            statsQueued.pfRemovedDemand++;
         }
     }
 
@@ -251,8 +253,8 @@ Queued::getPacket()
         return nullptr;
     }
 
-    PacketPtr pkt = pfq.front().pkt;
-    pfq.pop_front();
+    PacketPtr pkt = pfq.packets.front().pkt;
+    removeFromQueue(pfq, pfq.packets.begin());
 
     prefetchStats.pfIssued++;
     issuedPrefetches += 1;
@@ -288,8 +290,8 @@ void
 Queued::processMissingTranslations(unsigned max)
 {
     unsigned count = 0;
-    iterator it = pfqMissingTranslation.begin();
-    while (it != pfqMissingTranslation.end() && count < max) {
+    iterator it = pfqMissingTranslation.packets.begin();
+    while (it != pfqMissingTranslation.packets.end() && count < max) {
         DeferredPacket &dp = *it;
         // Increase the iterator first because dp.startTranslation can end up
         // calling finishTranslation, which will erase "it"
@@ -303,14 +305,14 @@ void
 Queued::translationComplete(DeferredPacket *dp, bool failed,
                             const CacheAccessor &cache)
 {
-    auto it = pfqMissingTranslation.begin();
-    while (it != pfqMissingTranslation.end()) {
-        if (&(*it) == dp) {
-            break;
-        }
-        it++;
+    auto range = pfqMissingTranslation.blocks.equal_range(
+        blockAddress(dp->pfInfo.getAddr()));
+    auto entry = range.first;
+    while (entry != range.second && &(*entry->second) != dp) {
+        ++entry;
     }
-    assert(it != pfqMissingTranslation.end());
+    assert(entry != range.second);
+    iterator it = entry->second;
     if (!failed) {
         DPRINTF(HWPrefetch, "%s Translation of vaddr %#x succeeded: "
                 "paddr %#x \n", mmu->name(),
@@ -335,42 +337,40 @@ Queued::translationComplete(DeferredPacket *dp, bool failed,
                 "prefetch request %#x \n", mmu->name(),
                 it->translationRequest->getVaddr());
     }
-    pfqMissingTranslation.erase(it);
+    removeFromQueue(pfqMissingTranslation, it);
 }
 
 bool
-Queued::alreadyInQueue(std::list<DeferredPacket> &queue,
+Queued::alreadyInQueue(PrefetchQueue &queue,
                                  const PrefetchInfo &pfi, int32_t priority)
 {
-    bool found = false;
-    iterator it;
-    for (it = queue.begin(); it != queue.end() && !found; it++) {
-        found = it->pfInfo.sameAddr(pfi);
+    auto range = queue.blocks.equal_range(blockAddress(pfi.getAddr()));
+    auto entry = range.first;
+    while (entry != range.second && !entry->second->pfInfo.sameAddr(pfi)) {
+        ++entry;
     }
 
-    /* If the address is already in the queue, update priority and leave */
-    if (it != queue.end()) {
-        statsQueued.pfBufferHit++;
-        if (it->priority < priority) {
-            /* Update priority value and position in the queue */
-            it->priority = priority;
-            iterator prev = it;
-            while (prev != queue.begin()) {
-                prev--;
-                /* If the packet has higher priority, swap */
-                if (*it > *prev) {
-                    std::swap(*it, *prev);
-                    it = prev;
-                }
-            }
-            DPRINTF(HWPrefetch, "Prefetch addr already in "
-                "prefetch queue, priority updated\n");
-        } else {
-            DPRINTF(HWPrefetch, "Prefetch addr already in "
-                "prefetch queue\n");
-        }
+    if (entry == range.second) {
+        return false;
     }
-    return found;
+
+    /* The address is already in the queue, update priority and leave */
+    statsQueued.pfBufferHit++;
+    iterator it = entry->second;
+    if (it->priority < priority) {
+        /* Update priority value and position in the queue */
+        removeFromLevel(queue, it);
+        it->priority = priority;
+        queue.packets.splice(queuePosition(queue, priority), queue.packets,
+                             it);
+        queue.levels.emplace(priority, it);
+        DPRINTF(HWPrefetch, "Prefetch addr already in "
+            "prefetch queue, priority updated\n");
+    } else {
+        DPRINTF(HWPrefetch, "Prefetch addr already in "
+            "prefetch queue\n");
+    }
+    return true;
 }
 
 RequestPtr
@@ -483,51 +483,63 @@ Queued::insert(const PacketPtr &pkt, PrefetchInfo &new_pfi,
     }
 }
 
+Queued::iterator
+Queued::queuePosition(PrefetchQueue &queue, int32_t priority)
+{
+    /* Before the oldest prefetch of the next lower priority */
+    auto lower = queue.levels.upper_bound(priority);
+    return lower == queue.levels.end() ? queue.packets.end() : lower->second;
+}
+
+void
+Queued::removeFromLevel(PrefetchQueue &queue, iterator it)
+{
+    auto level = queue.levels.find(it->priority);
+    if (level->second == it) {
+        iterator next = std::next(it);
+        if (next != queue.packets.end() && next->priority == it->priority) {
+            level->second = next;
+        } else {
+            queue.levels.erase(level);
+        }
+    }
+}
+
 void
-Queued::addToQueue(std::list<DeferredPacket> &queue,
-                             DeferredPacket &dpp)
+Queued::removeFromQueue(PrefetchQueue &queue, iterator it)
+{
+    removeFromLevel(queue, it);
+
+    auto range = queue.blocks.equal_range(blockAddress(it->pfInfo.getAddr()));
+    for (auto entry = range.first; entry != range.second; ++entry) {
+        if (entry->second == it) {
+            queue.blocks.erase(entry);
+            break;
+        }
+    }
+
+    queue.packets.erase(it);
+}
+
+void
+Queued::addToQueue(PrefetchQueue &queue, DeferredPacket &dpp)
 {
     /* Verify prefetch buffer space for request */
     if (queue.size() == queueSize) {
         statsQueued.pfRemovedFull++;
-        /* Lowest priority packet */
-        iterator it = queue.end();
-        panic_if (it == queue.begin(),
-            "Prefetch queue is both full and empty!");
-        --it;
-        /* Look for oldest in that level of priority */
-        panic_if (it == queue.begin(),
-            "Prefetch queue is full with 1 element!");
-        iterator prev = it;
-        bool cont = true;
-        /* While not at the head of the queue */
-        while (cont && prev != queue.begin()) {
-            prev--;
-            /* While at the same level of priority */
-            cont = prev->priority == it->priority;
-            if (cont)
-                /* update pointer */
-                it = prev;
-        }
+        panic_if(queue.empty(), "Prefetch queue is both full and empty!");
+        /* Oldest packet of the lowest priority */
+        iterator it = queue.levels.rbegin()->second;
         DPRINTF(HWPrefetch, "Prefetch queue full, removing lowest priority "
                             "oldest packet, addr: %#x\n",it->pfInfo.getAddr());
         delete it->pkt;
-        queue.erase(it);
+        removeFromQueue(queue, it);
     }
 
-    if ((queue.size() == 0) || (dpp <= queue.back())) {
-        queue.emplace_back(dpp);
-    } else {
-        iterator it = queue.end();
-        do {
-            --it;
-        } while (it != queue.begin() && dpp > *it);
-        /* If we reach the head, we have to see if the new element is new head
-         * or not */
-        if (it == queue.begin() && dpp <= *it)
-            it++;
-        queue.insert(it, dpp);
-    }
+    iterator it = queue.packets.insert(queuePosition(queue, dpp.priority),
+                                       dpp);
+    queue.levels.emplace(dpp.priority, it);
+    queue.blocks.emplace(blockAddress(dpp.pfInfo.getAddr()), it);
 
     if (debug::HWPrefetchQueue)
         printQueue(queue);
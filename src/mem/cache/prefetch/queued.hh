@@ -39,7 +39,10 @@
 #define __MEM_CACHE_PREFETCH_QUEUED_HH__
 
 #include <cstdint>
+#include <functional>
 #include <list>
+#include <map>
+#include <unordered_map>
 #include <utility>
 
 #include "arch/generic/mmu.hh"
@@ -141,12 +144,32 @@ class Queued : public Base
         void startTranslation(BaseMMU *mmu);
     };
 
-    std::list<DeferredPacket> pfq;
-    std::list<DeferredPacket> pfqMissingTranslation;
-
     using const_iterator = std::list<DeferredPacket>::const_iterator;
     using iterator = std::list<DeferredPacket>::iterator;
 
+    /**
+     * A queue of prefetches, in decreasing order of priority and in
+     * arrival order for the same priority. The prefetches are indexed
+     * by priority level and by block address, so that inserting and
+     * finding a prefetch does not walk the queue.
+     */
+    struct PrefetchQueue
+    {
+        std::list<DeferredPacket> packets;
+
+        /** Oldest prefetch of each priority level, highest first */
+        std::map<int32_t, iterator, std::greater<int32_t>> levels;
+
+        /** Queued prefetches by block address */
+        std::unordered_multimap<Addr, iterator> blocks;
+
+        bool empty() const { return packets.empty(); }
+        size_t size() const { return packets.size(); }
+    };
+
+    PrefetchQueue pfq;
+    PrefetchQueue pfqMissingTranslation;
+
     // PARAMETERS
 
     /** Maximum size of the prefetch queue */
@@ -207,10 +230,10 @@ class Queued : public Base
 
     Tick nextPrefetchReadyTime() const override
     {
-        return pfq.empty() ? MaxTick : pfq.front().tick;
+        return pfq.empty() ? MaxTick : pfq.packets.front().tick;
     }
 
-    void printQueue(const std::list<DeferredPacket> &queue) const;
+    void printQueue(const PrefetchQueue &queue) const;
 
   private:
 
@@ -219,7 +242,31 @@ class Queued : public Base
      * @param queue selected queue to use
      * @param dpp DeferredPacket to add
      */
-    void addToQueue(std::list<DeferredPacket> &queue, DeferredPacket &dpp);
+    void addToQueue(PrefetchQueue &queue, DeferredPacket &dpp);
+
+    /**
+     * Removes a prefetch from the specified queue, without deleting its
+     * packet
+     * @param queue selected queue to use
+     * @param it the prefetch to remove
+     */
+    void removeFromQueue(PrefetchQueue &queue, iterator it);
+
+    /**
+     * Removes a prefetch from the index of the priority levels of the
+     * specified queue, before it is moved or removed
+     * @param queue selected queue to use
+     * @param it the prefetch
+     */
+    void removeFromLevel(PrefetchQueue &queue, iterator it);
+
+    /**
+     * Position in the specified queue of a new prefetch, after all the
+     * prefetches of the same or a higher priority
+     * @param queue selected queue to use
+     * @param priority priority of the new prefetch
+     */
+    iterator queuePosition(PrefetchQueue &queue, int32_t priority);
 
     /**
      * Starts the translations of the queued prefetches with a
@@ -249,7 +296,7 @@ class Queued : public Base
      * @param priority priority of the prefetch request to be added
      * @return True if the prefetch request was found in the queue
      */
-    bool alreadyInQueue(std::list<DeferredPacket> &queue,
+    bool alreadyInQueue(PrefetchQueue &queue,
                         const PrefetchInfo &pfi, int32_t priority);
 
     /**
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/prefetch/trace_replayer.hh"
+
+#include <chrono>
+#include <memory>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "mem/packet.hh"
+#include "proto/packet.pb.h"
+#include "proto/protoio.hh"
+#include "sim/cur_tick.hh"
+#include "sim/system.hh"
+
+namespace gem5
+{
+
+namespace prefetch
+{
+
+TraceReplayer::TraceReplayer(const Params &p)
+    : SimObject(p),
+      prefetcher(p.prefetcher),
+      blkSize(p.block_size),
+      traceFile(p.trace_file),
+      maxAccesses(p.max_accesses),
+      prefetchesPerAccess(p.prefetches_per_access),
+      requestorId(p.system->getRequestorId(this)),
+      accessor(*this),
+      stats(this)
+{
+    fatal_if(!isPowerOf2(blkSize), "%s: block size must be a power of 2\n",
+             name());
+
+    // stand in for the cache the prefetcher would be attached to, but
+    // without probe points, as accesses are fed to it directly
+    prefetcher->setParentInfo(p.system, nullptr, blkSize);
+}
+
+void
+TraceReplayer::loadTrace(std::vector<TraceRecord> &trace) const
+{
+    ProtoInputStream input(traceFile);
+
+    ProtoMessage::PacketHeader header;
+    fatal_if(!input.read(header), "%s: failed to read packet trace header "
+             "from %s\n", name(), traceFile);
+    inform("%s: loading packet trace '%s' recorded by %s\n", name(),
+           traceFile, header.obj_id());
+
+    ProtoMessage::Packet msg;
+    while ((!maxAccesses || trace.size() < maxAccesses) && input.read(msg)) {
+        const MemCmd cmd(msg.cmd());
+        if (!cmd.isRead() && !cmd.isWrite())
+            continue;
+
+        trace.push_back({msg.addr(), msg.has_pc() ? msg.pc() : 0,
+                         msg.has_flags() ? msg.flags() : 0, msg.size(),
+                         cmd.isWrite()});
+    }
+}
+
+uint64_t
+TraceReplayer::replay()
+{
+    std::vector<TraceRecord> trace;
+    loadTrace(trace);
+
+    inform("%s: replaying %d accesses through %s\n", name(), trace.size(),
+           prefetcher->name());
+
+    std::vector<uint8_t> data;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (const auto &rec : trace) {
+        RequestPtr req;
+        if (rec.pc) {
+            req = std::make_shared<Request>(rec.addr, rec.size, rec.flags,
+                                            requestorId, rec.pc, 0);
+            req->setPaddr(rec.addr);
+        } else {
+            req = std::make_shared<Request>(rec.addr, rec.size, rec.flags,
+                                            requestorId);
+        }
+
+        Packet pkt(req, rec.write ? MemCmd::WriteReq : MemCmd::ReadReq);
+        if (rec.write) {
+            if (data.size() < rec.size)
+                data.resize(rec.size);
+            pkt.dataStatic(data.data());
+        }
+
+        prefetcher->probeNotify(CacheAccessProbeArg(&pkt, accessor), true);
+        ++stats.accesses;
+
+        if (prefetched.erase(blockAddress(rec.addr)))
+            ++stats.usefulPrefetches;
+
+        for (unsigned i = 0; i < prefetchesPerAccess; ++i) {
+            PacketPtr pf = prefetcher->getPacket();
+            if (!pf)
+                break;
+
+            prefetched.insert(blockAddress(pf->getAddr()));
+            ++stats.prefetches;
+            delete pf;
+        }
+    }
+
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    stats.hostSeconds += elapsed.count();
+
+    return trace.size();
+}
+
+TraceReplayer::ReplayStats::ReplayStats(statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(accesses, statistics::units::Count::get(),
+               "Number of accesses replayed"),
+      ADD_STAT(prefetches, statistics::units::Count::get(),
+               "Number of prefetches taken from the prefetcher"),
+      ADD_STAT(usefulPrefetches, statistics::units::Count::get(),
+               "Number of prefetched blocks accessed after the prefetch"),
+      ADD_STAT(hostSeconds, statistics::units::Second::get(),
+               "Host time spent replaying the trace"),
+      ADD_STAT(accessRate, statistics::units::Rate<
+                statistics::units::Count, statistics::units::Second>::get(),
+               "Accesses replayed per host second",
+               accesses / hostSeconds)
+{
+    accessRate.precision(0);
+}
+
+} // namespace prefetch
+} // namespace gem5
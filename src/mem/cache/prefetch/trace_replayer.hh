@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Trace-driven prefetcher replay. Feeds a memory trace directly to a
+ * prefetcher, without a cache or the event queue, so that the host
+ * cost of training and of queueing prefetches can be measured in
+ * isolation.
+ */
+
+#ifndef __MEM_CACHE_PREFETCH_TRACE_REPLAYER_HH__
+#define __MEM_CACHE_PREFETCH_TRACE_REPLAYER_HH__
+
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "mem/cache/cache_probe_arg.hh"
+#include "mem/cache/prefetch/base.hh"
+#include "mem/request.hh"
+#include "params/PrefetcherTraceReplayer.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+class System;
+
+namespace prefetch
+{
+
+/**
+ * Replays a packet trace (proto/packet.proto), as written by a
+ * CommMonitor's MemTraceProbe, through a prefetcher. Every access is
+ * presented to the prefetcher as a cache miss. After each access, a
+ * configurable number of prefetches is taken from the prefetcher,
+ * which stands for the bandwidth the cache would give them, so that
+ * the prefetch queues fill up as they would in a cache.
+ *
+ * There are no tags: the only state kept is the set of blocks that
+ * were prefetched and not yet accessed, so that the prefetcher sees
+ * its useful prefetches.
+ */
+class TraceReplayer : public SimObject
+{
+  public:
+    PARAMS(PrefetcherTraceReplayer);
+    TraceReplayer(const Params &p);
+
+    /**
+     * Replay the trace through the prefetcher. Exported to Python so
+     * that configuration scripts can call it after m5.instantiate().
+     *
+     * @return The number of accesses replayed.
+     */
+    uint64_t replay();
+
+  private:
+    /** Cache lookups answered from the prefetched blocks */
+    class TraceAccessor : public CacheAccessor
+    {
+      public:
+        TraceAccessor(const TraceReplayer &_replayer)
+            : replayer(_replayer)
+        {}
+
+        bool
+        inCache(Addr addr, bool is_secure) const override
+        {
+            return false;
+        }
+
+        bool
+        hasBeenPrefetched(Addr addr, bool is_secure) const override
+        {
+            return replayer.prefetched.count(replayer.blockAddress(addr));
+        }
+
+        bool
+        hasBeenPrefetched(Addr addr, bool is_secure,
+                          RequestorID requestor) const override
+        {
+            return hasBeenPrefetched(addr, is_secure);
+        }
+
+        bool
+        inMissQueue(Addr addr, bool is_secure) const override
+        {
+            return false;
+        }
+
+        bool coalesce() const override { return false; }
+
+      private:
+        const TraceReplayer &replayer;
+    };
+
+    /** Compact in-memory form of one traced access. */
+    struct TraceRecord
+    {
+        Addr addr;
+        Addr pc;
+        Request::FlagsType flags;
+        uint32_t size;
+        bool write;
+    };
+
+    Addr blockAddress(Addr addr) const { return addr & ~(blkSize - 1); }
+
+    /** Decode the packet trace. */
+    void loadTrace(std::vector<TraceRecord> &trace) const;
+
+    Base *prefetcher;
+
+    const unsigned blkSize;
+
+    const std::string traceFile;
+
+    /** Stop after this many accesses, 0 replays the whole trace */
+    const uint64_t maxAccesses;
+
+    /** Prefetches taken from the prefetcher after each access */
+    const unsigned prefetchesPerAccess;
+
+    const RequestorID requestorId;
+
+    /** Blocks that were prefetched and not accessed since */
+    std::unordered_set<Addr> prefetched;
+
+    TraceAccessor accessor;
+
+    struct ReplayStats : public statistics::Group
+    {
+        ReplayStats(statistics::Group *parent);
+
+        statistics::Scalar accesses;
+        statistics::Scalar prefetches;
+        statistics::Scalar usefulPrefetches;
+        statistics::Scalar hostSeconds;
+        statistics::Formula accessRate;
+    } stats;
+};
+
+} // namespace prefetch
+} // namespace gem5
+
+#endif // __MEM_CACHE_PREFETCH_TRACE_REPLAYER_HH__
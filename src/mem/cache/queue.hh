@@ -45,10 +45,14 @@
 #ifndef __MEM_CACHE_QUEUE_HH__
 #define __MEM_CACHE_QUEUE_HH__
 
+#include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <string>
 #include <type_traits>
+#include <vector>
 
+#include "base/intmath.hh"
 #include "base/logging.hh"
 #include "base/named.hh"
 #include "base/trace.hh"
@@ -96,24 +100,151 @@ class Queue : public Drainable, public Named
     std::vector<Entry> entries;
     /** Holds pointers to all allocated entries. */
     typename Entry::List allocatedList;
-    /** Holds pointers to entries that haven't been sent downstream. */
-    typename Entry::List readyList;
     /** Holds non allocated entries. */
     typename Entry::List freeList;
 
-    typename Entry::Iterator addToReadyList(Entry* entry)
+    /**
+     * Holds the entries that haven't been sent downstream, as a binary
+     * heap ordered by ready time, and by the order they were made
+     * ready for the same ready time.
+     */
+    std::vector<Entry *> readyList;
+
+    /** Sequence number of the next entry made ready. */
+    int64_t nextReadySeq;
+
+    /**
+     * Allocated entries hashed by their block address, each bucket in
+     * allocation order, so that looking up an address does not scan
+     * all the allocated entries.
+     */
+    std::vector<std::vector<Entry *>> matchTable;
+
+    /** Log2 of the number of buckets of the match table. */
+    const unsigned matchTableBits;
+
+    std::vector<Entry *> &
+    matchBucket(Addr blk_addr)
+    {
+        return matchTable[(blk_addr * 0x9e3779b97f4a7c15ULL) >>
+                          (64 - matchTableBits)];
+    }
+
+    const std::vector<Entry *> &
+    matchBucket(Addr blk_addr) const
     {
-        if (readyList.empty() ||
-            readyList.back()->readyTime <= entry->readyTime) {
-            return readyList.insert(readyList.end(), entry);
+        return matchTable[(blk_addr * 0x9e3779b97f4a7c15ULL) >>
+                          (64 - matchTableBits)];
+    }
+
+    /** Should an entry be sent before another one. */
+    static bool
+    readyBefore(const Entry *a, const Entry *b)
+    {
+        return a->readyKey < b->readyKey ||
+            (a->readyKey == b->readyKey && a->readySeq < b->readySeq);
+    }
+
+    void
+    siftUp(size_t index)
+    {
+        Entry *entry = readyList[index];
+        while (index > 0) {
+            const size_t parent = (index - 1) / 2;
+            if (!readyBefore(entry, readyList[parent]))
+                break;
+            readyList[index] = readyList[parent];
+            readyList[index]->readyIndex = index;
+            index = parent;
         }
+        readyList[index] = entry;
+        entry->readyIndex = index;
+    }
 
-        for (auto i = readyList.begin(); i != readyList.end(); ++i) {
-            if ((*i)->readyTime > entry->readyTime) {
-                return readyList.insert(i, entry);
+    void
+    siftDown(size_t index)
+    {
+        Entry *entry = readyList[index];
+        const size_t size = readyList.size();
+        while (true) {
+            size_t child = 2 * index + 1;
+            if (child >= size)
+                break;
+            if (child + 1 < size &&
+                readyBefore(readyList[child + 1], readyList[child])) {
+                child++;
             }
+            if (!readyBefore(readyList[child], entry))
+                break;
+            readyList[index] = readyList[child];
+            readyList[index]->readyIndex = index;
+            index = child;
+        }
+        readyList[index] = entry;
+        entry->readyIndex = index;
+    }
+
+    /**
+     * Make an entry ready to be sent, after the entries with the same
+     * ready time that are already ready.
+     */
+    void
+    addToReadyList(Entry *entry)
+    {
+        entry->readyKey = entry->readyTime;
+        entry->readySeq = nextReadySeq++;
+        readyList.push_back(entry);
+        siftUp(readyList.size() - 1);
+    }
+
+    /** Make an entry ready to be sent before all the others. */
+    void
+    moveToReadyFront(Entry *entry)
+    {
+        Entry *front = readyList.front();
+        if (front != entry) {
+            entry->readyKey = front->readyKey;
+            entry->readySeq = front->readySeq - 1;
+            siftUp(entry->readyIndex);
+        }
+    }
+
+    /**
+     * Move an entry whose ready time has changed to its new place in
+     * the ready list, after the entries that are ready no later.
+     */
+    void
+    updateReadyList(Entry *entry)
+    {
+        removeFromReadyList(entry);
+        addToReadyList(entry);
+    }
+
+    void
+    removeFromReadyList(Entry *entry)
+    {
+        const size_t index = entry->readyIndex;
+        assert(readyList[index] == entry);
+        Entry *last = readyList.back();
+        readyList.pop_back();
+        if (last != entry) {
+            readyList[index] = last;
+            siftDown(index);
+            siftUp(last->readyIndex);
         }
-        panic("Failed to add to ready list.");
+    }
+
+    /**
+     * Add a newly allocated entry to the allocated list, the match
+     * table and the ready list.
+     */
+    void
+    insertAllocated(Entry *entry)
+    {
+        entry->allocIter = allocatedList.insert(allocatedList.end(), entry);
+        matchBucket(entry->blkAddr).push_back(entry);
+        addToReadyList(entry);
+        allocated += 1;
     }
 
     /** The number of entries that are in service. */
@@ -135,11 +266,15 @@ class Queue : public Drainable, public Named
         Named(name),
         label(_label), numEntries(num_entries + reserve),
         numReserve(reserve), entries(numEntries, name + ".entry"),
+        nextReadySeq(0),
+        matchTableBits(ceilLog2(std::max(2 * numEntries, 2))),
         _numInService(0), allocated(0)
     {
         for (int i = 0; i < numEntries; ++i) {
             freeList.push_back(&entries[i]);
         }
+        readyList.reserve(numEntries);
+        matchTable.resize(1ULL << matchTableBits);
     }
 
     bool isEmpty() const
@@ -168,7 +303,7 @@ class Queue : public Drainable, public Named
     Entry* findMatch(Addr blk_addr, bool is_secure,
                      bool ignore_uncacheable = true) const
     {
-        for (const auto& entry : allocatedList) {
+        for (const auto& entry : matchBucket(blk_addr)) {
             // we ignore any entries allocated for uncacheable
             // accesses and simply ignore them when matching, in the
             // cache we never check for matches when adding new
@@ -206,12 +341,15 @@ class Queue : public Drainable, public Named
      */
     Entry* findPending(const QueueEntry* entry) const
     {
-        for (const auto& ready_entry : readyList) {
-            if (ready_entry->conflictAddr(entry)) {
-                return ready_entry;
+        Entry *pending = nullptr;
+        for (const auto& ready_entry : matchBucket(entry->blkAddr)) {
+            if (!ready_entry->inService &&
+                ready_entry->conflictAddr(entry) &&
+                (!pending || readyBefore(ready_entry, pending))) {
+                pending = ready_entry;
             }
         }
-        return nullptr;
+        return pending;
     }
 
     /**
@@ -241,12 +379,14 @@ class Queue : public Drainable, public Named
     deallocate(Entry *entry)
     {
         allocatedList.erase(entry->allocIter);
+        auto &bucket = matchBucket(entry->blkAddr);
+        bucket.erase(std::find(bucket.begin(), bucket.end(), entry));
         freeList.push_front(entry);
         allocated--;
         if (entry->inService) {
             _numInService--;
         } else {
-            readyList.erase(entry->readyIter);
+            removeFromReadyList(entry);
         }
         entry->deallocate();
         if (drainState() == DrainState::Draining && allocated == 0) {
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <list>
+#include <random>
+#include <vector>
+
+#include "base/gtest/cur_tick_fake.hh"
+#include "mem/cache/queue.hh"
+#include "mem/cache/queue_entry.hh"
+
+using namespace gem5;
+
+// Instantiate the fake class to have a valid curTick of 0
+GTestTickHandler tickHandler;
+
+namespace
+{
+
+/** A queue entry with nothing but an address and a ready time. */
+class TestEntry : public QueueEntry
+{
+  public:
+    typedef std::list<TestEntry *> List;
+    typedef List::iterator Iterator;
+
+    Iterator allocIter;
+
+    TestEntry(const std::string &name) : QueueEntry(name) {}
+
+    Tick getReadyTime() const { return readyTime; }
+    void setReadyTime(Tick ready_time) { readyTime = ready_time; }
+
+    void deallocate() { inService = false; }
+
+    bool
+    matchBlockAddr(const Addr addr, const bool is_secure) const override
+    {
+        return blkAddr == addr && isSecure == is_secure;
+    }
+
+    bool matchBlockAddr(const PacketPtr pkt) const override { return false; }
+
+    bool
+    conflictAddr(const QueueEntry *entry) const override
+    {
+        return blkAddr == entry->blkAddr;
+    }
+
+    bool sendPacket(BaseCache &cache) override { return false; }
+
+    Target *getTarget() override { return nullptr; }
+};
+
+/** A queue that allocates, delays and services entries like MSHRQueue. */
+class TestQueue : public Queue<TestEntry>
+{
+  public:
+    TestQueue(int num_entries)
+        : Queue<TestEntry>("queue", num_entries, 0, "queue")
+    {}
+
+    bool hasFree() const { return !freeList.empty(); }
+
+    TestEntry *
+    allocate(Addr blk_addr, Tick when_ready)
+    {
+        TestEntry *entry = freeList.front();
+        freeList.pop_front();
+        entry->blkAddr = blk_addr;
+        entry->setReadyTime(when_ready);
+        insertAllocated(entry);
+        return entry;
+    }
+
+    void
+    delay(TestEntry *entry, Tick delay_ticks)
+    {
+        entry->setReadyTime(curTick() + delay_ticks);
+        updateReadyList(entry);
+    }
+
+    void
+    markInService(TestEntry *entry)
+    {
+        entry->inService = true;
+        removeFromReadyList(entry);
+        _numInService += 1;
+    }
+};
+
+/**
+ * The ready list as the queue kept it before it became a heap: a list
+ * sorted by ready time, where an entry is added after the entries with
+ * the same ready time, and a delayed entry is moved to the place its
+ * new ready time gives it.
+ */
+class ReferenceList
+{
+  public:
+    std::list<TestEntry *> entries;
+
+    void
+    add(TestEntry *entry)
+    {
+        if (entries.empty() ||
+            entries.back()->getReadyTime() <= entry->getReadyTime()) {
+            entries.push_back(entry);
+            return;
+        }
+        for (auto i = entries.begin(); i != entries.end(); ++i) {
+            if ((*i)->getReadyTime() > entry->getReadyTime()) {
+                entries.insert(i, entry);
+                return;
+            }
+        }
+    }
+
+    void remove(TestEntry *entry) { entries.remove(entry); }
+
+    TestEntry *
+    getNext() const
+    {
+        if (entries.empty() || entries.front()->getReadyTime() > curTick())
+            return nullptr;
+        return entries.front();
+    }
+
+    Tick
+    nextReadyTime() const
+    {
+        return entries.empty() ? MaxTick : entries.front()->getReadyTime();
+    }
+};
+
+} // anonymous namespace
+
+/**
+ * A delayed entry must not hold back an entry allocated after it that
+ * is ready earlier.
+ */
+TEST(QueueTest, DelayedEntryDoesNotBlock)
+{
+    tickHandler.setCurTick(100);
+    TestQueue queue(4);
+
+    TestEntry *delayed = queue.allocate(0x40, 100);
+    ASSERT_EQ(queue.getNext(), delayed);
+    queue.delay(delayed, 10);
+    EXPECT_EQ(queue.getNext(), nullptr);
+    EXPECT_EQ(queue.nextReadyTime(), 110);
+
+    TestEntry *early = queue.allocate(0x80, 101);
+    EXPECT_EQ(queue.nextReadyTime(), 101);
+
+    tickHandler.setCurTick(101);
+    EXPECT_EQ(queue.getNext(), early);
+    queue.markInService(early);
+    EXPECT_EQ(queue.getNext(), nullptr);
+
+    tickHandler.setCurTick(110);
+    EXPECT_EQ(queue.getNext(), delayed);
+}
+
+/** Entries delayed to the same tick keep the order they were delayed in. */
+TEST(QueueTest, DelayedEntriesKeepOrder)
+{
+    tickHandler.setCurTick(200);
+    TestQueue queue(4);
+
+    TestEntry *first = queue.allocate(0x40, 200);
+    TestEntry *second = queue.allocate(0x80, 200);
+    TestEntry *third = queue.allocate(0xc0, 205);
+
+    queue.delay(first, 5);
+    queue.delay(second, 5);
+
+    tickHandler.setCurTick(205);
+    EXPECT_EQ(queue.getNext(), third);
+    queue.markInService(third);
+    EXPECT_EQ(queue.getNext(), first);
+    queue.markInService(first);
+    EXPECT_EQ(queue.getNext(), second);
+}
+
+/**
+ * Allocate, delay, service and free entries at random, with many equal
+ * ready times, and check that the heap always picks the same entry as
+ * the sorted list.
+ */
+TEST(QueueTest, RandomMatchesList)
+{
+    tickHandler.setCurTick(1000);
+    TestQueue queue(16);
+    ReferenceList reference;
+    std::vector<TestEntry *> in_service;
+    std::mt19937 rng(1);
+
+    for (int step = 0; step < 20000; ++step) {
+        const unsigned op = rng() % 4;
+        if (op == 0 && queue.hasFree()) {
+            TestEntry *entry = queue.allocate((rng() % 64) * 64,
+                                              curTick() + rng() % 4);
+            reference.add(entry);
+        } else if (op == 1) {
+            // only entries that are ready may be delayed
+            std::vector<TestEntry *> ready;
+            for (auto entry : reference.entries) {
+                if (entry->getReadyTime() <= curTick())
+                    ready.push_back(entry);
+            }
+            if (!ready.empty()) {
+                TestEntry *entry = ready[rng() % ready.size()];
+                reference.remove(entry);
+                queue.delay(entry, 1 + rng() % 8);
+                reference.add(entry);
+            }
+        } else if (op == 2) {
+            TestEntry *entry = queue.getNext();
+            ASSERT_EQ(entry, reference.getNext());
+            if (entry) {
+                queue.markInService(entry);
+                reference.remove(entry);
+                in_service.push_back(entry);
+            }
+        } else if (!in_service.empty()) {
+            const size_t index = rng() % in_service.size();
+            queue.deallocate(in_service[index]);
+            in_service.erase(in_service.begin() + index);
+        }
+
+        ASSERT_EQ(queue.getNext(), reference.getNext());
+        ASSERT_EQ(queue.nextReadyTime(), reference.nextReadyTime());
+
+        tickHandler.setCurTick(curTick() + rng() % 3);
+    }
+}
@@ -46,6 +46,8 @@
 #ifndef __MEM_CACHE_QUEUE_ENTRY_HH__
 #define __MEM_CACHE_QUEUE_ENTRY_HH__
 
+#include <cstdint>
+
 #include "base/named.hh"
 #include "base/types.hh"
 #include "mem/packet.hh"
@@ -76,6 +78,13 @@ class QueueEntry : public Packet::SenderState, public Named
     /** True if the entry is uncacheable */
     bool _isUncacheable;
 
+    /** Position of the entry in the ready list of its queue */
+    size_t readyIndex;
+
+    /** Time and sequence number ordering the entry in the ready list */
+    Tick readyKey;
+    int64_t readySeq;
+
   public:
     /**
      * A queue entry is holding packets that will be serviced as soon as
@@ -124,6 +133,7 @@ class QueueEntry : public Packet::SenderState, public Named
     QueueEntry(const std::string &name)
         : Named(name),
           readyTime(0), _isUncacheable(false),
+          readyIndex(0), readyKey(0), readySeq(0),
           inService(false), order(0), blkAddr(0), blkSize(0), isSecure(false)
     {}
 
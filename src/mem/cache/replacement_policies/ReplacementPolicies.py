@@ -55,6 +55,26 @@ class DuelingRP(BaseReplacementPolicy):
     )
 
 
+class MultiDuelingRP(BaseReplacementPolicy):
+    type = "MultiDuelingRP"
+    cxx_class = "gem5::replacement_policy::MultiDueling"
+    cxx_header = "mem/cache/replacement_policies/multi_dueling_rp.hh"
+
+    # Each constituency contains team_size samples of every policy, so
+    # constituency_size must be at least team_size times the number of
+    # policies
+    constituency_size = Param.Unsigned(
+        "The size of a region containing one sample of each policy"
+    )
+    team_size = Param.Unsigned(
+        "Number of entries in a sampling set that belong to a team"
+    )
+    num_bits = Param.Unsigned(10, "Number of bits of the miss counters")
+    replacement_policies = VectorParam.BaseReplacementPolicy(
+        "Sub-replacement policies dueling"
+    )
+
+
 class FIFORP(BaseReplacementPolicy):
     type = "FIFORP"
     cxx_class = "gem5::replacement_policy::FIFO"
@@ -164,6 +184,82 @@ class SHiPPCRP(SHiPRP):
     cxx_header = "mem/cache/replacement_policies/ship_rp.hh"
 
 
+class AdaptiveInsertionRP(BRRIPRP):
+    type = "AdaptiveInsertionRP"
+    cxx_class = "gem5::replacement_policy::AdaptiveInsertion"
+    cxx_header = "mem/cache/replacement_policies/adaptive_insertion_rp.hh"
+
+    # The dueling sets are chosen as for DuelingRP, with team_size
+    # samples of each throttle in every constituency
+    constituency_size = Param.Unsigned(
+        "The size of a region containing one sample of each throttle"
+    )
+    team_size = Param.Unsigned(
+        "Number of entries in a sampling set that belong to a team"
+    )
+    btps = VectorParam.Percent(
+        [100, 3], "Bimodal throttle of each team dueling"
+    )
+    num_selectors = Param.Unsigned(
+        1,
+        "Number of selectors; misses are accounted to the selector of "
+        "the context id of the access, modulo this number",
+    )
+    num_dueling_bits = Param.Unsigned(
+        10, "Number of bits of the miss counters"
+    )
+
+
+class TADRRIPRP(AdaptiveInsertionRP):
+    # Thread-aware DRRIP, dueling SRRIP and BRRIP insertions per core. As
+    # for DRRIPRP, constituency_size and team_size must be provided, and
+    # num_selectors should be set to the number of hardware contexts
+    btps = [100, 3]
+
+
+class HawkeyeRP(BaseReplacementPolicy):
+    type = "HawkeyeRP"
+    cxx_class = "gem5::replacement_policy::Hawkeye"
+    cxx_header = "mem/cache/replacement_policies/hawkeye_rp.hh"
+
+    num_bits = Param.Int(3, "Number of bits per RRPV")
+    predictor_size = Param.Unsigned(2048, "Number of predictor entries")
+    predictor_bits = Param.Unsigned(
+        3, "Number of bits of the predictor counters"
+    )
+    num_sampled_sets = Param.Unsigned(
+        64, "Number of sets whose accesses train the predictor"
+    )
+    history_multiplier = Param.Unsigned(
+        8, "Length of OPTgen's history, in multiples of the associativity"
+    )
+    cache_size = Param.MemorySize(Parent.size, "Size of the cache")
+    assoc = Param.Unsigned(Parent.assoc, "Associativity of the cache")
+    block_size = Param.Unsigned(
+        Parent.cache_line_size, "Block size of the cache in bytes"
+    )
+
+
+class MockingjayRP(BaseReplacementPolicy):
+    type = "MockingjayRP"
+    cxx_class = "gem5::replacement_policy::Mockingjay"
+    cxx_header = "mem/cache/replacement_policies/mockingjay_rp.hh"
+
+    predictor_size = Param.Unsigned(2048, "Number of predictor entries")
+    num_sampled_sets = Param.Unsigned(
+        32, "Number of sets whose accesses train the predictor"
+    )
+    history_multiplier = Param.Unsigned(
+        8,
+        "Longest reuse distance tracked, in multiples of the associativity",
+    )
+    cache_size = Param.MemorySize(Parent.size, "Size of the cache")
+    assoc = Param.Unsigned(Parent.assoc, "Associativity of the cache")
+    block_size = Param.Unsigned(
+        Parent.cache_line_size, "Block size of the cache in bytes"
+    )
+
+
 class TreePLRURP(BaseReplacementPolicy):
     type = "TreePLRURP"
     cxx_class = "gem5::replacement_policy::TreePLRU"
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/replacement_policies/adaptive_insertion_rp.hh"
+
+#include "base/logging.hh"
+#include "params/AdaptiveInsertionRP.hh"
+
+namespace gem5
+{
+
+namespace replacement_policy
+{
+
+AdaptiveInsertion::AdaptiveInsertion(const Params &p)
+  : BRRIP(p), btps(p.btps.begin(), p.btps.end()),
+    duelingMonitor(p.btps.size(), p.constituency_size, p.team_size,
+        p.num_selectors, p.num_dueling_bits),
+    insertionStats(this, p.btps.size())
+{
+}
+
+void
+AdaptiveInsertion::insert(
+    const std::shared_ptr<ReplacementData>& replacement_data,
+    unsigned selector)
+{
+    std::shared_ptr<AdaptiveInsertionReplData> casted_replacement_data =
+        std::static_pointer_cast<AdaptiveInsertionReplData>(
+            replacement_data);
+
+    // A miss in a set is a sample to the duel of the selector. Samples
+    // always use the throttle of their team, and the other entries use
+    // the one winning for the selector
+    const int team = casted_replacement_data->team;
+    duelingMonitor.sample(team, selector);
+    const unsigned selected = (team == MultiDuelingMonitor::NoTeam) ?
+        duelingMonitor.getWinner(selector) : team;
+    insertionStats.insertions[selected]++;
+
+    // Replacement data is inserted as "long re-reference" if lower than
+    // the selected btp, "distant re-reference" otherwise
+    casted_replacement_data->rrpv.saturate();
+    if (rng->random<unsigned>(1, 100) <= btps[selected]) {
+        casted_replacement_data->rrpv--;
+    }
+
+    // Mark entry as ready to be used
+    casted_replacement_data->valid = true;
+}
+
+void
+AdaptiveInsertion::reset(
+    const std::shared_ptr<ReplacementData>& replacement_data,
+    const PacketPtr pkt)
+{
+    const unsigned selector = pkt->req->hasContextId() ?
+        pkt->req->contextId() % duelingMonitor.getNumSelectors() : 0;
+    insert(replacement_data, selector);
+}
+
+void
+AdaptiveInsertion::reset(
+    const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    panic("Cant select the insertion of AdaptiveInsertion without access "
+          "information.");
+}
+
+std::shared_ptr<ReplacementData>
+AdaptiveInsertion::instantiateEntry()
+{
+    return std::shared_ptr<ReplacementData>(new AdaptiveInsertionReplData(
+        numRRPVBits, duelingMonitor.initEntry()));
+}
+
+AdaptiveInsertion::AdaptiveInsertionStats::AdaptiveInsertionStats(
+    statistics::Group* parent, std::size_t num_teams)
+  : statistics::Group(parent),
+    ADD_STAT(insertions, statistics::units::Count::get(),
+             "Number of insertions done with each bimodal throttle")
+{
+    insertions.init(num_teams);
+}
+
+} // namespace replacement_policy
+} // namespace gem5
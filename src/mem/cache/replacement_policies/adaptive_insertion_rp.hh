@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of an adaptive insertion policy, which duels the insertion
+ * of several bimodal RRIP policies with one selector per core, as in
+ * "Adaptive Insertion Policies for Managing Shared Caches", by Jaleel
+ * et al., and the thread-aware DRRIP of "High Performance Cache
+ * Replacement Using Re-Reference Interval Prediction (RRIP)".
+ */
+
+#ifndef __MEM_CACHE_REPLACEMENT_POLICIES_ADAPTIVE_INSERTION_RP_HH__
+#define __MEM_CACHE_REPLACEMENT_POLICIES_ADAPTIVE_INSERTION_RP_HH__
+
+#include <vector>
+
+#include "base/statistics.hh"
+#include "mem/cache/replacement_policies/brrip_rp.hh"
+#include "mem/cache/tags/dueling.hh"
+
+namespace gem5
+{
+
+struct AdaptiveInsertionRPParams;
+
+namespace replacement_policy
+{
+
+/**
+ * BRRIP whose insertion is chosen among several bimodal throttles by set
+ * dueling. Victimization is the same for all teams, so only insertions
+ * duel, which allows each core to follow its own winner: the misses of a
+ * core are accounted to its own selector, and its insertions in the
+ * follower sets use the throttle that wins for it.
+ */
+class AdaptiveInsertion : public BRRIP
+{
+  protected:
+    /** AdaptiveInsertion-specific implementation of replacement data. */
+    struct AdaptiveInsertionReplData : BRRIPReplData
+    {
+        /** Team of the entry, if it is a sample. */
+        const int team;
+
+        AdaptiveInsertionReplData(const int num_bits, int _team)
+          : BRRIPReplData(num_bits), team(_team)
+        {
+        }
+    };
+
+    /** Bimodal throttle of each team. */
+    const std::vector<unsigned> btps;
+
+    /** Monitor dueling the throttles, with a selector per core. */
+    MultiDuelingMonitor duelingMonitor;
+
+    struct AdaptiveInsertionStats : public statistics::Group
+    {
+        AdaptiveInsertionStats(statistics::Group* parent,
+            std::size_t num_teams);
+
+        /** Number of insertions done with each throttle. */
+        statistics::Vector insertions;
+    } insertionStats;
+
+    /**
+     * Insert an entry with the throttle of the given selector.
+     *
+     * @param replacement_data Replacement data to be reset.
+     * @param selector Selector of the core that caused the insertion.
+     */
+    void insert(const std::shared_ptr<ReplacementData>& replacement_data,
+        unsigned selector);
+
+  public:
+    typedef AdaptiveInsertionRPParams Params;
+    AdaptiveInsertion(const Params &p);
+    ~AdaptiveInsertion() = default;
+
+    /**
+     * Reset replacement data. Used when an entry is inserted. The miss is
+     * accounted to the selector of the core that caused it.
+     *
+     * @param replacement_data Replacement data to be reset.
+     * @param pkt Packet that generated this miss.
+     */
+    void reset(const std::shared_ptr<ReplacementData>& replacement_data,
+        const PacketPtr pkt) override;
+    void reset(const std::shared_ptr<ReplacementData>& replacement_data) const
+                                                                     override;
+
+    std::shared_ptr<ReplacementData> instantiateEntry() override;
+};
+
+} // namespace replacement_policy
+} // namespace gem5
+
+#endif // __MEM_CACHE_REPLACEMENT_POLICIES_ADAPTIVE_INSERTION_RP_HH__
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/replacement_policies/hawkeye_rp.hh"
+
+#include "base/logging.hh"
+#include "params/HawkeyeRP.hh"
+
+namespace gem5
+{
+
+namespace replacement_policy
+{
+
+Hawkeye::Hawkeye(const Params &p)
+  : Base(p), numRRPVBits(p.num_bits), assoc(p.assoc),
+    historyLength(p.history_multiplier * p.assoc),
+    sampler(p.cache_size, p.assoc, p.block_size, p.num_sampled_sets),
+    optGens(sampler.getNumSampled()),
+    predictor(p.predictor_size,
+        SatCounter8(p.predictor_bits, 1 << (p.predictor_bits - 1))),
+    hawkeyeStats(this)
+{
+    fatal_if(numRRPVBits < 2, "Hawkeye needs at least two bits per RRPV");
+    fatal_if(assoc == 0 || assoc > 255,
+        "Hawkeye needs an associativity between 1 and 255");
+    fatal_if(historyLength == 0, "OPTgen needs some history");
+    fatal_if(predictor.empty(), "The predictor needs at least one entry");
+
+    for (auto& opt_gen : optGens) {
+        opt_gen.occupancy.resize(historyLength, 0);
+    }
+}
+
+void
+Hawkeye::train(const PacketPtr pkt)
+{
+    const int64_t set = sampler.sampledSet(pkt->getAddr());
+    if (set < 0) {
+        return;
+    }
+
+    OptGen& opt_gen = optGens[set];
+    const uint64_t now = opt_gen.time++;
+    opt_gen.occupancy[now % historyLength] = 0;
+
+    // The optimal policy hits a reuse if the line fits in the set over
+    // its whole usage interval, in which case it holds the line during it
+    const Addr line = sampler.lineAddr(pkt->getAddr());
+    auto it = opt_gen.history.find(line);
+    if (it != opt_gen.history.end()) {
+        const Usage& usage = it->second;
+        bool opt_hit = (now - usage.time) < historyLength;
+        for (uint64_t t = usage.time; opt_hit && t < now; t++) {
+            opt_hit = opt_gen.occupancy[t % historyLength] < assoc;
+        }
+
+        if (opt_hit) {
+            for (uint64_t t = usage.time; t < now; t++) {
+                opt_gen.occupancy[t % historyLength]++;
+            }
+            predictor[usage.signature]++;
+            hawkeyeStats.optHits++;
+        } else {
+            predictor[usage.signature]--;
+            hawkeyeStats.optMisses++;
+        }
+    }
+    opt_gen.history[line] = {now, SetSampler::signature(pkt,
+        predictor.size())};
+
+    // Forget the usages that are too old to be reused within the history.
+    // At most history length lines are recent, so this is amortized
+    if (opt_gen.history.size() > 2 * historyLength) {
+        for (auto usage = opt_gen.history.begin();
+             usage != opt_gen.history.end();) {
+            if (now - usage->second.time >= historyLength) {
+                usage = opt_gen.history.erase(usage);
+            } else {
+                usage++;
+            }
+        }
+    }
+}
+
+void
+Hawkeye::access(const std::shared_ptr<ReplacementData>& replacement_data,
+    const PacketPtr pkt)
+{
+    std::shared_ptr<HawkeyeReplData> casted_replacement_data =
+        std::static_pointer_cast<HawkeyeReplData>(replacement_data);
+
+    train(pkt);
+
+    // Friendly lines are kept as long as possible, while averse lines are
+    // the first to go
+    const uint64_t signature = SetSampler::signature(pkt, predictor.size());
+    casted_replacement_data->signature = signature;
+    if (predictor[signature].calcSaturation() >= 0.5) {
+        casted_replacement_data->rrpv.reset();
+    } else {
+        casted_replacement_data->rrpv.saturate();
+    }
+}
+
+void
+Hawkeye::invalidate(const std::shared_ptr<ReplacementData>& replacement_data)
+{
+    std::static_pointer_cast<HawkeyeReplData>(replacement_data)->valid =
+        false;
+}
+
+void
+Hawkeye::touch(const std::shared_ptr<ReplacementData>& replacement_data,
+    const PacketPtr pkt)
+{
+    access(replacement_data, pkt);
+}
+
+void
+Hawkeye::touch(const std::shared_ptr<ReplacementData>& replacement_data)
+    const
+{
+    panic("Cant train Hawkeye's predictor without access information.");
+}
+
+void
+Hawkeye::reset(const std::shared_ptr<ReplacementData>& replacement_data,
+    const PacketPtr pkt)
+{
+    access(replacement_data, pkt);
+    std::static_pointer_cast<HawkeyeReplData>(replacement_data)->valid =
+        true;
+}
+
+void
+Hawkeye::reset(const std::shared_ptr<ReplacementData>& replacement_data)
+    const
+{
+    panic("Cant train Hawkeye's predictor without access information.");
+}
+
+ReplaceableEntry*
+Hawkeye::getVictim(const ReplacementCandidates& candidates) const
+{
+    // There must be at least one replacement candidate
+    assert(candidates.size() > 0);
+
+    // Prefer invalid entries, then averse entries, then the oldest
+    // friendly entry
+    ReplaceableEntry* victim = candidates[0];
+    int victim_rrpv = -1;
+    for (const auto& candidate : candidates) {
+        std::shared_ptr<HawkeyeReplData> candidate_repl_data =
+            std::static_pointer_cast<HawkeyeReplData>(
+                candidate->replacementData);
+
+        if (!candidate_repl_data->valid) {
+            return candidate;
+        }
+
+        const int candidate_rrpv = candidate_repl_data->rrpv;
+        if (candidate_rrpv > victim_rrpv) {
+            victim = candidate;
+            victim_rrpv = candidate_rrpv;
+        }
+    }
+
+    std::shared_ptr<HawkeyeReplData> victim_repl_data =
+        std::static_pointer_cast<HawkeyeReplData>(victim->replacementData);
+    if (!victim_repl_data->rrpv.isSaturated()) {
+        // The prediction of the PC was wrong, so detrain it
+        predictor[victim_repl_data->signature]--;
+        hawkeyeStats.friendlyEvictions++;
+    }
+
+    // The other friendly entries age, without becoming averse
+    const int max_friendly_rrpv = (1 << numRRPVBits) - 2;
+    for (const auto& candidate : candidates) {
+        std::shared_ptr<HawkeyeReplData> candidate_repl_data =
+            std::static_pointer_cast<HawkeyeReplData>(
+                candidate->replacementData);
+        if (candidate != victim &&
+            candidate_repl_data->rrpv < max_friendly_rrpv) {
+            candidate_repl_data->rrpv++;
+        }
+    }
+
+    return victim;
+}
+
+std::shared_ptr<ReplacementData>
+Hawkeye::instantiateEntry()
+{
+    return std::shared_ptr<ReplacementData>(new HawkeyeReplData(numRRPVBits));
+}
+
+Hawkeye::HawkeyeStats::HawkeyeStats(statistics::Group* parent)
+  : statistics::Group(parent),
+    ADD_STAT(optHits, statistics::units::Count::get(),
+             "Number of sampled reuses the optimal policy hits"),
+    ADD_STAT(optMisses, statistics::units::Count::get(),
+             "Number of sampled reuses the optimal policy misses"),
+    ADD_STAT(friendlyEvictions, statistics::units::Count::get(),
+             "Number of cache-friendly entries evicted")
+{
+}
+
+} // namespace replacement_policy
+} // namespace gem5
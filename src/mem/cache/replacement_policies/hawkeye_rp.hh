@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of the Hawkeye Replacement Policy, as described in "Back to
+ * the Future: Leveraging Belady's Algorithm for Improved Cache
+ * Replacement", by Jain and Lin.
+ */
+
+#ifndef __MEM_CACHE_REPLACEMENT_POLICIES_HAWKEYE_RP_HH__
+#define __MEM_CACHE_REPLACEMENT_POLICIES_HAWKEYE_RP_HH__
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "base/sat_counter.hh"
+#include "base/statistics.hh"
+#include "mem/cache/replacement_policies/base.hh"
+#include "mem/cache/replacement_policies/set_sampler.hh"
+
+namespace gem5
+{
+
+struct HawkeyeRPParams;
+
+namespace replacement_policy
+{
+
+/**
+ * Hawkeye learns which PCs insert lines that Belady's optimal policy
+ * would have kept. OPTgen reconstructs the decisions of the optimal
+ * policy on the accesses to a few sampled sets, and trains a table of
+ * counters indexed by the PC that last accessed each line: up when the
+ * optimal policy would have hit, down when it would have missed.
+ *
+ * Lines brought or hit by cache-friendly PCs get the nearest RRPV, and
+ * age as others are replaced, while cache-averse ones get the most
+ * distant RRPV. When no averse line is left the oldest friendly line is
+ * evicted, and its PC detrained.
+ */
+class Hawkeye : public Base
+{
+  protected:
+    /** Hawkeye-specific implementation of replacement data. */
+    struct HawkeyeReplData : ReplacementData
+    {
+        /** Re-Reference Interval Prediction Value. */
+        SatCounter8 rrpv;
+
+        /** Predictor entry of the last PC to access the entry. */
+        uint64_t signature;
+
+        /** Whether the entry is valid. */
+        bool valid;
+
+        HawkeyeReplData(const int num_bits)
+          : rrpv(num_bits), signature(0), valid(false)
+        {
+        }
+    };
+
+    /** A sampled access, as recorded by OPTgen. */
+    struct Usage
+    {
+        /** Time of the access, in accesses to its set. */
+        uint64_t time;
+
+        /** Predictor entry of the PC of the access. */
+        uint64_t signature;
+    };
+
+    /** Optimal policy reconstruction of a sampled set. */
+    struct OptGen
+    {
+        /** Number of accesses to the set so far. */
+        uint64_t time = 0;
+
+        /**
+         * Number of lines the optimal policy keeps in the set at each
+         * recent time, as a ring indexed by time.
+         */
+        std::vector<uint8_t> occupancy;
+
+        /** Last access to each recently accessed line. */
+        std::unordered_map<Addr, Usage> history;
+    };
+
+    /** Number of RRPV bits. */
+    const unsigned numRRPVBits;
+
+    /** Associativity of the cache, i.e., the capacity of OPTgen's sets. */
+    const unsigned assoc;
+
+    /**
+     * Number of accesses to a set over which OPTgen looks for reuses.
+     * Older reuses are seen as misses of the optimal policy.
+     */
+    const uint64_t historyLength;
+
+    /** Selection of the sets that train the predictor. */
+    const SetSampler sampler;
+
+    /** OPTgen of each sampled set. */
+    std::vector<OptGen> optGens;
+
+    /** Counters telling whether the lines of a PC are cache-friendly. */
+    mutable std::vector<SatCounter8> predictor;
+
+    struct HawkeyeStats : public statistics::Group
+    {
+        HawkeyeStats(statistics::Group* parent);
+
+        /** Sampled reuses the optimal policy would hit or miss. */
+        statistics::Scalar optHits;
+        statistics::Scalar optMisses;
+
+        /** Friendly lines evicted, which detrains their PC. */
+        statistics::Scalar friendlyEvictions;
+    };
+
+    mutable HawkeyeStats hawkeyeStats;
+
+    /**
+     * Train the predictor with an access to a sampled set, if sampled.
+     *
+     * @param pkt The access.
+     */
+    void train(const PacketPtr pkt);
+
+    /**
+     * Update the replacement data of an accessed entry with the
+     * prediction of its PC.
+     *
+     * @param replacement_data Replacement data to be updated.
+     * @param pkt The access.
+     */
+    void access(const std::shared_ptr<ReplacementData>& replacement_data,
+        const PacketPtr pkt);
+
+  public:
+    typedef HawkeyeRPParams Params;
+    Hawkeye(const Params &p);
+    ~Hawkeye() = default;
+
+    void invalidate(const std::shared_ptr<ReplacementData>& replacement_data)
+                                                                    override;
+    void touch(const std::shared_ptr<ReplacementData>& replacement_data,
+        const PacketPtr pkt) override;
+    void touch(const std::shared_ptr<ReplacementData>& replacement_data) const
+                                                                     override;
+    void reset(const std::shared_ptr<ReplacementData>& replacement_data,
+        const PacketPtr pkt) override;
+    void reset(const std::shared_ptr<ReplacementData>& replacement_data) const
+                                                                     override;
+    ReplaceableEntry* getVictim(const ReplacementCandidates& candidates) const
+                                                                     override;
+    std::shared_ptr<ReplacementData> instantiateEntry() override;
+};
+
+} // namespace replacement_policy
+} // namespace gem5
+
+#endif // __MEM_CACHE_REPLACEMENT_POLICIES_HAWKEYE_RP_HH__
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/replacement_policies/mockingjay_rp.hh"
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+
+#include "base/logging.hh"
+#include "params/MockingjayRP.hh"
+
+namespace gem5
+{
+
+namespace replacement_policy
+{
+
+namespace
+{
+
+/** Expected use of the lines predicted not to be reused. */
+constexpr int64_t NeverUsed = std::numeric_limits<int64_t>::max() / 2;
+
+} // anonymous namespace
+
+Mockingjay::Mockingjay(const Params &p)
+  : Base(p),
+    sampler(p.cache_size, p.assoc, p.block_size, p.num_sampled_sets),
+    maxReuseDistance(p.history_multiplier * p.assoc),
+    sampledSets(sampler.getNumSampled()),
+    predictor(p.predictor_size, -1),
+    mockingjayStats(this)
+{
+    fatal_if(maxReuseDistance == 0, "Mockingjay needs some history");
+    fatal_if(predictor.empty(), "The predictor needs at least one entry");
+}
+
+void
+Mockingjay::train(uint64_t signature, int64_t distance)
+{
+    int64_t& prediction = predictor[signature];
+    if (prediction < 0) {
+        prediction = distance;
+        return;
+    }
+
+    // Move an eighth of the way towards the observation, and at least one
+    const int64_t diff = distance - prediction;
+    int64_t step = diff / 8;
+    if (step == 0) {
+        step = (diff > 0) - (diff < 0);
+    }
+    prediction = std::min(prediction + step, maxReuseDistance + 1);
+}
+
+void
+Mockingjay::sample(const PacketPtr pkt)
+{
+    const int64_t set = sampler.sampledSet(pkt->getAddr());
+    if (set < 0) {
+        return;
+    }
+
+    SampledSet& sampled_set = sampledSets[set];
+    const uint64_t now = sampled_set.time++;
+
+    const Addr line = sampler.lineAddr(pkt->getAddr());
+    auto it = sampled_set.history.find(line);
+    if (it != sampled_set.history.end()) {
+        const int64_t distance = now - it->second.time;
+        if (distance <= maxReuseDistance) {
+            train(it->second.signature, distance);
+            mockingjayStats.sampledReuses++;
+        } else {
+            train(it->second.signature, maxReuseDistance + 1);
+            mockingjayStats.sampledDeadLines++;
+        }
+    }
+    sampled_set.history[line] = {now, SetSampler::signature(pkt,
+        predictor.size())};
+
+    // Lines not reused within the history are dead. At most the maximum
+    // reuse distance lines are recent, so this is amortized
+    if (sampled_set.history.size() > 2 * (maxReuseDistance + 1)) {
+        for (auto usage = sampled_set.history.begin();
+             usage != sampled_set.history.end();) {
+            if (int64_t(now - usage->second.time) > maxReuseDistance) {
+                train(usage->second.signature, maxReuseDistance + 1);
+                mockingjayStats.sampledDeadLines++;
+                usage = sampled_set.history.erase(usage);
+            } else {
+                usage++;
+            }
+        }
+    }
+}
+
+void
+Mockingjay::access(const std::shared_ptr<ReplacementData>& replacement_data,
+    const PacketPtr pkt)
+{
+    std::shared_ptr<MockingjayReplData> casted_replacement_data =
+        std::static_pointer_cast<MockingjayReplData>(replacement_data);
+
+    sample(pkt);
+    time++;
+
+    // PCs not seen yet are predicted a long reuse distance
+    int64_t prediction =
+        predictor[SetSampler::signature(pkt, predictor.size())];
+    if (prediction < 0) {
+        prediction = maxReuseDistance;
+    }
+
+    if (prediction > maxReuseDistance) {
+        casted_replacement_data->expectedUse = NeverUsed;
+        mockingjayStats.deadPredictions++;
+    } else {
+        casted_replacement_data->expectedUse =
+            time + prediction * int64_t(sampler.getNumSets());
+    }
+}
+
+void
+Mockingjay::invalidate(
+    const std::shared_ptr<ReplacementData>& replacement_data)
+{
+    std::static_pointer_cast<MockingjayReplData>(replacement_data)->valid =
+        false;
+}
+
+void
+Mockingjay::touch(const std::shared_ptr<ReplacementData>& replacement_data,
+    const PacketPtr pkt)
+{
+    access(replacement_data, pkt);
+}
+
+void
+Mockingjay::touch(const std::shared_ptr<ReplacementData>& replacement_data)
+    const
+{
+    panic("Cant train Mockingjay's predictor without access information.");
+}
+
+void
+Mockingjay::reset(const std::shared_ptr<ReplacementData>& replacement_data,
+    const PacketPtr pkt)
+{
+    access(replacement_data, pkt);
+    std::static_pointer_cast<MockingjayReplData>(replacement_data)->valid =
+        true;
+}
+
+void
+Mockingjay::reset(const std::shared_ptr<ReplacementData>& replacement_data)
+    const
+{
+    panic("Cant train Mockingjay's predictor without access information.");
+}
+
+ReplaceableEntry*
+Mockingjay::getVictim(const ReplacementCandidates& candidates) const
+{
+    // There must be at least one replacement candidate
+    assert(candidates.size() > 0);
+
+    // Evict the entry with the largest estimated time remaining, in
+    // absolute value, preferring the overdue ones on ties
+    ReplaceableEntry* victim = nullptr;
+    int64_t victim_etr = 0;
+    for (const auto& candidate : candidates) {
+        std::shared_ptr<MockingjayReplData> candidate_repl_data =
+            std::static_pointer_cast<MockingjayReplData>(
+                candidate->replacementData);
+
+        // Stop searching for victims if an invalid entry is found
+        if (!candidate_repl_data->valid) {
+            return candidate;
+        }
+
+        const int64_t etr = candidate_repl_data->expectedUse - time;
+        if (victim == nullptr || std::abs(etr) > std::abs(victim_etr) ||
+            (std::abs(etr) == std::abs(victim_etr) && etr < 0)) {
+            victim = candidate;
+            victim_etr = etr;
+        }
+    }
+
+    return victim;
+}
+
+std::shared_ptr<ReplacementData>
+Mockingjay::instantiateEntry()
+{
+    return std::shared_ptr<ReplacementData>(new MockingjayReplData());
+}
+
+Mockingjay::MockingjayStats::MockingjayStats(statistics::Group* parent)
+  : statistics::Group(parent),
+    ADD_STAT(sampledReuses, statistics::units::Count::get(),
+             "Number of sampled reuses within the history"),
+    ADD_STAT(sampledDeadLines, statistics::units::Count::get(),
+             "Number of sampled lines not reused within the history"),
+    ADD_STAT(deadPredictions, statistics::units::Count::get(),
+             "Number of accesses predicted not to be reused")
+{
+}
+
+} // namespace replacement_policy
+} // namespace gem5
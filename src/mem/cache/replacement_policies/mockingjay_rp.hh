@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of the Mockingjay Replacement Policy, as described in
+ * "Effective Mimicry of Belady's MIN Policy", by Shah, Jain and Lin.
+ */
+
+#ifndef __MEM_CACHE_REPLACEMENT_POLICIES_MOCKINGJAY_RP_HH__
+#define __MEM_CACHE_REPLACEMENT_POLICIES_MOCKINGJAY_RP_HH__
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "mem/cache/replacement_policies/base.hh"
+#include "mem/cache/replacement_policies/set_sampler.hh"
+
+namespace gem5
+{
+
+struct MockingjayRPParams;
+
+namespace replacement_policy
+{
+
+/**
+ * Mockingjay predicts the reuse distance of the lines of each PC, and
+ * evicts the line whose next use is the furthest away, mimicking
+ * Belady's optimal policy. The reuse distances of the lines of a few
+ * sampled sets, in accesses to their set, train the prediction of the
+ * PC that last accessed them; lines not reused within the history train
+ * it towards an infinite distance.
+ *
+ * Each line keeps the time it is expected to be used again, and the
+ * victim is the line with the largest estimated time remaining (ETR) in
+ * absolute value, so lines long overdue go too. Lines predicted not to
+ * be reused at all are inserted as the next victim, as replacement
+ * policies cannot bypass the cache. Time is counted in accesses seen by
+ * the policy, and one access to a set is worth as many as there are
+ * sets.
+ */
+class Mockingjay : public Base
+{
+  protected:
+    /** Mockingjay-specific implementation of replacement data. */
+    struct MockingjayReplData : ReplacementData
+    {
+        /** Time at which the entry is expected to be used again. */
+        int64_t expectedUse = 0;
+
+        /** Whether the entry is valid. */
+        bool valid = false;
+    };
+
+    /** A sampled access. */
+    struct Usage
+    {
+        /** Time of the access, in accesses to its set. */
+        uint64_t time;
+
+        /** Predictor entry of the PC of the access. */
+        uint64_t signature;
+    };
+
+    /** Sampled accesses of a set. */
+    struct SampledSet
+    {
+        /** Number of accesses to the set so far. */
+        uint64_t time = 0;
+
+        /** Last access to each recently accessed line. */
+        std::unordered_map<Addr, Usage> history;
+    };
+
+    /** Selection of the sets that train the predictor. */
+    const SetSampler sampler;
+
+    /**
+     * Longest reuse distance tracked, in accesses to a set. Longer
+     * distances are infinite.
+     */
+    const int64_t maxReuseDistance;
+
+    /** Sampled accesses of each sampled set. */
+    std::vector<SampledSet> sampledSets;
+
+    /** Reuse distance predicted for each PC, -1 until trained. */
+    std::vector<int64_t> predictor;
+
+    /** Number of accesses seen so far. */
+    int64_t time = 0;
+
+    struct MockingjayStats : public statistics::Group
+    {
+        MockingjayStats(statistics::Group* parent);
+
+        /** Sampled reuses within the history, and lines not reused. */
+        statistics::Scalar sampledReuses;
+        statistics::Scalar sampledDeadLines;
+
+        /** Accesses whose lines are predicted not to be reused. */
+        statistics::Scalar deadPredictions;
+    } mockingjayStats;
+
+    /**
+     * Move the prediction of a PC towards an observed reuse distance.
+     *
+     * @param signature Predictor entry of the PC.
+     * @param distance The reuse distance, beyond the maximum if infinite.
+     */
+    void train(uint64_t signature, int64_t distance);
+
+    /**
+     * Train the predictor with an access to a sampled set, if sampled.
+     *
+     * @param pkt The access.
+     */
+    void sample(const PacketPtr pkt);
+
+    /**
+     * Update the replacement data of an accessed entry with the
+     * prediction of its PC.
+     *
+     * @param replacement_data Replacement data to be updated.
+     * @param pkt The access.
+     */
+    void access(const std::shared_ptr<ReplacementData>& replacement_data,
+        const PacketPtr pkt);
+
+  public:
+    typedef MockingjayRPParams Params;
+    Mockingjay(const Params &p);
+    ~Mockingjay() = default;
+
+    void invalidate(const std::shared_ptr<ReplacementData>& replacement_data)
+                                                                    override;
+    void touch(const std::shared_ptr<ReplacementData>& replacement_data,
+        const PacketPtr pkt) override;
+    void touch(const std::shared_ptr<ReplacementData>& replacement_data) const
+                                                                     override;
+    void reset(const std::shared_ptr<ReplacementData>& replacement_data,
+        const PacketPtr pkt) override;
+    void reset(const std::shared_ptr<ReplacementData>& replacement_data) const
+                                                                     override;
+    ReplaceableEntry* getVictim(const ReplacementCandidates& candidates) const
+                                                                     override;
+    std::shared_ptr<ReplacementData> instantiateEntry() override;
+};
+
+} // namespace replacement_policy
+} // namespace gem5
+
+#endif // __MEM_CACHE_REPLACEMENT_POLICIES_MOCKINGJAY_RP_HH__
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/replacement_policies/multi_dueling_rp.hh"
+
+#include "base/logging.hh"
+#include "params/MultiDuelingRP.hh"
+
+namespace gem5
+{
+
+namespace replacement_policy
+{
+
+MultiDueling::MultiDueling(const Params &p)
+  : Base(p), replPolicies(p.replacement_policies),
+    duelingMonitor(p.replacement_policies.size(), p.constituency_size,
+        p.team_size, 1, p.num_bits),
+    duelingStats(this, p.replacement_policies.size())
+{
+    for (const auto* repl_policy : replPolicies) {
+        fatal_if(repl_policy == nullptr,
+            "All replacement policies must be instantiated");
+    }
+}
+
+void
+MultiDueling::invalidate(
+    const std::shared_ptr<ReplacementData>& replacement_data)
+{
+    std::shared_ptr<MultiDuelerReplData> casted_replacement_data =
+        std::static_pointer_cast<MultiDuelerReplData>(replacement_data);
+    for (int i = 0; i < replPolicies.size(); i++) {
+        replPolicies[i]->invalidate(casted_replacement_data->replData[i]);
+    }
+}
+
+void
+MultiDueling::touch(const std::shared_ptr<ReplacementData>& replacement_data,
+    const PacketPtr pkt)
+{
+    std::shared_ptr<MultiDuelerReplData> casted_replacement_data =
+        std::static_pointer_cast<MultiDuelerReplData>(replacement_data);
+    for (int i = 0; i < replPolicies.size(); i++) {
+        replPolicies[i]->touch(casted_replacement_data->replData[i], pkt);
+    }
+}
+
+void
+MultiDueling::touch(
+    const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    std::shared_ptr<MultiDuelerReplData> casted_replacement_data =
+        std::static_pointer_cast<MultiDuelerReplData>(replacement_data);
+    for (int i = 0; i < replPolicies.size(); i++) {
+        replPolicies[i]->touch(casted_replacement_data->replData[i]);
+    }
+}
+
+void
+MultiDueling::reset(const std::shared_ptr<ReplacementData>& replacement_data,
+    const PacketPtr pkt)
+{
+    std::shared_ptr<MultiDuelerReplData> casted_replacement_data =
+        std::static_pointer_cast<MultiDuelerReplData>(replacement_data);
+    for (int i = 0; i < replPolicies.size(); i++) {
+        replPolicies[i]->reset(casted_replacement_data->replData[i], pkt);
+    }
+
+    // A miss in a set is a sample to the duel, as in Dueling
+    duelingMonitor.sample(casted_replacement_data->team);
+}
+
+void
+MultiDueling::reset(
+    const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    std::shared_ptr<MultiDuelerReplData> casted_replacement_data =
+        std::static_pointer_cast<MultiDuelerReplData>(replacement_data);
+    for (int i = 0; i < replPolicies.size(); i++) {
+        replPolicies[i]->reset(casted_replacement_data->replData[i]);
+    }
+
+    duelingMonitor.sample(casted_replacement_data->team);
+}
+
+ReplaceableEntry*
+MultiDueling::getVictim(const ReplacementCandidates& candidates) const
+{
+    // This function assumes that all candidates are either part of the same
+    // sampled set, or are not samples, as in Dueling
+    panic_if(candidates.size() != params().team_size, "We currently only "
+        "support team sizes that match the number of replacement candidates");
+
+    // Samples always use their own policy, and the other entries use the
+    // policy that is winning the duel
+    const int team = std::static_pointer_cast<MultiDuelerReplData>(
+        candidates[0]->replacementData)->team;
+    const unsigned selected = (team == MultiDuelingMonitor::NoTeam) ?
+        duelingMonitor.getWinner() : team;
+    duelingStats.selected[selected]++;
+
+    // Re-route the replacement data of the candidates to the one of the
+    // selected policy
+    std::vector<std::shared_ptr<ReplacementData>> dueling_replacement_data;
+    for (auto& candidate : candidates) {
+        std::shared_ptr<MultiDuelerReplData> dueler_repl_data =
+            std::static_pointer_cast<MultiDuelerReplData>(
+            candidate->replacementData);
+        panic_if(dueler_repl_data->team != team,
+            "Not all sampled candidates belong to the same team");
+
+        dueling_replacement_data.push_back(dueler_repl_data);
+        candidate->replacementData = dueler_repl_data->replData[selected];
+    }
+
+    ReplaceableEntry* victim = replPolicies[selected]->getVictim(candidates);
+
+    // Restore the original replacement data
+    for (int i = 0; i < candidates.size(); i++) {
+        candidates[i]->replacementData = dueling_replacement_data[i];
+    }
+
+    return victim;
+}
+
+std::shared_ptr<ReplacementData>
+MultiDueling::instantiateEntry()
+{
+    MultiDuelerReplData* replacement_data =
+        new MultiDuelerReplData(duelingMonitor.initEntry());
+    for (auto* repl_policy : replPolicies) {
+        replacement_data->replData.push_back(
+            repl_policy->instantiateEntry());
+    }
+    return std::shared_ptr<MultiDuelerReplData>(replacement_data);
+}
+
+MultiDueling::MultiDuelingStats::MultiDuelingStats(
+    statistics::Group* parent, std::size_t num_teams)
+  : statistics::Group(parent),
+    ADD_STAT(selected, statistics::units::Count::get(),
+             "Number of times each policy was selected to victimize")
+{
+    selected.init(num_teams);
+}
+
+} // namespace replacement_policy
+} // namespace gem5
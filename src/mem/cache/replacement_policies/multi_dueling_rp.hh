@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_CACHE_REPLACEMENT_POLICIES_MULTI_DUELING_RP_HH__
+#define __MEM_CACHE_REPLACEMENT_POLICIES_MULTI_DUELING_RP_HH__
+
+#include <memory>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "mem/cache/replacement_policies/base.hh"
+#include "mem/cache/tags/dueling.hh"
+
+namespace gem5
+{
+
+struct MultiDuelingRPParams;
+
+namespace replacement_policy
+{
+
+/**
+ * This replacement policy duels any number of replacement policies to find
+ * out which one provides the best results, i.e., the fewest misses. Each
+ * sub-policy owns a few sampled sets, which always use it, and the other
+ * sets follow the policy whose samples miss the least.
+ *
+ * As victims are chosen without knowing who caused the miss, a single
+ * selector is used; see AdaptiveInsertion for per-core selection.
+ */
+class MultiDueling : public Base
+{
+  protected:
+    /**
+     * MultiDueling-specific implementation of replacement data. Contains
+     * all sub-replacement policies' replacement data.
+     */
+    struct MultiDuelerReplData : ReplacementData
+    {
+        std::vector<std::shared_ptr<ReplacementData>> replData;
+
+        /** Team of the entry, if it is a sample. */
+        const int team;
+
+        MultiDuelerReplData(int _team) : ReplacementData(), team(_team) {}
+    };
+
+    /** Sub-replacement policies dueling. */
+    const std::vector<Base*> replPolicies;
+
+    /**
+     * A dueling monitor that decides which is the best sub-policy based on
+     * their number of misses.
+     */
+    mutable MultiDuelingMonitor duelingMonitor;
+
+    mutable struct MultiDuelingStats : public statistics::Group
+    {
+        MultiDuelingStats(statistics::Group* parent, std::size_t num_teams);
+
+        /** Number of times each sub-policy was selected on victimization. */
+        statistics::Vector selected;
+    } duelingStats;
+
+  public:
+    PARAMS(MultiDuelingRP);
+    MultiDueling(const Params &p);
+    ~MultiDueling() = default;
+
+    void invalidate(const std::shared_ptr<ReplacementData>& replacement_data)
+                                                                    override;
+    void touch(const std::shared_ptr<ReplacementData>& replacement_data,
+        const PacketPtr pkt) override;
+    void touch(const std::shared_ptr<ReplacementData>& replacement_data) const
+                                                                     override;
+    void reset(const std::shared_ptr<ReplacementData>& replacement_data,
+        const PacketPtr pkt) override;
+    void reset(const std::shared_ptr<ReplacementData>& replacement_data) const
+                                                                     override;
+    ReplaceableEntry* getVictim(const ReplacementCandidates& candidates) const
+                                                                     override;
+    std::shared_ptr<ReplacementData> instantiateEntry() override;
+};
+
+} // namespace replacement_policy
+} // namespace gem5
+
+#endif // __MEM_CACHE_REPLACEMENT_POLICIES_MULTI_DUELING_RP_HH__
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_CACHE_REPLACEMENT_POLICIES_SET_SAMPLER_HH__
+#define __MEM_CACHE_REPLACEMENT_POLICIES_SET_SAMPLER_HH__
+
+#include <algorithm>
+#include <cstdint>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "base/types.hh"
+#include "mem/packet.hh"
+
+namespace gem5
+{
+
+namespace replacement_policy
+{
+
+/**
+ * Selects the sets of a cache whose accesses train the predictor of a
+ * replacement policy, as the sampled sets of Hawkeye and Mockingjay.
+ * Replacement policies do not know how their entries are indexed, so the
+ * sets are those of the default modulo indexing of set associative tags.
+ */
+class SetSampler
+{
+  private:
+    /** Number of bits of the offset within a block. */
+    const unsigned blkOffsetBits;
+
+    /** Number of sets of the cache. */
+    const uint64_t numSets;
+
+    /** One set out of this many is sampled. */
+    const uint64_t interval;
+
+  public:
+    SetSampler(uint64_t cache_size, unsigned assoc, unsigned block_size,
+        unsigned num_sampled_sets)
+      : blkOffsetBits(floorLog2(block_size)),
+        numSets(cache_size / (uint64_t(assoc) * block_size)),
+        interval(std::max<uint64_t>(1, numSets /
+            std::max(1u, num_sampled_sets)))
+    {
+        fatal_if(!isPowerOf2(block_size),
+            "The block size must be a power of two");
+        fatal_if(numSets == 0, "The cache must have at least one set");
+    }
+
+    /** Get the address of the block holding an address. */
+    Addr lineAddr(Addr addr) const { return addr >> blkOffsetBits; }
+
+    /** Get the number of sets of the cache. */
+    uint64_t getNumSets() const { return numSets; }
+
+    /** Get the number of sets sampled. */
+    uint64_t getNumSampled() const { return divCeil(numSets, interval); }
+
+    /**
+     * Get the sampled set holding an address.
+     *
+     * @param addr The address.
+     * @return The index of the sampled set, -1 if its set is not sampled.
+     */
+    int64_t
+    sampledSet(Addr addr) const
+    {
+        const uint64_t set = lineAddr(addr) % numSets;
+        return (set % interval) ? -1 : set / interval;
+    }
+
+    /**
+     * Get the predictor entry of the PC of an access. Accesses without a
+     * PC, e.g. prefetches and writebacks, share the first entry.
+     *
+     * @param pkt The access.
+     * @param num_entries The number of entries of the predictor.
+     * @return The index of the entry.
+     */
+    static uint64_t
+    signature(const PacketPtr pkt, uint64_t num_entries)
+    {
+        if (!pkt->req->hasPC()) {
+            return 0;
+        }
+        const Addr pc = pkt->req->getPC();
+        return (pc ^ (pc >> 2) ^ (pc >> 12)) % num_entries;
+    }
+};
+
+} // namespace replacement_policy
+} // namespace gem5
+
+#endif // __MEM_CACHE_REPLACEMENT_POLICIES_SET_SAMPLER_HH__
@@ -138,4 +138,69 @@ DuelingMonitor::initEntry(Dueler* dueler)
     }
 }
 
+MultiDuelingMonitor::MultiDuelingMonitor(unsigned num_teams,
+    std::size_t constituency_size, std::size_t team_size,
+    unsigned num_selectors, unsigned num_bits)
+  : numTeams(num_teams), constituencySize(constituency_size),
+    teamSize(team_size), regionCounter(0),
+    misses(num_teams * num_selectors, SatCounter32(num_bits)),
+    winners(num_selectors, 0)
+{
+    fatal_if(numTeams < 2, "There must be at least two dueling teams");
+    fatal_if(teamSize == 0, "There must be at least one entry per team");
+    fatal_if(constituencySize < (numTeams * teamSize),
+        "There must be at least team size entries per team in a constituency");
+    fatal_if(num_selectors == 0, "There must be at least one selector");
+}
+
+int
+MultiDuelingMonitor::initEntry()
+{
+    // The first entries of the constituency are split among the teams,
+    // in order
+    int team = NoTeam;
+    if (regionCounter < numTeams * teamSize) {
+        team = regionCounter / teamSize;
+    }
+
+    // Check if we changed constituencies
+    if (++regionCounter >= constituencySize) {
+        regionCounter = 0;
+    }
+
+    return team;
+}
+
+void
+MultiDuelingMonitor::sample(int team, unsigned selector)
+{
+    if (team == NoTeam) {
+        return;
+    }
+    assert(team < numTeams && selector < winners.size());
+
+    SatCounter32* counters = &misses[selector * numTeams];
+    counters[team]++;
+    if (counters[team].isSaturated()) {
+        for (unsigned i = 0; i < numTeams; i++) {
+            counters[i] >>= 1;
+        }
+    }
+
+    // The winner only changes when another team has strictly fewer misses
+    unsigned& winner = winners[selector];
+    for (unsigned i = 0; i < numTeams; i++) {
+        if (counters[i] < counters[winner]) {
+            winner = i;
+        }
+    }
+}
+
+unsigned
+MultiDuelingMonitor::getWinner(unsigned selector) const
+{
+    assert(selector < winners.size());
+    return winners[selector];
+}
+
 } // namespace gem5
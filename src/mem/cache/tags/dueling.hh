@@ -31,6 +31,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
 #include "base/sat_counter.hh"
 
@@ -204,6 +205,86 @@ class DuelingMonitor
     void initEntry(Dueler* dueler);
 };
 
+/**
+ * Duel between any number of sampled options. Each constituency contains
+ * the samples of every team: the first team size entries belong to the
+ * first team, the next ones to the second team, and so on. Every team
+ * has a miss counter, which is increased whenever one of its samples is
+ * sampled, and the team with the fewest misses is the winner. When a
+ * counter saturates all the counters are halved, so that recent misses
+ * weigh more than old ones.
+ *
+ * The counters can be replicated in selectors, so that independent
+ * agents sharing the table, e.g. the cores sharing a cache, each pick
+ * their own winner from their own misses in the shared samples. This is
+ * the thread-aware set dueling of "Adaptive Insertion Policies for
+ * Managing Shared Caches".
+ *
+ * As the number of teams is not bound to a bit, the team of an entry is
+ * not kept in a Dueler: initEntry() provides it, and the entry keeps it.
+ */
+class MultiDuelingMonitor
+{
+  private:
+    /** Number of teams dueling. */
+    const unsigned numTeams;
+
+    /** Number of entries in a region containing one sample of each team. */
+    const std::size_t constituencySize;
+
+    /** Number of entries that belong to each team within a constituency. */
+    const std::size_t teamSize;
+
+    /**
+     * Counts the number of entries have been initialized in the current
+     * constituency.
+     */
+    std::size_t regionCounter;
+
+    /** Miss counters of the teams, indexed by selector and team. */
+    std::vector<SatCounter32> misses;
+
+    /** The team that is currently winning, for each selector. */
+    std::vector<unsigned> winners;
+
+  public:
+    /** Team of the entries that are not samples. */
+    static constexpr int NoTeam = -1;
+
+    MultiDuelingMonitor(unsigned num_teams, std::size_t constituency_size,
+        std::size_t team_size = 1, unsigned num_selectors = 1,
+        unsigned num_bits = 10);
+    ~MultiDuelingMonitor() = default;
+
+    /**
+     * Get the team of the next entry of the table, deciding whether it is
+     * a sample or not. Entries must be initialized in table order.
+     *
+     * @return The team of the entry, NoTeam if it is not a sample.
+     */
+    int initEntry();
+
+    /**
+     * Account for a miss in a sample, and check if the winning team of the
+     * selector must be updated.
+     *
+     * @param team The team of the entry, may be NoTeam.
+     * @param selector The selector the miss is accounted to.
+     */
+    void sample(int team, unsigned selector = 0);
+
+    /**
+     * Get the team that is currently winning the duel of a selector.
+     *
+     * @param selector The selector.
+     * @return Winning team.
+     */
+    unsigned getWinner(unsigned selector = 0) const;
+
+    /** Get the number of selectors. */
+    unsigned getNumSelectors() const { return winners.size(); }
+};
+
 } // namespace gem5
 
 #endif // __BASE_DUELING_HH__
@@ -260,3 +260,71 @@ INSTANTIATE_TEST_CASE_P(DuelingMonitorTests, DuelingMonitorTest,
         // Test for larger tables
         std::make_tuple(2048, 32, 4, 4, 0.4, 0.6))
 );
+
+/**
+ * Test whether the multi-team monitor creates exactly the amount of samples
+ * requested for each team.
+ */
+TEST(MultiDuelingMonitorTest, CountSamples)
+{
+    const unsigned num_teams = 3;
+    const std::size_t constituency_size = 16;
+    const std::size_t team_size = 2;
+    const std::size_t num_entries = 256;
+    MultiDuelingMonitor monitor(num_teams, constituency_size, team_size);
+
+    std::vector<int> count_samples(num_teams, 0);
+    for (std::size_t index = 0; index < num_entries; index++) {
+        const int team = monitor.initEntry();
+        const std::size_t region_index = index % constituency_size;
+        if (region_index < num_teams * team_size) {
+            ASSERT_EQ(team, region_index / team_size);
+            count_samples[team]++;
+        } else {
+            ASSERT_EQ(team, MultiDuelingMonitor::NoTeam);
+        }
+    }
+
+    for (int count : count_samples) {
+        ASSERT_EQ(count, (num_entries / constituency_size) * team_size);
+    }
+}
+
+/**
+ * Test that the team with the fewest misses wins, independently for each
+ * selector, and that saturating a counter does not change the winner.
+ */
+TEST(MultiDuelingMonitorTest, WinnerSelection)
+{
+    const unsigned num_teams = 4;
+    const unsigned num_selectors = 2;
+    const unsigned num_bits = 4;
+    MultiDuelingMonitor monitor(num_teams, 8, 1, num_selectors, num_bits);
+    ASSERT_EQ(monitor.getNumSelectors(), num_selectors);
+
+    // Ties keep the current winner
+    for (unsigned selector = 0; selector < num_selectors; selector++) {
+        ASSERT_EQ(monitor.getWinner(selector), 0);
+    }
+
+    // Misses of the winner hand the duel over to the next team
+    monitor.sample(0, 0);
+    ASSERT_EQ(monitor.getWinner(0), 1);
+    ASSERT_EQ(monitor.getWinner(1), 0);
+
+    // Followers do not take part in the duel
+    for (int i = 0; i < 100; i++) {
+        monitor.sample(MultiDuelingMonitor::NoTeam, 0);
+    }
+    ASSERT_EQ(monitor.getWinner(0), 1);
+
+    // Make every team but the last one miss in selector 1, going past the
+    // saturation of the counters
+    for (int i = 0; i < 100; i++) {
+        for (unsigned team = 0; team < num_teams - 1; team++) {
+            monitor.sample(team, 1);
+        }
+    }
+    ASSERT_EQ(monitor.getWinner(1), num_teams - 1);
+    ASSERT_EQ(monitor.getWinner(0), 1);
+}
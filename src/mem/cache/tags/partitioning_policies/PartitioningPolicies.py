@@ -115,3 +115,37 @@ class MaxCapacityPartitioningPolicy(BasePartitioningPolicy):
         "Format: [<max_capacity>,<max_capacity>,...]"
         "Example: [0.5, 0.75]"
     )
+
+
+class UtilityMonitor(SimObject):
+    type = "UtilityMonitor"
+    cxx_header = "mem/cache/tags/partitioning_policies/utility_monitor.hh"
+    cxx_class = "gem5::partitioning_policy::UtilityMonitor"
+
+    num_partitions = Param.Unsigned(
+        "Number of partitions monitored; the PartitionIDs, or requestor "
+        "IDs, of the accesses must be below this number"
+    )
+    requestor_partitions = Param.Bool(
+        False,
+        "Identify the partitions by requestor instead of by PartitionID",
+    )
+    partitioning_manager = Param.PartitionManager(
+        Parent.partitioning_manager,
+        "Manager providing the PartitionID of the accesses",
+    )
+    partitioning_policy = Param.WayPartitioningPolicy(
+        NULL,
+        "Policy whose ways are reallocated among PartitionIDs 0 to "
+        "num_partitions - 1 every epoch",
+    )
+    epoch = Param.Latency(
+        "0", "Length of an epoch; 0 disables the decay of the counters"
+    )
+    num_sampled_sets = Param.Unsigned(
+        32, "Number of sets of the auxiliary tag directories"
+    )
+
+    cache_size = Param.MemorySize(Parent.size, "Cache size in bytes")
+    assoc = Param.Unsigned(Parent.assoc, "Associativity")
+    block_size = Param.Int(Parent.cache_line_size, "Block size in bytes")
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/tags/partitioning_policies/utility_curves.hh"
+
+#include <algorithm>
+#include <cassert>
+
+namespace gem5
+{
+
+namespace partitioning_policy
+{
+
+UtilityCurves::UtilityCurves(unsigned num_partitions, unsigned _assoc,
+                             unsigned num_sets)
+  : numPartitions(num_partitions), assoc(_assoc),
+    atds(num_sets * num_partitions), hits(num_partitions * assoc, 0),
+    accesses(num_partitions, 0)
+{
+}
+
+unsigned
+UtilityCurves::access(unsigned partition_id, unsigned set, Addr line)
+{
+    assert(partition_id < numPartitions);
+    accesses[partition_id]++;
+
+    // Look the block up in the LRU stack of the partition, and move it,
+    // or insert it, at the MRU position
+    std::vector<Addr>& atd = atds[set * numPartitions + partition_id];
+    auto it = std::find(atd.begin(), atd.end(), line);
+    unsigned position = assoc;
+    if (it != atd.end()) {
+        position = it - atd.begin();
+        hits[partition_id * assoc + position]++;
+        atd.erase(it);
+    } else if (atd.size() == assoc) {
+        atd.pop_back();
+    }
+    atd.insert(atd.begin(), line);
+    return position;
+}
+
+void
+UtilityCurves::decay()
+{
+    for (auto& hit : hits) {
+        hit >>= 1;
+    }
+    for (auto& access : accesses) {
+        access >>= 1;
+    }
+}
+
+std::vector<uint64_t>
+UtilityCurves::getMissCurve(unsigned partition_id) const
+{
+    assert(partition_id < numPartitions);
+    std::vector<uint64_t> curve(assoc + 1);
+    curve[0] = accesses[partition_id];
+    for (unsigned ways = 1; ways <= assoc; ways++) {
+        curve[ways] = curve[ways - 1] - hits[partition_id * assoc + ways - 1];
+    }
+    return curve;
+}
+
+std::vector<unsigned>
+UtilityCurves::allocateWays() const
+{
+    assert(numPartitions <= assoc);
+    std::vector<std::vector<uint64_t>> curves;
+    for (unsigned id = 0; id < numPartitions; id++) {
+        curves.push_back(getMissCurve(id));
+    }
+
+    // Every partition gets a way, and the others go, a few at a time, to
+    // the partition that saves the most misses per way with them
+    std::vector<unsigned> ways(numPartitions, 1);
+    unsigned balance = assoc - numPartitions;
+    while (balance > 0) {
+        double best_utility = -1;
+        unsigned best_id = 0;
+        unsigned best_ways = 1;
+        for (unsigned id = 0; id < numPartitions; id++) {
+            const std::vector<uint64_t>& curve = curves[id];
+            for (unsigned extra = 1; extra <= balance; extra++) {
+                const double utility = double(curve[ways[id]] -
+                    curve[ways[id] + extra]) / extra;
+                if (utility > best_utility) {
+                    best_utility = utility;
+                    best_id = id;
+                    best_ways = extra;
+                }
+            }
+        }
+        ways[best_id] += best_ways;
+        balance -= best_ways;
+    }
+    return ways;
+}
+
+} // namespace partitioning_policy
+
+} // namespace gem5
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_CACHE_TAGS_PARTITIONING_POLICIES_UTILITY_CURVES_HH__
+#define __MEM_CACHE_TAGS_PARTITIONING_POLICIES_UTILITY_CURVES_HH__
+
+#include <cstdint>
+#include <vector>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+namespace partitioning_policy
+{
+
+/**
+ * The auxiliary tag directories of a UtilityMonitor, and the miss curves
+ * of the partitions they give. Each partition has an LRU tag directory
+ * per sampled set, as if it had the whole cache: a hit at LRU stack
+ * position d is a hit the partition would get with d + 1 ways or more.
+ */
+class UtilityCurves
+{
+  private:
+    /** Number of partitions. */
+    const unsigned numPartitions;
+
+    /** Associativity of the cache. */
+    const unsigned assoc;
+
+    /**
+     * Auxiliary tag directories, indexed by sampled set and partition.
+     * Each holds the blocks of its set in LRU stack order, MRU first.
+     */
+    std::vector<std::vector<Addr>> atds;
+
+    /**
+     * Decayed hits at each LRU stack position and accesses of the
+     * partitions, which are the basis of the miss curves.
+     */
+    std::vector<uint64_t> hits;
+    std::vector<uint64_t> accesses;
+
+  public:
+    /**
+     * @param num_partitions Number of partitions.
+     * @param assoc Associativity of the cache.
+     * @param num_sets Number of sampled sets.
+     */
+    UtilityCurves(unsigned num_partitions, unsigned assoc,
+                  unsigned num_sets);
+
+    /**
+     * Account for an access of a partition to a sampled set.
+     *
+     * @param partition_id The partition.
+     * @param set The sampled set.
+     * @param line The address of the line accessed.
+     * @return The LRU stack position of the line, assoc on a miss.
+     */
+    unsigned access(unsigned partition_id, unsigned set, Addr line);
+
+    /** Halve the counters, so that the curves follow the phases. */
+    void decay();
+
+    /**
+     * Get the miss curve of a partition, in decayed sampled misses.
+     *
+     * @param partition_id The partition.
+     * @return The misses with 0 to assoc ways.
+     */
+    std::vector<uint64_t> getMissCurve(unsigned partition_id) const;
+
+    /**
+     * Allocate the ways to minimize the total misses, with the lookahead
+     * algorithm of UCP. Every partition gets at least one way.
+     *
+     * @return The number of ways of each partition.
+     */
+    std::vector<unsigned> allocateWays() const;
+};
+
+} // namespace partitioning_policy
+
+} // namespace gem5
+
+#endif // __MEM_CACHE_TAGS_PARTITIONING_POLICIES_UTILITY_CURVES_HH__
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "mem/cache/tags/partitioning_policies/utility_curves.hh"
+
+using namespace gem5;
+using namespace gem5::partitioning_policy;
+
+namespace
+{
+
+/** Access lines 0 to num_lines - 1 of a set in turn, a few times */
+void
+cycle(UtilityCurves &curves, unsigned partition_id, unsigned set,
+      unsigned num_lines, unsigned times)
+{
+    for (unsigned i = 0; i < times; i++) {
+        for (Addr line = 0; line < num_lines; line++) {
+            curves.access(partition_id, set, line * 64);
+        }
+    }
+}
+
+} // anonymous namespace
+
+TEST(UtilityCurvesTest, StackPositions)
+{
+    UtilityCurves curves(1, 4, 2);
+
+    EXPECT_EQ(curves.access(0, 0, 0x0), 4);
+    EXPECT_EQ(curves.access(0, 0, 0x40), 4);
+    EXPECT_EQ(curves.access(0, 0, 0x0), 1);
+    EXPECT_EQ(curves.access(0, 0, 0x0), 0);
+    EXPECT_EQ(curves.access(0, 0, 0x40), 1);
+
+    // the sets are apart
+    EXPECT_EQ(curves.access(0, 1, 0x0), 4);
+
+    // the LRU line is dropped once the set is full
+    for (Addr line = 0x80; line < 0x140; line += 0x40) {
+        EXPECT_EQ(curves.access(0, 0, line), 4);
+    }
+    EXPECT_EQ(curves.access(0, 0, 0x0), 4);
+    EXPECT_EQ(curves.access(0, 0, 0x100), 1);
+}
+
+TEST(UtilityCurvesTest, MissCurves)
+{
+    UtilityCurves curves(3, 4, 1);
+
+    // more lines than there are ways, which never hit, a line hit over
+    // and over, and two lines in turn
+    cycle(curves, 0, 0, 5, 2);
+    cycle(curves, 1, 0, 1, 3);
+    cycle(curves, 2, 0, 2, 3);
+
+    EXPECT_EQ(curves.getMissCurve(0),
+              std::vector<uint64_t>({10, 10, 10, 10, 10}));
+    EXPECT_EQ(curves.getMissCurve(1),
+              std::vector<uint64_t>({3, 1, 1, 1, 1}));
+    EXPECT_EQ(curves.getMissCurve(2),
+              std::vector<uint64_t>({6, 6, 2, 2, 2}));
+
+    curves.decay();
+    EXPECT_EQ(curves.getMissCurve(0),
+              std::vector<uint64_t>({5, 5, 5, 5, 5}));
+    EXPECT_EQ(curves.getMissCurve(1),
+              std::vector<uint64_t>({1, 0, 0, 0, 0}));
+    EXPECT_EQ(curves.getMissCurve(2),
+              std::vector<uint64_t>({3, 3, 1, 1, 1}));
+}
+
+TEST(UtilityCurvesTest, PartitionsAreApart)
+{
+    UtilityCurves curves(2, 4, 1);
+
+    // the lines of a partition never hit for another one
+    cycle(curves, 0, 0, 2, 4);
+    cycle(curves, 1, 0, 2, 1);
+
+    EXPECT_EQ(curves.getMissCurve(0),
+              std::vector<uint64_t>({8, 8, 2, 2, 2}));
+    EXPECT_EQ(curves.getMissCurve(1),
+              std::vector<uint64_t>({2, 2, 2, 2, 2}));
+}
+
+TEST(UtilityCurvesTest, EveryPartitionGetsAWay)
+{
+    UtilityCurves curves(3, 3, 1);
+    cycle(curves, 0, 0, 3, 10);
+
+    EXPECT_EQ(curves.allocateWays(), std::vector<unsigned>({1, 1, 1}));
+}
+
+TEST(UtilityCurvesTest, WaysGoWhereTheySaveMisses)
+{
+    UtilityCurves curves(2, 4, 1);
+
+    // a partition that needs three ways, and a stream
+    cycle(curves, 0, 0, 3, 10);
+    cycle(curves, 1, 0, 100, 1);
+
+    EXPECT_EQ(curves.allocateWays(), std::vector<unsigned>({3, 1}));
+}
+
+TEST(UtilityCurvesTest, LookaheadPastFlatCurves)
+{
+    UtilityCurves curves(2, 8, 1);
+
+    // the first partition only hits with six ways, but saves more misses
+    // per way with them than the second one does with a second way
+    cycle(curves, 0, 0, 6, 10);
+    cycle(curves, 1, 0, 2, 3);
+
+    EXPECT_EQ(curves.allocateWays(), std::vector<unsigned>({6, 2}));
+
+    // when the second partition saves more misses per way with seven
+    // ways, there are too few left for the first one to hit
+    UtilityCurves wide(2, 8, 1);
+    cycle(wide, 0, 0, 6, 2);
+    cycle(wide, 1, 0, 7, 3);
+
+    EXPECT_EQ(wide.allocateWays(), std::vector<unsigned>({1, 7}));
+}
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/tags/partitioning_policies/utility_monitor.hh"
+
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/PartitionPolicy.hh"
+#include "mem/cache/cache_blk.hh"
+#include "mem/cache/tags/partitioning_policies/partition_manager.hh"
+#include "mem/cache/tags/partitioning_policies/way_pp.hh"
+
+namespace gem5
+{
+
+namespace partitioning_policy
+{
+
+UtilityMonitor::UtilityMonitor(const Params &p)
+  : SimObject(p), numPartitions(p.num_partitions), assoc(p.assoc),
+    blkSize(p.block_size), requestorPartitions(p.requestor_partitions),
+    partitionManager(p.partitioning_manager),
+    partitioningPolicy(p.partitioning_policy), epoch(p.epoch),
+    sampler(p.cache_size, p.assoc, p.block_size, p.num_sampled_sets),
+    curves(p.num_partitions, p.assoc, sampler.getNumSampled()),
+    occupancy(p.num_partitions, 0),
+    epochEvent([this]{ processEpoch(); }, name()),
+    stats(*this)
+{
+    fatal_if(numPartitions == 0, "%s must monitor at least one partition",
+             name());
+    fatal_if(partitioningPolicy && numPartitions > assoc,
+             "%s can not give a way to each of its %d partitions",
+             name(), numPartitions);
+    fatal_if(partitioningPolicy && requestorPartitions,
+             "%s can only repartition the ways among PartitionIDs", name());
+    fatal_if(partitioningPolicy && epoch == 0,
+             "%s needs epochs to repartition the ways", name());
+}
+
+void
+UtilityMonitor::startup()
+{
+    if (epoch != 0) {
+        schedule(epochEvent, curTick() + epoch);
+    }
+}
+
+unsigned
+UtilityMonitor::partition(uint64_t id) const
+{
+    fatal_if(id >= numPartitions, "%s only monitors partitions 0 to %d, "
+             "not %d", name(), numPartitions - 1, id);
+    return id;
+}
+
+unsigned
+UtilityMonitor::partition(const PacketPtr pkt) const
+{
+    if (requestorPartitions) {
+        return partition(pkt->req->requestorId());
+    }
+    return partition(partitionManager ?
+        partitionManager->readPacketPartitionID(pkt) : 0);
+}
+
+unsigned
+UtilityMonitor::partition(const CacheBlk* blk) const
+{
+    return partition(requestorPartitions ? blk->getSrcRequestorId() :
+        blk->getPartitionId());
+}
+
+void
+UtilityMonitor::notifyAccess(const PacketPtr pkt)
+{
+    const int64_t set = sampler.sampledSet(pkt->getAddr());
+    if (set < 0) {
+        return;
+    }
+
+    const unsigned id = partition(pkt);
+    stats.sampledAccesses[id]++;
+    const unsigned position =
+        curves.access(id, set, sampler.lineAddr(pkt->getAddr()));
+    if (position < assoc) {
+        stats.stackHits[id][position]++;
+    }
+}
+
+void
+UtilityMonitor::notifyFill(const PacketPtr pkt, const CacheBlk* blk)
+{
+    const unsigned id = partition(blk);
+    occupancy[id]++;
+    stats.occupancy[id]++;
+
+    // Blocks written back from above do not come from the memory below
+    if (pkt->isResponse()) {
+        stats.fillBytes[id] += blkSize;
+    }
+}
+
+void
+UtilityMonitor::notifyEvict(const CacheBlk* blk)
+{
+    const unsigned id = partition(blk);
+    assert(occupancy[id] > 0);
+    occupancy[id]--;
+    stats.occupancy[id]--;
+}
+
+void
+UtilityMonitor::notifyWriteback(const CacheBlk* blk)
+{
+    stats.writebackBytes[partition(blk)] += blkSize;
+}
+
+uint64_t
+UtilityMonitor::getOccupancy(unsigned partition_id) const
+{
+    assert(partition_id < numPartitions);
+    return occupancy[partition_id];
+}
+
+std::vector<uint64_t>
+UtilityMonitor::getMissCurve(unsigned partition_id) const
+{
+    return curves.getMissCurve(partition_id);
+}
+
+void
+UtilityMonitor::repartition()
+{
+    const std::vector<unsigned> ways = curves.allocateWays();
+
+    unsigned first_way = 0;
+    for (unsigned id = 0; id < numPartitions; id++) {
+        for (unsigned way = 0; way < assoc; way++) {
+            if (way >= first_way && way < first_way + ways[id]) {
+                partitioningPolicy->addWayToPartition(id, way);
+            } else {
+                partitioningPolicy->removeWayToPartition(id, way);
+            }
+        }
+        DPRINTF(PartitionPolicy, "%s: allocated ways [%d, %d) to "
+                "PartitionID %d\n", name(), first_way,
+                first_way + ways[id], id);
+        first_way += ways[id];
+        stats.allocatedWays[id] = ways[id];
+    }
+    stats.repartitions++;
+}
+
+void
+UtilityMonitor::processEpoch()
+{
+    if (partitioningPolicy) {
+        repartition();
+    }
+
+    curves.decay();
+
+    schedule(epochEvent, curTick() + epoch);
+}
+
+UtilityMonitor::UtilityMonitorStats::UtilityMonitorStats(
+    UtilityMonitor &monitor)
+  : statistics::Group(&monitor),
+    ADD_STAT(occupancy, statistics::units::Rate<
+                statistics::units::Count, statistics::units::Tick>::get(),
+             "Average number of blocks of each partition"),
+    ADD_STAT(fillBytes, statistics::units::Byte::get(),
+             "Bytes filled from the memory below by each partition"),
+    ADD_STAT(writebackBytes, statistics::units::Byte::get(),
+             "Bytes written back to the memory below by each partition"),
+    ADD_STAT(sampledAccesses, statistics::units::Count::get(),
+             "Number of accesses of each partition to the sampled sets"),
+    ADD_STAT(stackHits, statistics::units::Count::get(),
+             "Number of sampled hits of each partition at each LRU stack "
+             "position"),
+    ADD_STAT(allocatedWays, statistics::units::Count::get(),
+             "Number of ways allocated to each partition"),
+    ADD_STAT(repartitions, statistics::units::Count::get(),
+             "Number of times the ways were reallocated")
+{
+    occupancy.init(monitor.numPartitions);
+    fillBytes.init(monitor.numPartitions);
+    writebackBytes.init(monitor.numPartitions);
+    sampledAccesses.init(monitor.numPartitions);
+    stackHits.init(monitor.numPartitions, monitor.assoc);
+    allocatedWays.init(monitor.numPartitions);
+}
+
+} // namespace partitioning_policy
+
+} // namespace gem5
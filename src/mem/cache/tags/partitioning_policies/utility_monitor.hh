@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_CACHE_TAGS_PARTITIONING_POLICIES_UTILITY_MONITOR_HH__
+#define __MEM_CACHE_TAGS_PARTITIONING_POLICIES_UTILITY_MONITOR_HH__
+
+#include <cstdint>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "mem/cache/replacement_policies/set_sampler.hh"
+#include "mem/cache/tags/partitioning_policies/utility_curves.hh"
+#include "mem/packet.hh"
+#include "params/UtilityMonitor.hh"
+#include "sim/eventq.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+class CacheBlk;
+
+namespace partitioning_policy
+{
+
+class PartitionManager;
+class WayPartitioningPolicy;
+
+/**
+ * Monitors how a cache is shared by its partitions, identified either by
+ * the PartitionID of the accesses or by their requestor. It models both
+ * resource monitoring, in the style of Intel CMT and MBM, and utility
+ * monitoring (UMON), as described in "Utility-Based Cache Partitioning",
+ * by Qureshi and Patt.
+ *
+ * The occupancy of every partition, and the bytes it fills from and
+ * writes back to the memory below, are counted from the cache's own
+ * allocations and evictions. The utility of each partition is measured
+ * on a few sampled sets, with one auxiliary LRU tag directory per
+ * partition as if it had the whole cache: a hit at LRU stack position d
+ * is a hit the partition would get with d + 1 ways or more, which gives
+ * its miss curve.
+ *
+ * Every epoch the hit counters are halved, so that the curves follow
+ * the phases of the partitions. If a WayPartitioningPolicy is given, the
+ * ways of the cache are reallocated first, with the lookahead algorithm
+ * of UCP, so that partition i gets a contiguous range of ways.
+ */
+class UtilityMonitor : public SimObject
+{
+  private:
+    /** Number of partitions monitored. */
+    const unsigned numPartitions;
+
+    /** Associativity of the cache. */
+    const unsigned assoc;
+
+    /** Size of a block, in bytes. */
+    const unsigned blkSize;
+
+    /** Whether partitions are identified by requestor. */
+    const bool requestorPartitions;
+
+    /** Manager providing the PartitionID of the accesses, if any. */
+    const PartitionManager* const partitionManager;
+
+    /** Policy whose ways are reallocated every epoch, if any. */
+    WayPartitioningPolicy* const partitioningPolicy;
+
+    /** Length of an epoch. */
+    const Tick epoch;
+
+    /** Selection of the sets of the auxiliary tag directories. */
+    const replacement_policy::SetSampler sampler;
+
+    /** Auxiliary tag directories, and the miss curves they give. */
+    UtilityCurves curves;
+
+    /** Number of blocks of each partition in the cache. */
+    std::vector<uint64_t> occupancy;
+
+    /** Event that ends an epoch. */
+    EventFunctionWrapper epochEvent;
+
+    /**
+     * Get the partition of a packet or of a block. The PartitionIDs, or
+     * requestors, are the partitions themselves, so they must be below
+     * the number of partitions.
+     *
+     * @param id The PartitionID or the requestor.
+     * @return The index of the partition.
+     */
+    unsigned partition(uint64_t id) const;
+    unsigned partition(const PacketPtr pkt) const;
+    unsigned partition(const CacheBlk* blk) const;
+
+    /** Reallocate the ways if needed, and decay the counters. */
+    void processEpoch();
+
+    /**
+     * Reallocate the ways of the cache to minimize the total misses,
+     * using the lookahead algorithm of UCP.
+     */
+    void repartition();
+
+    struct UtilityMonitorStats : public statistics::Group
+    {
+        UtilityMonitorStats(UtilityMonitor &monitor);
+
+        /** Average number of blocks of each partition. */
+        statistics::AverageVector occupancy;
+
+        /** Bytes filled from and written back to the memory below. */
+        statistics::Vector fillBytes;
+        statistics::Vector writebackBytes;
+
+        /** Accesses to the sampled sets, and hits per LRU position. */
+        statistics::Vector sampledAccesses;
+        statistics::Vector2d stackHits;
+
+        /** Ways allocated by the last repartitioning. */
+        statistics::Vector allocatedWays;
+
+        statistics::Scalar repartitions;
+    } stats;
+
+  public:
+    PARAMS(UtilityMonitor);
+    UtilityMonitor(const Params &p);
+
+    void startup() override;
+
+    /**
+     * Account for a demand access to the cache.
+     *
+     * @param pkt The access.
+     */
+    void notifyAccess(const PacketPtr pkt);
+
+    /**
+     * Account for the allocation of a block.
+     *
+     * @param pkt The packet that brought the block in.
+     * @param blk The block allocated.
+     */
+    void notifyFill(const PacketPtr pkt, const CacheBlk* blk);
+
+    /**
+     * Account for the eviction or invalidation of a valid block.
+     *
+     * @param blk The block.
+     */
+    void notifyEvict(const CacheBlk* blk);
+
+    /**
+     * Account for the write back of a block to the memory below.
+     *
+     * @param blk The block written back.
+     */
+    void notifyWriteback(const CacheBlk* blk);
+
+    /**
+     * Get the number of blocks of a partition in the cache.
+     *
+     * @param partition_id The partition.
+     */
+    uint64_t getOccupancy(unsigned partition_id) const;
+
+    /**
+     * Get the miss curve of a partition in the current epoch, in decayed
+     * sampled misses.
+     *
+     * @param partition_id The partition.
+     * @return The misses with 0 to assoc ways.
+     */
+    std::vector<uint64_t> getMissCurve(unsigned partition_id) const;
+};
+
+} // namespace partitioning_policy
+
+} // namespace gem5
+
+#endif // __MEM_CACHE_TAGS_PARTITIONING_POLICIES_UTILITY_MONITOR_HH__
@@ -0,0 +1,649 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/victim_cache.hh"
+
+#include <algorithm>
+
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/VictimCache.hh"
+#include "sim/system.hh"
+
+namespace gem5
+{
+
+VictimCache::CpuSidePort::CpuSidePort(const std::string &_name,
+                                      VictimCache &_victim)
+    : QueuedResponsePort(_name, queue),
+      queue(_victim, *this, true), victim(_victim)
+{
+}
+
+VictimCache::MemSidePort::MemSidePort(const std::string &_name,
+                                      VictimCache &_victim)
+    : RequestPort(_name),
+      snoopRespQueue(_victim, *this, true), victim(_victim)
+{
+}
+
+VictimCache::VictimCache(const Params &p)
+    : ClockedObject(p),
+      cpuSidePort(p.name + ".cpu_side", *this),
+      memSidePort(p.name + ".mem_side", *this),
+      blkSize(p.system->cacheLineSize()),
+      hitLatency(p.hit_latency), forwardLatency(p.forward_latency),
+      tags(p.size / blkSize, blkSize),
+      waitingOnRetry(false), mustSendRetry(false), stats(*this)
+{
+    fatal_if(tags.size() == 0, "%s must hold at least one line.\n",
+             name());
+}
+
+Port &
+VictimCache::getPort(const std::string &if_name, PortID idx)
+{
+    if (if_name == "cpu_side") {
+        return cpuSidePort;
+    } else if (if_name == "mem_side") {
+        return memSidePort;
+    } else {
+        return ClockedObject::getPort(if_name, idx);
+    }
+}
+
+void
+VictimCache::init()
+{
+    if (!cpuSidePort.isConnected() || !memSidePort.isConnected())
+        fatal("Victim cache ports on %s are not connected\n", name());
+    cpuSidePort.sendRangeChange();
+}
+
+std::deque<PacketPtr>::iterator
+VictimCache::findWriteback(PacketPtr pkt)
+{
+    const Addr blk_addr = pkt->getBlockAddr(blkSize);
+    return std::find_if(writebacks.begin(), writebacks.end(),
+        [blk_addr, pkt](PacketPtr wb_pkt) {
+            return wb_pkt->getAddr() == blk_addr &&
+                wb_pkt->isSecure() == pkt->isSecure();
+        });
+}
+
+void
+VictimCache::insert(PacketPtr pkt, bool is_timing)
+{
+    Entry *entry = tags.findEntry(pkt);
+    if (!entry) {
+        entry = tags.findVictim();
+        if (entry->valid) {
+            stats.evictions++;
+            evict(entry, is_timing);
+        }
+    }
+
+    tags.insert(pkt, entry);
+    stats.insertions++;
+    DPRINTF(VictimCache, "Captured %s", entry->print());
+}
+
+PacketPtr
+VictimCache::createWriteback(Entry *entry, MemCmd cmd, PacketId id)
+{
+    RequestPtr req = std::make_shared<Request>(
+        entry->addr, blkSize, 0, Request::wbRequestorId);
+    if (entry->secure)
+        req->setFlags(Request::SECURE);
+    req->taskId(entry->taskId);
+
+    PacketPtr pkt = new Packet(req, cmd, blkSize, id);
+    if (!entry->writable)
+        pkt->setHasSharers();
+    pkt->allocate();
+    pkt->setDataFromBlock(entry->data.data(), blkSize);
+
+    stats.writebacks++;
+    return pkt;
+}
+
+PacketPtr
+VictimCache::createWriteClean(PacketPtr wb_pkt, PacketPtr pkt)
+{
+    assert(wb_pkt->cmd == MemCmd::WritebackDirty && pkt->isClean());
+
+    RequestPtr req = std::make_shared<Request>(
+        wb_pkt->getAddr(), blkSize, 0, Request::wbRequestorId);
+    if (wb_pkt->isSecure())
+        req->setFlags(Request::SECURE);
+    req->taskId(wb_pkt->req->taskId());
+
+    PacketPtr wc_pkt = new Packet(req, MemCmd::WriteClean, blkSize,
+                                  pkt->id);
+    if (pkt->req->getDest()) {
+        req->setFlags(pkt->req->getDest());
+        wc_pkt->setWriteThrough();
+    }
+    if (wb_pkt->hasSharers())
+        wc_pkt->setHasSharers();
+    wc_pkt->allocate();
+    wc_pkt->setData(wb_pkt->getConstPtr<uint8_t>());
+
+    stats.writebacks++;
+    return wc_pkt;
+}
+
+void
+VictimCache::evict(Entry *entry, bool is_timing)
+{
+    PacketPtr pkt = createWriteback(entry, entry->dirty ?
+        MemCmd::WritebackDirty : MemCmd::WritebackClean);
+    DPRINTF(VictimCache, "Evicting %s", entry->print());
+    tags.invalidate(entry);
+
+    if (is_timing) {
+        sendWriteback(pkt);
+    } else {
+        memSidePort.sendAtomic(pkt);
+        delete pkt;
+    }
+}
+
+void
+VictimCache::sendWriteback(PacketPtr pkt)
+{
+    writebacks.push_back(pkt);
+    sendWritebacks();
+}
+
+void
+VictimCache::sendWritebacks()
+{
+    while (!waitingOnRetry && !writebacks.empty()) {
+        if (memSidePort.sendTimingReq(writebacks.front())) {
+            writebacks.pop_front();
+        } else {
+            waitingOnRetry = true;
+        }
+    }
+}
+
+bool
+VictimCache::recvTimingReq(PacketPtr pkt)
+{
+    // writebacks from here go ahead of anything that follows them
+    if (waitingOnRetry || !writebacks.empty()) {
+        mustSendRetry = true;
+        return false;
+    }
+
+    const bool cacheable = !pkt->req->isUncacheable() &&
+        !pkt->cacheResponding();
+
+    if (cacheable && pkt->isWriteback()) {
+        insert(pkt, true);
+        // we are the final destination of the writeback
+        delete pkt;
+        return true;
+    }
+
+    Entry *entry = cacheable ? tags.findEntry(pkt) : nullptr;
+    if (entry && tags.canService(pkt, *entry)) {
+        stats.hits++;
+
+        Tick when = clockEdge(hitLatency) + pkt->headerDelay;
+        pkt->headerDelay = pkt->payloadDelay = 0;
+        DPRINTF(VictimCache, "Servicing %s from %s", pkt->print(),
+                entry->print());
+        tags.service(pkt, entry);
+        pkt->makeTimingResponse();
+        cpuSidePort.schedTimingResp(pkt, when);
+        return true;
+    }
+
+    if (entry) {
+        // the line cannot be handed over, so give it to the level
+        // below before the request gets there
+        stats.flushes++;
+        evict(entry, true);
+        if (!writebacks.empty()) {
+            mustSendRetry = true;
+            return false;
+        }
+    }
+
+    if (!memSidePort.sendTimingReq(pkt)) {
+        waitingOnRetry = true;
+        mustSendRetry = true;
+        return false;
+    }
+
+    if (pkt->isRead() && pkt->fromCache())
+        stats.misses++;
+    return true;
+}
+
+void
+VictimCache::recvReqRetry()
+{
+    assert(waitingOnRetry);
+    waitingOnRetry = false;
+    sendWritebacks();
+
+    if (waitingOnRetry || !writebacks.empty())
+        return;
+
+    if (drainState() == DrainState::Draining)
+        signalDrainDone();
+
+    if (mustSendRetry) {
+        mustSendRetry = false;
+        cpuSidePort.sendRetryReq();
+    }
+}
+
+bool
+VictimCache::recvTimingResp(PacketPtr pkt)
+{
+    Tick when = clockEdge(forwardLatency) + pkt->headerDelay;
+    pkt->headerDelay = pkt->payloadDelay = 0;
+    cpuSidePort.schedTimingResp(pkt, when);
+    return true;
+}
+
+void
+VictimCache::sendSnoopResponse(PacketPtr pkt, const uint8_t *blk_data)
+{
+    assert(pkt->isRequest() && pkt->needsResponse());
+    assert(pkt->req->isUncacheable() || pkt->isInvalidate() ||
+           pkt->hasSharers());
+
+    PacketPtr resp = new Packet(pkt, false, pkt->isRead());
+    resp->makeTimingResponse();
+    if (resp->isRead())
+        resp->setDataFromBlock(blk_data, blkSize);
+
+    Tick when = clockEdge(hitLatency) + resp->headerDelay;
+    resp->headerDelay = resp->payloadDelay = 0;
+    memSidePort.snoopRespQueue.schedSendTiming(resp, when);
+}
+
+Cycles
+VictimCache::handleSnoop(PacketPtr pkt, bool is_timing)
+{
+    Entry *entry = tags.findEntry(pkt);
+    auto wb_it = findWriteback(pkt);
+    if (!entry && wb_it == writebacks.end())
+        return Cycles(0);
+
+    const bool invalidate_line = pkt->isInvalidate();
+    panic_if(invalidate_line && pkt->req->isUncacheable(),
+             "%s got an invalidating uncacheable snoop request %s",
+             name(), pkt->print());
+
+    // a writeback or a prefetch from below checking for copies above
+    if (pkt->mustCheckAbove()) {
+        pkt->setBlockCached();
+        return hitLatency;
+    }
+
+    if (entry) {
+        // the same as Cache::handleSnoop for a block
+        bool respond = false;
+        if (pkt->isClean()) {
+            if (entry->dirty) {
+                PacketPtr wb_pkt =
+                    createWriteback(entry, MemCmd::WriteClean, pkt->id);
+                if (pkt->req->getDest()) {
+                    wb_pkt->req->setFlags(pkt->req->getDest());
+                    wb_pkt->setWriteThrough();
+                }
+                entry->dirty = false;
+                entry->writable = false;
+
+                if (is_timing) {
+                    sendWriteback(wb_pkt);
+                } else {
+                    memSidePort.sendAtomic(wb_pkt);
+                    delete wb_pkt;
+                }
+                pkt->setSatisfied();
+            }
+        } else {
+            respond = entry->dirty && pkt->needsResponse();
+        }
+
+        if (pkt->isRead() && !invalidate_line) {
+            assert(!pkt->needsWritable());
+            pkt->setHasSharers();
+            if (!pkt->req->isUncacheable())
+                entry->writable = false;
+        }
+
+        if (respond) {
+            pkt->setCacheResponding();
+            if (entry->writable)
+                pkt->setResponderHadWritable();
+            panic_if(!invalidate_line && !pkt->hasSharers(),
+                     "%s is passing a Modified line through %s, "
+                     "but keeping the block", name(), pkt->print());
+
+            if (is_timing) {
+                sendSnoopResponse(pkt, entry->data.data());
+            } else {
+                pkt->makeAtomicResponse();
+                if (pkt->hasData())
+                    pkt->setDataFromBlock(entry->data.data(), blkSize);
+            }
+            stats.snoopResponses++;
+        }
+
+        if (invalidate_line) {
+            DPRINTF(VictimCache, "Snoop %s invalidates %s", pkt->print(),
+                    entry->print());
+            tags.invalidate(entry);
+            stats.snoopInvalidations++;
+        }
+    } else {
+        // the same as Cache::recvTimingSnoopReq for the write buffer,
+        // writebacks are only held in timing mode
+        assert(is_timing);
+        PacketPtr wb_pkt = *wb_it;
+
+        bool respond = wb_pkt->cmd == MemCmd::WritebackDirty &&
+            pkt->needsResponse() && !pkt->isClean();
+        bool have_writable = !wb_pkt->hasSharers();
+
+        if (!pkt->req->isUncacheable() && pkt->isRead() &&
+            !invalidate_line) {
+            assert(!pkt->needsWritable());
+            pkt->setHasSharers();
+            wb_pkt->setHasSharers();
+        }
+
+        if (respond) {
+            pkt->setCacheResponding();
+            if (have_writable)
+                pkt->setResponderHadWritable();
+            sendSnoopResponse(pkt, wb_pkt->getConstPtr<uint8_t>());
+            stats.snoopResponses++;
+        }
+
+        // as for an entry, the dirty data goes below with a WriteClean
+        // that carries the id of the cache maintenance operation, and
+        // the queued writeback is left with a clean copy, so that the
+        // data is only written once
+        PacketPtr wc_pkt = nullptr;
+        if (pkt->isClean() && wb_pkt->cmd == MemCmd::WritebackDirty) {
+            wc_pkt = createWriteClean(wb_pkt, pkt);
+            wb_pkt->cmd = MemCmd::WritebackClean;
+            pkt->setSatisfied();
+        }
+
+        if (invalidate_line && wb_pkt->cmd != MemCmd::WriteClean) {
+            // invalidation trumps our writeback
+            writebacks.erase(wb_it);
+            delete wb_pkt;
+            stats.snoopInvalidations++;
+        }
+
+        // sending may pop the writebacks, so only do it once we are
+        // done with the iterator
+        if (wc_pkt)
+            sendWriteback(wc_pkt);
+    }
+
+    return hitLatency;
+}
+
+void
+VictimCache::recvTimingSnoopReq(PacketPtr pkt)
+{
+    // a line is either in the L1 or here, so the L1 sees the snoop
+    // first, as it would without the victim cache
+    cpuSidePort.sendTimingSnoopReq(pkt);
+
+    Cycles lat = handleSnoop(pkt, true);
+    pkt->snoopDelay = std::max<uint32_t>(pkt->snoopDelay,
+                                         cyclesToTicks(lat));
+}
+
+bool
+VictimCache::recvTimingSnoopResp(PacketPtr pkt)
+{
+    Tick when = clockEdge(forwardLatency) + pkt->headerDelay;
+    pkt->headerDelay = pkt->payloadDelay = 0;
+    memSidePort.snoopRespQueue.schedSendTiming(pkt, when);
+    return true;
+}
+
+Tick
+VictimCache::recvAtomic(PacketPtr pkt)
+{
+    const bool cacheable = !pkt->req->isUncacheable() &&
+        !pkt->cacheResponding();
+
+    if (cacheable && pkt->isWriteback()) {
+        insert(pkt, false);
+        return cyclesToTicks(hitLatency);
+    }
+
+    Entry *entry = cacheable ? tags.findEntry(pkt) : nullptr;
+    if (entry && tags.canService(pkt, *entry)) {
+        stats.hits++;
+        DPRINTF(VictimCache, "Servicing %s from %s", pkt->print(),
+                entry->print());
+        tags.service(pkt, entry);
+        pkt->makeAtomicResponse();
+        return cyclesToTicks(hitLatency);
+    }
+
+    if (entry) {
+        stats.flushes++;
+        evict(entry, false);
+    }
+    if (pkt->isRead() && pkt->fromCache())
+        stats.misses++;
+
+    return memSidePort.sendAtomic(pkt);
+}
+
+Tick
+VictimCache::recvAtomicSnoop(PacketPtr pkt)
+{
+    Tick latency = cpuSidePort.sendAtomicSnoop(pkt);
+    if (pkt->isResponse())
+        return latency;
+    return latency + cyclesToTicks(handleSnoop(pkt, false));
+}
+
+bool
+VictimCache::functionalAccess(PacketPtr pkt)
+{
+    Entry *entry = tags.findEntry(pkt);
+    if (entry && pkt->trySatisfyFunctional(entry, entry->addr,
+                                           entry->secure, blkSize,
+                                           entry->data.data())) {
+        return true;
+    }
+
+    for (auto wb_pkt : writebacks) {
+        if (pkt->trySatisfyFunctional(wb_pkt))
+            return true;
+    }
+
+    return cpuSidePort.trySatisfyFunctional(pkt) ||
+        memSidePort.snoopRespQueue.trySatisfyFunctional(pkt);
+}
+
+void
+VictimCache::recvFunctional(PacketPtr pkt)
+{
+    pkt->pushLabel(name());
+    bool done = functionalAccess(pkt);
+    pkt->popLabel();
+
+    if (done) {
+        pkt->makeResponse();
+    } else {
+        memSidePort.sendFunctional(pkt);
+    }
+}
+
+void
+VictimCache::recvFunctionalSnoop(PacketPtr pkt)
+{
+    cpuSidePort.sendFunctionalSnoop(pkt);
+    if (pkt->isResponse())
+        return;
+
+    pkt->pushLabel(name());
+    bool done = functionalAccess(pkt);
+    pkt->popLabel();
+
+    if (done)
+        pkt->makeResponse();
+}
+
+void
+VictimCache::recvRangeChange()
+{
+    cpuSidePort.sendRangeChange();
+}
+
+AddrRangeList
+VictimCache::getAddrRanges() const
+{
+    return memSidePort.getAddrRanges();
+}
+
+bool
+VictimCache::isSnooping() const
+{
+    return cpuSidePort.isSnooping();
+}
+
+DrainState
+VictimCache::drain()
+{
+    return writebacks.empty() ? DrainState::Drained : DrainState::Draining;
+}
+
+void
+VictimCache::memWriteback()
+{
+    for (auto &entry : tags) {
+        if (!entry.valid || !entry.dirty)
+            continue;
+
+        RequestPtr request = std::make_shared<Request>(
+            entry.addr, blkSize, 0, Request::funcRequestorId);
+        request->taskId(entry.taskId);
+        if (entry.secure)
+            request->setFlags(Request::SECURE);
+
+        Packet packet(request, MemCmd::WriteReq);
+        packet.dataStatic(entry.data.data());
+        memSidePort.sendFunctional(&packet);
+
+        entry.dirty = false;
+    }
+}
+
+void
+VictimCache::memInvalidate()
+{
+    for (auto &entry : tags) {
+        if (entry.valid)
+            tags.invalidate(&entry);
+    }
+}
+
+void
+VictimCache::serialize(CheckpointOut &cp) const
+{
+    bool dirty(tags.isDirty());
+
+    if (dirty) {
+        warn("*** The victim cache still contains dirty data. ***\n");
+        warn("    Make sure to drain the system using the correct flags.\n");
+        warn("    This checkpoint will not restore correctly " \
+             "and dirty data in the victim cache will be lost!\n");
+    }
+
+    // as for BaseCache, the contents are not checkpointed
+    bool bad_checkpoint(dirty);
+    SERIALIZE_SCALAR(bad_checkpoint);
+}
+
+void
+VictimCache::unserialize(CheckpointIn &cp)
+{
+    bool bad_checkpoint;
+    UNSERIALIZE_SCALAR(bad_checkpoint);
+    if (bad_checkpoint) {
+        fatal("Restoring from checkpoints with dirty caches is not "
+              "supported in the classic memory system. Please remove any "
+              "caches or drain them properly before taking checkpoints.\n");
+    }
+}
+
+VictimCache::VictimCacheStats::VictimCacheStats(VictimCache &victim)
+    : statistics::Group(&victim),
+      ADD_STAT(insertions, statistics::units::Count::get(),
+               "Number of lines captured from the L1"),
+      ADD_STAT(hits, statistics::units::Count::get(),
+               "Number of L1 misses serviced by the victim cache"),
+      ADD_STAT(misses, statistics::units::Count::get(),
+               "Number of L1 misses passed to the next level"),
+      ADD_STAT(hitRate, statistics::units::Ratio::get(),
+               "Fraction of L1 misses serviced by the victim cache"),
+      ADD_STAT(evictions, statistics::units::Count::get(),
+               "Number of lines replaced to make room for new ones"),
+      ADD_STAT(flushes, statistics::units::Count::get(),
+               "Number of lines written back as a request could not "
+               "use them"),
+      ADD_STAT(writebacks, statistics::units::Count::get(),
+               "Number of writebacks and WriteCleans sent below"),
+      ADD_STAT(snoopResponses, statistics::units::Count::get(),
+               "Number of snoops responded to with data"),
+      ADD_STAT(snoopInvalidations, statistics::units::Count::get(),
+               "Number of lines invalidated by snoops")
+{
+}
+
+void
+VictimCache::VictimCacheStats::regStats()
+{
+    statistics::Group::regStats();
+
+    hitRate.precision(6);
+    hitRate = hits / (hits + misses);
+}
+
+} // namespace gem5
@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * A small fully-associative victim cache placed between a private L1
+ * cache and the next level of the classic memory system.
+ */
+
+#ifndef __MEM_CACHE_VICTIM_CACHE_HH__
+#define __MEM_CACHE_VICTIM_CACHE_HH__
+
+#include <deque>
+#include <string>
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "mem/cache/victim_cache_tags.hh"
+#include "mem/packet.hh"
+#include "mem/packet_queue.hh"
+#include "mem/port.hh"
+#include "mem/qport.hh"
+#include "params/VictimCache.hh"
+#include "sim/clocked_object.hh"
+#include "sim/serialize.hh"
+
+namespace gem5
+{
+
+/**
+ * A victim cache captures the lines written back by the L1 above it,
+ * and returns them on a later L1 miss, exchanging the line with the L1
+ * so that a line is never held in both. As the L1 sends a writeback
+ * for every dirty eviction, and optionally for clean ones, this only
+ * needs the packets the L1 sends anyway, and no MSHRs or tags of its
+ * own.
+ *
+ * Requests that the victim cache cannot service are forwarded as they
+ * are, at the tick they arrive, so the crossbar below sees them in the
+ * same order as without the victim cache. The lines held here still
+ * look cached by the L1 to the snoop filter below, so the victim cache
+ * responds to snoops for them like the L1 would. Lines are written back
+ * below when they are evicted, or when a request needs a state that
+ * cannot be handed over, e.g. a read of an Owned line.
+ */
+class VictimCache : public ClockedObject
+{
+  public:
+    PARAMS(VictimCache);
+    VictimCache(const Params &p);
+
+    Port &getPort(const std::string &if_name,
+                  PortID idx=InvalidPortID) override;
+
+    void init() override;
+
+    DrainState drain() override;
+
+    void memWriteback() override;
+    void memInvalidate() override;
+
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
+
+  protected:
+    typedef VictimCacheTags::Entry Entry;
+
+    class CpuSidePort : public QueuedResponsePort
+    {
+      public:
+        CpuSidePort(const std::string &_name, VictimCache &_victim);
+
+        /** Queue for our hit responses and forwarded responses. */
+        RespPacketQueue queue;
+
+      protected:
+        bool recvTimingReq(PacketPtr pkt) override
+        { return victim.recvTimingReq(pkt); }
+
+        bool recvTimingSnoopResp(PacketPtr pkt) override
+        { return victim.recvTimingSnoopResp(pkt); }
+
+        Tick recvAtomic(PacketPtr pkt) override
+        { return victim.recvAtomic(pkt); }
+
+        void recvFunctional(PacketPtr pkt) override
+        { victim.recvFunctional(pkt); }
+
+        AddrRangeList getAddrRanges() const override
+        { return victim.getAddrRanges(); }
+
+      private:
+        VictimCache &victim;
+    };
+
+    class MemSidePort : public RequestPort
+    {
+      public:
+        MemSidePort(const std::string &_name, VictimCache &_victim);
+
+        /** Queue for our snoop responses and forwarded ones. */
+        SnoopRespPacketQueue snoopRespQueue;
+
+      protected:
+        bool recvTimingResp(PacketPtr pkt) override
+        { return victim.recvTimingResp(pkt); }
+
+        void recvTimingSnoopReq(PacketPtr pkt) override
+        { victim.recvTimingSnoopReq(pkt); }
+
+        Tick recvAtomicSnoop(PacketPtr pkt) override
+        { return victim.recvAtomicSnoop(pkt); }
+
+        void recvFunctionalSnoop(PacketPtr pkt) override
+        { victim.recvFunctionalSnoop(pkt); }
+
+        void recvReqRetry() override { victim.recvReqRetry(); }
+
+        void recvRetrySnoopResp() override { snoopRespQueue.retry(); }
+
+        void recvRangeChange() override { victim.recvRangeChange(); }
+
+        bool isSnooping() const override { return victim.isSnooping(); }
+
+      private:
+        VictimCache &victim;
+    };
+
+    CpuSidePort cpuSidePort;
+    MemSidePort memSidePort;
+
+    /** Line size in bytes. */
+    const unsigned blkSize;
+
+    /** Latency of a request serviced here. */
+    const Cycles hitLatency;
+
+    /** Latency added to the packets passed through. */
+    const Cycles forwardLatency;
+
+    /** The lines held. */
+    VictimCacheTags tags;
+
+    /**
+     * Writebacks generated here that were refused below. They are kept
+     * in order and sent ahead of any request from the L1, and snoops
+     * are checked against them as the data is not below yet.
+     */
+    std::deque<PacketPtr> writebacks;
+
+    /** Whether the port below has refused a packet. */
+    bool waitingOnRetry;
+
+    /** Whether a request from the L1 was refused. */
+    bool mustSendRetry;
+
+    /** Find a writeback waiting to be sent for a packet's line. */
+    std::deque<PacketPtr>::iterator findWriteback(PacketPtr pkt);
+
+    /**
+     * Capture a line written back by the L1, evicting the least
+     * recently used entry if the victim cache is full.
+     *
+     * @param pkt The writeback.
+     * @param is_timing Whether to send the eviction in timing mode.
+     */
+    void insert(PacketPtr pkt, bool is_timing);
+
+    /** Create a writeback, or a WriteClean, for an entry. */
+    PacketPtr createWriteback(Entry *entry, MemCmd cmd, PacketId id = 0);
+
+    /**
+     * Create a WriteClean for the data of a queued WritebackDirty, on
+     * behalf of the cache maintenance operation pkt.
+     */
+    PacketPtr createWriteClean(PacketPtr wb_pkt, PacketPtr pkt);
+
+    /** Write back an entry and remove it from the victim cache. */
+    void evict(Entry *entry, bool is_timing);
+
+    /** Send a writeback below in timing mode, or keep it if refused. */
+    void sendWriteback(PacketPtr pkt);
+
+    /** Send the writebacks that were refused, in order. */
+    void sendWritebacks();
+
+    /**
+     * Handle a snoop from below against the entries and the
+     * writebacks not sent yet, after the L1 has seen it.
+     *
+     * @return The latency of the lookup.
+     */
+    Cycles handleSnoop(PacketPtr pkt, bool is_timing);
+
+    /** Send a snoop response with the data of a line. */
+    void sendSnoopResponse(PacketPtr pkt, const uint8_t *blk_data);
+
+    bool recvTimingReq(PacketPtr pkt);
+    bool recvTimingResp(PacketPtr pkt);
+    void recvTimingSnoopReq(PacketPtr pkt);
+    bool recvTimingSnoopResp(PacketPtr pkt);
+    Tick recvAtomic(PacketPtr pkt);
+    Tick recvAtomicSnoop(PacketPtr pkt);
+    void recvFunctional(PacketPtr pkt);
+    void recvFunctionalSnoop(PacketPtr pkt);
+    void recvReqRetry();
+    void recvRangeChange();
+    AddrRangeList getAddrRanges() const;
+    bool isSnooping() const;
+
+    /** Check the entries and writebacks for a functional access. */
+    bool functionalAccess(PacketPtr pkt);
+
+    struct VictimCacheStats : public statistics::Group
+    {
+        VictimCacheStats(VictimCache &victim);
+
+        void regStats() override;
+
+        /** Lines captured from the L1. */
+        statistics::Scalar insertions;
+
+        /** L1 misses serviced here. */
+        statistics::Scalar hits;
+
+        /** L1 misses that were not. */
+        statistics::Scalar misses;
+
+        statistics::Formula hitRate;
+
+        /** Entries replaced to make room for a new one. */
+        statistics::Scalar evictions;
+
+        /** Entries written back as a request could not use them. */
+        statistics::Scalar flushes;
+
+        /** Writebacks and WriteCleans sent below. */
+        statistics::Scalar writebacks;
+
+        /** Snoops responded to with data from here. */
+        statistics::Scalar snoopResponses;
+
+        /** Entries invalidated by a snoop. */
+        statistics::Scalar snoopInvalidations;
+    } stats;
+};
+
+} // namespace gem5
+
+#endif // __MEM_CACHE_VICTIM_CACHE_HH__
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/victim_cache_tags.hh"
+
+#include <algorithm>
+#include <cassert>
+
+#include "base/cprintf.hh"
+
+namespace gem5
+{
+
+void
+VictimCacheTags::Entry::print(std::ostream &os, int verbosity,
+                              const std::string &prefix) const
+{
+    ccprintf(os, "%s%s\n", prefix, print());
+}
+
+std::string
+VictimCacheTags::Entry::print() const
+{
+    return csprintf("%#x (%s) valid: %d writable: %d dirty: %d", addr,
+                    secure ? "s" : "ns", valid, writable, dirty);
+}
+
+VictimCacheTags::VictimCacheTags(unsigned num_entries, unsigned blk_size)
+    : blkSize(blk_size), entries(num_entries), touchCounter(0)
+{
+    for (auto &entry : entries)
+        entry.data.resize(blkSize);
+    entryIndex.reserve(entries.size());
+}
+
+VictimCacheTags::Entry *
+VictimCacheTags::findEntry(PacketPtr pkt)
+{
+    auto it = entryIndex.find(indexKey(pkt->getBlockAddr(blkSize),
+                                       pkt->isSecure()));
+    return it == entryIndex.end() ? nullptr : &entries[it->second];
+}
+
+VictimCacheTags::Entry *
+VictimCacheTags::findVictim()
+{
+    Entry *victim = nullptr;
+    for (auto &candidate : entries) {
+        if (!candidate.valid)
+            return &candidate;
+        if (!victim || candidate.lastTouch < victim->lastTouch)
+            victim = &candidate;
+    }
+    return victim;
+}
+
+void
+VictimCacheTags::insert(PacketPtr pkt, Entry *entry)
+{
+    assert(pkt->isWriteback() && pkt->getSize() == blkSize);
+
+    if (!entry->valid) {
+        entry->addr = pkt->getBlockAddr(blkSize);
+        entry->secure = pkt->isSecure();
+        entry->valid = true;
+        entryIndex[indexKey(entry->addr, entry->secure)] =
+            entry - entries.data();
+    }
+    assert(entry->addr == pkt->getBlockAddr(blkSize) &&
+           entry->secure == pkt->isSecure());
+
+    entry->dirty = pkt->cmd == MemCmd::WritebackDirty;
+    entry->writable = !pkt->hasSharers();
+    entry->taskId = pkt->req->taskId();
+    touch(entry);
+    pkt->writeDataToBlock(entry->data.data(), blkSize);
+}
+
+void
+VictimCacheTags::invalidate(Entry *entry)
+{
+    assert(entry->valid);
+    entryIndex.erase(indexKey(entry->addr, entry->secure));
+    entry->valid = false;
+    entry->dirty = false;
+    entry->writable = false;
+}
+
+bool
+VictimCacheTags::canService(PacketPtr pkt, const Entry &entry) const
+{
+    if (pkt->cmd != MemCmd::ReadSharedReq &&
+        pkt->cmd != MemCmd::ReadCleanReq &&
+        pkt->cmd != MemCmd::ReadExReq) {
+        return false;
+    }
+
+    // an Owned line has sharers that rely on its dirty data being
+    // written back, and a fill never makes a line Owned in the L1
+    if (entry.dirty && !entry.writable)
+        return false;
+    if (entry.dirty && pkt->cmd == MemCmd::ReadCleanReq)
+        return false;
+
+    return entry.writable || !pkt->needsWritable();
+}
+
+void
+VictimCacheTags::service(PacketPtr pkt, Entry *entry)
+{
+    assert(canService(pkt, *entry));
+
+    // hand the line back in the state it was evicted in, see
+    // BaseCache::handleFill for how the flags set the state
+    if (!entry->writable) {
+        pkt->setHasSharers();
+    } else if (entry->dirty) {
+        pkt->setCacheResponding();
+    }
+    pkt->setDataFromBlock(entry->data.data(), blkSize);
+
+    invalidate(entry);
+}
+
+bool
+VictimCacheTags::isDirty() const
+{
+    return std::any_of(entries.begin(), entries.end(),
+        [](const Entry &entry) { return entry.valid && entry.dirty; });
+}
+
+} // namespace gem5
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * The lines held by a victim cache, and the rules for handing them back
+ * to the L1 above it.
+ */
+
+#ifndef __MEM_CACHE_VICTIM_CACHE_TAGS_HH__
+#define __MEM_CACHE_VICTIM_CACHE_TAGS_HH__
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/printable.hh"
+#include "base/types.hh"
+#include "mem/packet.hh"
+
+namespace gem5
+{
+
+/**
+ * The fully-associative, LRU replaced lines of a VictimCache. A line
+ * is captured from a writeback of the L1 in the state the L1 had it
+ * in, and is handed back to a later L1 request in that state if the
+ * request can take it, leaving the victim cache.
+ */
+class VictimCacheTags
+{
+  public:
+    /** A line evicted from the L1. */
+    class Entry : public Printable
+    {
+      public:
+        Addr addr = MaxAddr;
+        bool secure = false;
+        bool valid = false;
+        bool dirty = false;
+        bool writable = false;
+        uint32_t taskId = 0;
+        /** Last time the entry was touched, for LRU replacement. */
+        uint64_t lastTouch = 0;
+        std::vector<uint8_t> data;
+
+        void print(std::ostream &os, int verbosity = 0,
+                   const std::string &prefix = "") const override;
+
+        /** Pretty-print the entry, for debugging. */
+        std::string print() const;
+    };
+
+  private:
+    /** Line size in bytes. */
+    const unsigned blkSize;
+
+    /** The lines held, fully associative. */
+    std::vector<Entry> entries;
+
+    /** Index of the valid entries by line address and security. */
+    std::unordered_map<Addr, unsigned> entryIndex;
+
+    /** Counter used as a timestamp for LRU replacement. */
+    uint64_t touchCounter;
+
+    /** Get the key of a line in the entry index. */
+    static Addr
+    indexKey(Addr blk_addr, bool secure)
+    {
+        return blk_addr | (secure ? 1 : 0);
+    }
+
+  public:
+    VictimCacheTags(unsigned num_entries, unsigned blk_size);
+
+    /** Number of lines that can be held. */
+    size_t size() const { return entries.size(); }
+
+    std::vector<Entry>::iterator begin() { return entries.begin(); }
+    std::vector<Entry>::iterator end() { return entries.end(); }
+
+    /** Find the entry of the line accessed by a packet, if any. */
+    Entry *findEntry(PacketPtr pkt);
+
+    /**
+     * Find the entry to capture a new line in: a free entry, or else
+     * the least recently used one, which must be evicted first.
+     */
+    Entry *findVictim();
+
+    /**
+     * Capture a line written back by the L1, in the state the
+     * writeback tells, Modified, Owned, Exclusive or Shared.
+     *
+     * @param pkt The writeback.
+     * @param entry The entry of the line, or the one to capture it in.
+     */
+    void insert(PacketPtr pkt, Entry *entry);
+
+    /** Make an entry the most recently used. */
+    void touch(Entry *entry) { entry->lastTouch = ++touchCounter; }
+
+    /** Remove a line. */
+    void invalidate(Entry *entry);
+
+    /**
+     * Whether a read from the L1 can be serviced from an entry without
+     * losing data or permissions. A line is handed over with the state
+     * the L1 gave it, so an Owned line cannot be given back, nor dirty
+     * data to a request for a clean line.
+     */
+    bool canService(PacketPtr pkt, const Entry &entry) const;
+
+    /**
+     * Turn a request into a response with the line of an entry, and
+     * remove the line.
+     */
+    void service(PacketPtr pkt, Entry *entry);
+
+    /** Whether any entry holds dirty data. */
+    bool isDirty() const;
+};
+
+} // namespace gem5
+
+#endif // __MEM_CACHE_VICTIM_CACHE_TAGS_HH__
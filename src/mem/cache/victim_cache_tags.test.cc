@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "mem/cache/victim_cache_tags.hh"
+#include "mem/packet.hh"
+#include "mem/request.hh"
+#include "sim/eventq.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+const unsigned blkSize = 64;
+
+/** The states a line can be captured in, as the L1 evicted it */
+enum class State { Modified, Owned, Exclusive, Shared };
+
+class VictimCacheTagsTest : public testing::Test
+{
+  protected:
+    EventQueue eventQueue{"victim_cache_tags_test"};
+    VictimCacheTags tags{4, blkSize};
+    std::vector<std::unique_ptr<Packet>> packets;
+
+    void SetUp() override { curEventQueue(&eventQueue); }
+
+    PacketPtr
+    makePacket(Addr addr, MemCmd cmd)
+    {
+        auto req = std::make_shared<Request>(addr, blkSize, 0, 0);
+        packets.emplace_back(new Packet(req, cmd, blkSize));
+        packets.back()->allocate();
+        return packets.back().get();
+    }
+
+    /** Capture a line as the victim cache does, filled with a byte */
+    VictimCacheTags::Entry *
+    capture(Addr addr, State state, uint8_t fill = 0)
+    {
+        const bool dirty = state == State::Modified ||
+            state == State::Owned;
+        PacketPtr pkt = makePacket(addr, dirty ? MemCmd::WritebackDirty :
+                                                 MemCmd::WritebackClean);
+        if (state == State::Owned || state == State::Shared)
+            pkt->setHasSharers();
+        std::vector<uint8_t> data(blkSize, fill);
+        pkt->setData(data.data());
+
+        VictimCacheTags::Entry *entry = tags.findEntry(pkt);
+        if (!entry)
+            entry = tags.findVictim();
+        EXPECT_FALSE(entry->valid && entry->addr != addr)
+            << "the victim cache evicts the line before the capture";
+        tags.insert(pkt, entry);
+        return entry;
+    }
+
+    VictimCacheTags::Entry *
+    find(Addr addr)
+    {
+        return tags.findEntry(makePacket(addr, MemCmd::ReadSharedReq));
+    }
+};
+
+TEST_F(VictimCacheTagsTest, CaptureKeepsTheL1State)
+{
+    const std::vector<std::pair<State, std::pair<bool, bool>>> states = {
+        {State::Modified, {true, true}},
+        {State::Owned, {true, false}},
+        {State::Exclusive, {false, true}},
+        {State::Shared, {false, false}},
+    };
+
+    Addr addr = 0;
+    for (const auto &[state, flags] : states) {
+        auto *entry = capture(addr, state, 0x5a);
+        ASSERT_EQ(find(addr), entry);
+        EXPECT_TRUE(entry->valid);
+        EXPECT_EQ(entry->dirty, flags.first);
+        EXPECT_EQ(entry->writable, flags.second);
+        EXPECT_EQ(entry->data, std::vector<uint8_t>(blkSize, 0x5a));
+        addr += blkSize;
+    }
+    EXPECT_TRUE(tags.isDirty());
+
+    // a later writeback of the same line updates it in place
+    auto *entry = find(0);
+    EXPECT_EQ(capture(0, State::Shared, 0x11), entry);
+    EXPECT_FALSE(entry->dirty);
+    EXPECT_FALSE(entry->writable);
+    EXPECT_EQ(entry->data, std::vector<uint8_t>(blkSize, 0x11));
+}
+
+/**
+ * Which requests a line can be handed back to, for each state it was
+ * captured in, and the state the flags of the response give the L1.
+ * Any other request flushes the line below first.
+ */
+TEST_F(VictimCacheTagsTest, ServiceOrFlush)
+{
+    struct Case
+    {
+        State state;
+        MemCmd::Command cmd;
+        bool service;
+    };
+    const std::vector<Case> cases = {
+        {State::Modified, MemCmd::ReadSharedReq, true},
+        {State::Modified, MemCmd::ReadCleanReq, false},
+        {State::Modified, MemCmd::ReadExReq, true},
+        {State::Modified, MemCmd::UpgradeReq, false},
+        {State::Owned, MemCmd::ReadSharedReq, false},
+        {State::Owned, MemCmd::ReadCleanReq, false},
+        {State::Owned, MemCmd::ReadExReq, false},
+        {State::Exclusive, MemCmd::ReadSharedReq, true},
+        {State::Exclusive, MemCmd::ReadCleanReq, true},
+        {State::Exclusive, MemCmd::ReadExReq, true},
+        {State::Exclusive, MemCmd::ReadReq, false},
+        {State::Shared, MemCmd::ReadSharedReq, true},
+        {State::Shared, MemCmd::ReadCleanReq, true},
+        {State::Shared, MemCmd::ReadExReq, false},
+        {State::Shared, MemCmd::UpgradeReq, false},
+        {State::Shared, MemCmd::WriteReq, false},
+    };
+
+    for (const auto &c : cases) {
+        SCOPED_TRACE(testing::Message() << "state " << int(c.state)
+                     << " cmd " << MemCmd(c.cmd).toString());
+        auto *entry = capture(0x1000, c.state, 0xc3);
+        PacketPtr pkt = makePacket(0x1000, c.cmd);
+        ASSERT_EQ(tags.canService(pkt, *entry), c.service);
+        if (!c.service) {
+            // the line stays for the victim cache to flush
+            EXPECT_EQ(find(0x1000), entry);
+            tags.invalidate(entry);
+            continue;
+        }
+
+        tags.service(pkt, entry);
+        EXPECT_EQ(find(0x1000), nullptr);
+        EXPECT_FALSE(entry->valid);
+        EXPECT_EQ(pkt->cacheResponding(), c.state == State::Modified);
+        EXPECT_EQ(pkt->hasSharers(), c.state == State::Shared);
+        for (unsigned i = 0; i < blkSize; i++)
+            ASSERT_EQ(pkt->getConstPtr<uint8_t>()[i], 0xc3);
+    }
+    EXPECT_FALSE(tags.isDirty());
+}
+
+TEST_F(VictimCacheTagsTest, ReplacesLeastRecentlyUsed)
+{
+    // free entries are used first
+    for (Addr addr = 0; addr < 4 * blkSize; addr += blkSize)
+        capture(addr, State::Exclusive);
+
+    tags.touch(find(0));
+    auto *victim = tags.findVictim();
+    ASSERT_TRUE(victim->valid);
+    EXPECT_EQ(victim->addr, blkSize);
+
+    // a line that leaves frees its entry
+    tags.invalidate(find(2 * blkSize));
+    EXPECT_FALSE(tags.findVictim()->valid);
+    EXPECT_EQ(find(2 * blkSize), nullptr);
+}
+
+TEST_F(VictimCacheTagsTest, SecureLinesAreDistinct)
+{
+    auto req = std::make_shared<Request>(0x40, blkSize, Request::SECURE, 0);
+    Packet secure_wb(req, MemCmd::WritebackDirty, blkSize);
+    secure_wb.allocate();
+
+    capture(0x40, State::Exclusive);
+    EXPECT_EQ(tags.findEntry(&secure_wb), nullptr);
+
+    auto *entry = tags.findVictim();
+    tags.insert(&secure_wb, entry);
+    EXPECT_EQ(tags.findEntry(&secure_wb), entry);
+    EXPECT_TRUE(entry->secure);
+    EXPECT_NE(find(0x40), entry);
+}
+
+} // anonymous namespace
@@ -67,10 +67,8 @@ WriteQueue::allocate(Addr blk_addr, unsigned blk_size, PacketPtr pkt,
     freeList.pop_front();
 
     entry->allocate(blk_addr, blk_size, pkt, when_ready, order);
-    entry->allocIter = allocatedList.insert(allocatedList.end(), entry);
-    entry->readyIter = addToReadyList(entry);
+    insertAllocated(entry);
 
-    allocated += 1;
     return entry;
 }
 
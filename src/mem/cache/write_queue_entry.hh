@@ -96,12 +96,6 @@ class WriteQueueEntry : public QueueEntry, public Printable
 
   private:
 
-    /**
-     * Pointer to this entry on the ready list.
-     * @sa MissQueue, WriteQueue::readyList
-     */
-    Iterator readyIter;
-
     /**
      * Pointer to this entry on the allocated list.
      * @sa MissQueue, WriteQueue::allocatedList
@@ -45,6 +45,7 @@
 
 #include "mem/coherent_xbar.hh"
 
+#include "base/cast.hh"
 #include "base/compiler.hh"
 #include "base/logging.hh"
 #include "base/trace.hh"
@@ -263,6 +264,8 @@ CoherentXBar::recvTimingReq(PacketPtr pkt, PortID cpu_side_port_id)
 
     // in certain cases the crossbar is responsible for responding
     bool respond_directly = false;
+    // on the fast path the packet carries the route of its response
+    bool route_in_pkt = false;
     // store the original address as an address mapper could possibly
     // modify the address upon a sendTimingRequest
     const Addr addr(pkt->getAddr());
@@ -289,8 +292,18 @@ CoherentXBar::recvTimingReq(PacketPtr pkt, PortID cpu_side_port_id)
                 pkt->clearWriteThrough();
             }
 
+            if (fastPath && expect_response) {
+                route_in_pkt = true;
+                pkt->pushSenderState(new RouteState(cpu_side_port_id));
+            }
+
             // since it is a normal request, attempt to send the packet
             success = memSidePorts[mem_side_port_id]->sendTimingReq(pkt);
+
+            if (!success && route_in_pkt) {
+                delete pkt->popSenderState();
+                route_in_pkt = false;
+            }
         } else {
             // no need to forward, turn this packet around and respond
             // directly
@@ -305,6 +318,10 @@ CoherentXBar::recvTimingReq(PacketPtr pkt, PortID cpu_side_port_id)
     if (snoopFilter && snoop_caches) {
         // Let the snoop filter know about the success of the send operation
         snoopFilter->finishRequest(!success, addr, pkt->isSecure());
+
+        // invalidate the lines the filter evicted to make room
+        if (snoopFilter->hasBackInvalidations())
+            sendBackInvalidations(true);
     }
 
     // check if we were successful in sending the packet onwards
@@ -339,7 +356,7 @@ CoherentXBar::recvTimingReq(PacketPtr pkt, PortID cpu_side_port_id)
             }
 
             // remember where to route the normal response to
-            if (expect_response || expect_snoop_resp) {
+            if ((expect_response && !route_in_pkt) || expect_snoop_resp) {
                 assert(routeTo.find(pkt->req) == routeTo.end());
                 routeTo[pkt->req] = cpu_side_port_id;
 
@@ -449,10 +466,14 @@ CoherentXBar::recvTimingResp(PacketPtr pkt, PortID mem_side_port_id)
     // determine the source port based on the id
     RequestPort *src_port = memSidePorts[mem_side_port_id];
 
-    // determine the destination
-    const auto route_lookup = routeTo.find(pkt->req);
-    assert(route_lookup != routeTo.end());
-    const PortID cpu_side_port_id = route_lookup->second;
+    // determine the destination, which on the fast path the packet
+    // carries itself
+    const auto route_lookup =
+        fastPath ? routeTo.end() : routeTo.find(pkt->req);
+    assert(fastPath || route_lookup != routeTo.end());
+    const PortID cpu_side_port_id = fastPath ?
+        safe_cast<RouteState *>(pkt->senderState)->port :
+        route_lookup->second;
     assert(cpu_side_port_id != InvalidPortID);
     assert(cpu_side_port_id < respLayers.size());
 
@@ -486,6 +507,12 @@ CoherentXBar::recvTimingResp(PacketPtr pkt, PortID mem_side_port_id)
         snoopFilter->updateResponse(pkt, *cpuSidePorts[cpu_side_port_id]);
     }
 
+    // remove the request from the routing table
+    if (fastPath)
+        delete pkt->popSenderState();
+    else
+        routeTo.erase(route_lookup);
+
     // send the packet through the destination CPU-side port and pay for
     // any outstanding header delay
     Tick latency = pkt->headerDelay;
@@ -493,9 +520,6 @@ CoherentXBar::recvTimingResp(PacketPtr pkt, PortID mem_side_port_id)
     cpuSidePorts[cpu_side_port_id]->schedTimingResp(pkt, curTick()
                                         + latency);
 
-    // remove the request from the routing table
-    routeTo.erase(route_lookup);
-
     respLayers[cpu_side_port_id]->succeededTiming(packetFinishTime);
 
     // stats updates
@@ -724,6 +748,41 @@ CoherentXBar::forwardTiming(PacketPtr pkt, PortID exclude_cpu_side_port_id,
     snoopFanout.sample(fanout);
 }
 
+void
+CoherentXBar::sendBackInvalidations(bool is_timing)
+{
+    for (const auto &inval : snoopFilter->takeBackInvalidations()) {
+        // a clean and invalidate with no destination makes the holders,
+        // and the caches above them, write back any dirty copy to the
+        // level below this crossbar and drop the line
+        Request::Flags flags = Request::CLEAN | Request::INVALIDATE;
+        if (inval.isSecure)
+            flags.set(Request::SECURE);
+        RequestPtr req = std::make_shared<Request>(
+            inval.addr, system->cacheLineSize(), flags,
+            Request::wbRequestorId);
+        Packet pkt(req, MemCmd::CleanInvalidReq);
+
+        DPRINTF(CoherentXBar, "%s: %s to %d holders\n", __func__,
+                pkt.print(), inval.holders.size());
+
+        if (is_timing) {
+            pkt.setExpressSnoop();
+            forwardTiming(&pkt, InvalidPortID, inval.holders);
+        } else {
+            forwardAtomic(&pkt, InvalidPortID, InvalidPortID,
+                          inval.holders);
+        }
+
+        // caches never respond to cache maintenance snoops, the
+        // data travels down as a separate write
+        panic_if(pkt.cacheResponding(), "%s: unexpected response to %s\n",
+                 name(), pkt.print());
+
+        snoops += inval.holders.size();
+    }
+}
+
 void
 CoherentXBar::recvReqRetry(PortID mem_side_port_id)
 {
@@ -773,6 +832,10 @@ CoherentXBar::recvAtomicBackdoor(PacketPtr pkt, PortID cpu_side_port_id,
             // between and change the filter state
             snoopFilter->finishRequest(false, pkt->getAddr(), pkt->isSecure());
 
+            // invalidate the lines the filter evicted to make room
+            if (snoopFilter->hasBackInvalidations())
+                sendBackInvalidations(false);
+
             if (pkt->isEviction()) {
                 // for block-evicting packets, i.e. writebacks and
                 // clean evictions, there is no need to snoop up, as
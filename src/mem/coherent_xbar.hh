@@ -337,6 +337,16 @@ class CoherentXBar : public BaseXBar
     void forwardTiming(PacketPtr pkt, PortID exclude_cpu_side_port_id,
                        const std::vector<QueuedResponsePort*>& dests);
 
+    /**
+     * Invalidate the lines that the snoop filter evicted in the ports
+     * still holding them. This is done once the filter is done with a
+     * request, as any resulting writebacks may come back through this
+     * crossbar.
+     *
+     * @param is_timing Send timing rather than atomic snoops
+     */
+    void sendBackInvalidations(bool is_timing);
+
     Tick recvAtomicBackdoor(PacketPtr pkt, PortID cpu_side_port_id,
                             MemBackdoorPtr *backdoor=nullptr);
     Tick recvAtomicSnoop(PacketPtr pkt, PortID mem_side_port_id);
@@ -0,0 +1,439 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/compressed_mem_ctrl.hh"
+
+#include <algorithm>
+#include <cstring>
+
+#include "base/intmath.hh"
+#include "base/trace.hh"
+#include "debug/MemCtrl.hh"
+#include "mem/cache/compressors/base.hh"
+#include "mem/mem_interface.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+CompressedMemCtrl::CompressedMemCtrl(const CompressedMemCtrlParams &p) :
+    MemCtrl(p),
+    compressor(p.compressor), lineSize(p.line_size),
+    linesPerMetadataBlock(dram->bytesPerBurst() * 8 /
+                          p.metadata_bits_per_line),
+    metadataOffset(0),
+    metadataCache(p.metadata_cache_size / dram->bytesPerBurst(),
+                  p.metadata_cache_assoc),
+    lineBuffer(p.line_size / sizeof(uint64_t)),
+    compressionStats(*this)
+{
+    const unsigned burst_size = dram->bytesPerBurst();
+    fatal_if(compressor == nullptr,
+             "CompressedMemCtrl needs a compressor.\n");
+    fatal_if(!isPowerOf2(lineSize) || lineSize < burst_size,
+             "CompressedMemCtrl's line size must be a power of two of at "
+             "least a burst.\n");
+    fatal_if(compressor->getBlockSize() != lineSize,
+             "CompressedMemCtrl's compressor must compress lines of %d "
+             "bytes.\n", lineSize);
+    fatal_if(p.metadata_bits_per_line == 0 || linesPerMetadataBlock == 0,
+             "CompressedMemCtrl's metadata of a line must be between 1 bit "
+             "and a burst.\n");
+
+    // the metadata blocks take the top of the media, which the host
+    // can then not access
+    const AddrRange &range = dram->getAddrRange();
+    fatal_if(range.interleaved(),
+             "CompressedMemCtrl can not take its metadata out of an "
+             "interleaved range.\n");
+    const uint64_t num_groups =
+        divCeil(range.size(), uint64_t(lineSize) * linesPerMetadataBlock);
+    fatal_if(num_groups * burst_size >= range.size(),
+             "CompressedMemCtrl's media is too small for its metadata.\n");
+    metadataOffset = roundDown(range.size() - num_groups * burst_size,
+                               lineSize);
+    hostRange = AddrRange(range.start(), range.start() + metadataOffset);
+
+    DPRINTF(MemCtrl, "Compressing %d byte lines, with %d lines per "
+            "metadata block from %#x\n", lineSize, linesPerMetadataBlock,
+            metadataAddr(0));
+}
+
+Addr
+CompressedMemCtrl::metadataAddr(Addr group) const
+{
+    return hostRange.end() + group * dram->bytesPerBurst();
+}
+
+Addr
+CompressedMemCtrl::metadataGroup(Addr addr) const
+{
+    return hostRange.getOffset(addr) / (lineSize * linesPerMetadataBlock);
+}
+
+AddrRangeList
+CompressedMemCtrl::getAddrRanges()
+{
+    return { hostRange };
+}
+
+unsigned
+CompressedMemCtrl::compressedBursts(PacketPtr pkt, Cycles &decomp_lat)
+{
+    const unsigned burst_size = dram->bytesPerBurst();
+    const unsigned line_bursts = lineSize / burst_size;
+    uint8_t *line = reinterpret_cast<uint8_t*>(lineBuffer.data());
+
+    if (pkt->isWrite()) {
+        pkt->writeData(line);
+    } else if (dram->isInAddrMap() && !dram->isNull()) {
+        std::memcpy(line, dram->toHostAddr(pkt->getAddr()), lineSize);
+    } else {
+        // without a backing store there are no values to compress
+        decomp_lat = Cycles(0);
+        compressionStats.compressedBytes += lineSize;
+        return line_bursts;
+    }
+
+    Cycles comp_lat(0);
+    const std::size_t size_bits =
+        compressor->compress(lineBuffer.data(), comp_lat,
+                             decomp_lat)->getSizeBits();
+    if (size_bits >= lineSize * 8) {
+        // the line is kept uncompressed
+        decomp_lat = Cycles(0);
+        compressionStats.compressedBytes += lineSize;
+        return line_bursts;
+    }
+
+    compressionStats.compressedBytes += divCeil(size_bits, 8);
+    return compressedLineBursts(size_bits, lineSize, burst_size);
+}
+
+Addr
+CompressedMemCtrl::lookupMetadata(Addr addr, PacketPtr pkt)
+{
+    const Addr group = metadataGroup(addr);
+
+    // an access to a block still being read hits, as it waits for the
+    // same burst
+    const CompressedMetadataCache::Lookup lookup =
+        metadataCache.access(group, pkt->isWrite());
+    if (lookup.hit) {
+        compressionStats.metadataHits++;
+        return MaxAddr;
+    }
+
+    compressionStats.metadataMisses++;
+    if (lookup.victim != MaxAddr) {
+        DPRINTF(MemCtrl, "Writing back the metadata of group %d\n",
+                lookup.victim);
+        assert(!writeQueueFull(1));
+        // write bursts do not refer to their packet once queued
+        RequestPtr req = std::make_shared<Request>(
+            metadataAddr(lookup.victim), dram->bytesPerBurst(), 0,
+            pkt->requestorId());
+        PacketPtr wb_pkt = new Packet(req, MemCmd::WriteReq);
+        queueBurst(wb_pkt, metadataAddr(lookup.victim), false);
+        delete wb_pkt;
+        compressionStats.metadataWrites++;
+    }
+
+    return metadataAddr(group);
+}
+
+void
+CompressedMemCtrl::queueBurst(PacketPtr pkt, Addr addr, bool is_read)
+{
+    if (!is_read &&
+        isInWriteQueue.find(burstAlign(addr, dram)) != isInWriteQueue.end()) {
+        DPRINTF(MemCtrl, "Merging write burst with existing queue entry\n");
+        stats.mergedWrBursts++;
+        return;
+    }
+
+    MemPacket* mem_pkt = dram->decodePacket(pkt, addr, dram->bytesPerBurst(),
+                                            is_read, dram->pseudoChannel);
+    dram->setupRank(mem_pkt->rank, is_read);
+    mem_pkt->readyTime = MaxTick;
+
+    if (is_read) {
+        stats.readBursts++;
+        readQueue[mem_pkt->qosValue()].push_back(mem_pkt);
+        dram->readQueueSize++;
+    } else {
+        stats.writeBursts++;
+        writeQueue[mem_pkt->qosValue()].push_back(mem_pkt);
+        isInWriteQueue.insert(burstAlign(addr, dram));
+        dram->writeQueueSize++;
+    }
+
+    logRequest(is_read ? MemCtrl::READ : MemCtrl::WRITE,
+               mem_pkt->requestorId(), mem_pkt->qosValue(), addr, 1);
+
+    if (!nextReqEvent.scheduled())
+        schedule(nextReqEvent, curTick());
+}
+
+void
+CompressedMemCtrl::queueRead(PacketPtr pkt, unsigned data_bursts,
+                             Addr metadata_addr)
+{
+    const unsigned burst_size = dram->bytesPerBurst();
+
+    std::vector<Addr> addrs;
+    for (unsigned i = 0; i < data_bursts; i++)
+        addrs.push_back(pkt->getAddr() + i * burst_size);
+    if (metadata_addr != MaxAddr)
+        addrs.push_back(metadata_addr);
+
+    // only issue the bursts the write queue does not hold
+    std::vector<Addr> issued;
+    for (Addr addr : addrs) {
+        stats.readPktSize[ceilLog2(burst_size)]++;
+        stats.readBursts++;
+        stats.requestorReadAccesses[pkt->requestorId()]++;
+
+        bool found_in_wr_q = false;
+        if (isInWriteQueue.find(burstAlign(addr, dram)) !=
+            isInWriteQueue.end()) {
+            for (const auto& vec : writeQueue) {
+                for (const auto& p : vec) {
+                    if (p->addr <= addr &&
+                        addr + burst_size <= p->addr + p->size) {
+                        found_in_wr_q = true;
+                        break;
+                    }
+                }
+                if (found_in_wr_q)
+                    break;
+            }
+        }
+
+        if (found_in_wr_q) {
+            DPRINTF(MemCtrl, "Read to addr %#x serviced by write queue\n",
+                    addr);
+            stats.servicedByWrQ++;
+            stats.bytesReadWrQ += burst_size;
+        } else {
+            issued.push_back(addr);
+        }
+    }
+
+    if (issued.empty()) {
+        accessAndRespond(pkt, frontendLatency, dram);
+        return;
+    }
+
+    if (metadata_addr != MaxAddr)
+        compressionStats.metadataReads++;
+
+    // the bursts are counted against the host packet, which is responded
+    // to once the last one is done
+    BurstHelper* burst_helper = nullptr;
+    if (addrs.size() > 1) {
+        burst_helper = new BurstHelper(addrs.size());
+        burst_helper->burstsServiced = addrs.size() - issued.size();
+    }
+
+    for (Addr addr : issued) {
+        MemPacket* mem_pkt = dram->decodePacket(pkt, addr, burst_size, true,
+                                                dram->pseudoChannel);
+        dram->setupRank(mem_pkt->rank, true);
+        mem_pkt->readyTime = MaxTick;
+        mem_pkt->burstHelper = burst_helper;
+
+        assert(!readQueueFull(1));
+        stats.rdQLenPdf[totalReadQueueSize + respQueue.size()]++;
+
+        readQueue[mem_pkt->qosValue()].push_back(mem_pkt);
+        logRequest(MemCtrl::READ, pkt->requestorId(), pkt->qosValue(),
+                   mem_pkt->addr, 1);
+        dram->readQueueSize++;
+
+        stats.avgRdQLen = totalReadQueueSize + respQueue.size();
+    }
+
+    if (!nextReqEvent.scheduled())
+        schedule(nextReqEvent, curTick());
+}
+
+void
+CompressedMemCtrl::accessAndRespond(PacketPtr pkt, Tick static_latency,
+                                    MemInterface* mem_intr)
+{
+    auto meta = metadataPkts.find(pkt);
+    if (meta != metadataPkts.end()) {
+        metadataPkts.erase(meta);
+        delete pkt;
+        return;
+    }
+
+    auto decomp = decompressionLatency.find(pkt);
+    if (decomp != decompressionLatency.end()) {
+        static_latency += decomp->second;
+        decompressionLatency.erase(decomp);
+    }
+
+    MemCtrl::accessAndRespond(pkt, static_latency, mem_intr);
+}
+
+bool
+CompressedMemCtrl::recvTimingReq(PacketPtr pkt)
+{
+    // only whole lines are compressed
+    if ((pkt->getAddr() & (lineSize - 1)) || pkt->getSize() != lineSize)
+        return MemCtrl::recvTimingReq(pkt);
+
+    DPRINTF(MemCtrl, "recvTimingReq: request %s addr %#x size %d\n",
+            pkt->cmdString(), pkt->getAddr(), pkt->getSize());
+
+    panic_if(pkt->cacheResponding(), "Should not see packets where cache "
+             "is responding");
+
+    panic_if(!(pkt->isRead() || pkt->isWrite()),
+             "Should only see read and writes at memory controller\n");
+
+    panic_if(!hostRange.contains(pkt->getAddr()),
+             "Can't handle address range for packet %s\n", pkt->print());
+
+    const unsigned burst_size = dram->bytesPerBurst();
+    const unsigned line_bursts = lineSize / burst_size;
+
+    qosSchedule( { &readQueue, &writeQueue }, burst_size, pkt);
+
+    // leave room for the line uncompressed and its metadata block, and
+    // for the write back of the dirty metadata block it may evict
+    if (pkt->isWrite()) {
+        if (writeQueueFull(line_bursts + 1) || readQueueFull(1)) {
+            DPRINTF(MemCtrl, "Write queue full, not accepting\n");
+            retryWrReq = true;
+            stats.numWrRetry++;
+            return false;
+        }
+    } else if (readQueueFull(line_bursts + 1)) {
+        DPRINTF(MemCtrl, "Read queue full, not accepting\n");
+        retryRdReq = true;
+        stats.numRdRetry++;
+        return false;
+    } else if (writeQueueFull(1) &&
+               metadataCache.evictsDirty(metadataGroup(pkt->getAddr()))) {
+        // retry the read once the writes drain
+        DPRINTF(MemCtrl, "Write queue full, not accepting read\n");
+        retryWrReq = true;
+        stats.numRdRetry++;
+        return false;
+    }
+
+    // Calc avg gap between requests
+    if (prevArrival != 0) {
+        stats.totGap += curTick() - prevArrival;
+    }
+    prevArrival = curTick();
+
+    Cycles decomp_lat(0);
+    const unsigned data_bursts = compressedBursts(pkt, decomp_lat);
+    const Addr metadata_addr = lookupMetadata(pkt->getAddr(), pkt);
+
+    DPRINTF(MemCtrl, "Line %#x takes %d of %d bursts\n", pkt->getAddr(),
+            data_bursts, line_bursts);
+    compressionStats.savedBursts += line_bursts - data_bursts;
+    if (data_bursts == 0)
+        compressionStats.zeroBurstLines++;
+
+    if (pkt->isWrite()) {
+        compressionStats.lineWrites++;
+        if (metadata_addr != MaxAddr) {
+            // read the block to update the size of the line in it
+            RequestPtr req = std::make_shared<Request>(
+                metadata_addr, burst_size, 0, pkt->requestorId());
+            PacketPtr meta_pkt = new Packet(req, MemCmd::ReadReq);
+            metadataPkts.insert(meta_pkt);
+            queueBurst(meta_pkt, metadata_addr, true);
+            compressionStats.metadataReads++;
+        }
+
+        if (data_bursts != 0) {
+            addToWriteQueue(pkt, data_bursts, dram);
+        } else {
+            accessAndRespond(pkt, frontendLatency, dram);
+        }
+
+        if (!nextReqEvent.scheduled())
+            schedule(nextReqEvent, curTick());
+        stats.writeReqs++;
+        stats.bytesWrittenSys += lineSize;
+    } else {
+        compressionStats.lineReads++;
+        if (decomp_lat != 0)
+            decompressionLatency[pkt] = cyclesToTicks(decomp_lat);
+        queueRead(pkt, data_bursts, metadata_addr);
+        stats.readReqs++;
+        stats.bytesReadSys += lineSize;
+    }
+
+    return true;
+}
+
+CompressedMemCtrl::CompressionStats::CompressionStats(CompressedMemCtrl &ctrl)
+    : statistics::Group(&ctrl, "compression"),
+      ADD_STAT(lineReads, statistics::units::Count::get(),
+               "Number of line reads to compressed lines"),
+      ADD_STAT(lineWrites, statistics::units::Count::get(),
+               "Number of line writes to compressed lines"),
+      ADD_STAT(compressedBytes, statistics::units::Byte::get(),
+               "Total compressed size of the lines accessed"),
+      ADD_STAT(compressionRatio, statistics::units::Ratio::get(),
+               "Average compression ratio of the lines accessed"),
+      ADD_STAT(savedBursts, statistics::units::Count::get(),
+               "Number of data bursts saved by compression"),
+      ADD_STAT(zeroBurstLines, statistics::units::Count::get(),
+               "Number of line accesses that needed no data burst"),
+      ADD_STAT(metadataHits, statistics::units::Count::get(),
+               "Number of hits in the metadata cache"),
+      ADD_STAT(metadataMisses, statistics::units::Count::get(),
+               "Number of misses in the metadata cache"),
+      ADD_STAT(metadataHitRate, statistics::units::Ratio::get(),
+               "Hit rate of the metadata cache"),
+      ADD_STAT(metadataReads, statistics::units::Count::get(),
+               "Number of metadata blocks read from the media"),
+      ADD_STAT(metadataWrites, statistics::units::Count::get(),
+               "Number of dirty metadata blocks written back")
+{
+    compressionRatio.precision(4);
+    compressionRatio = (lineReads + lineWrites) * ctrl.lineSize /
+        compressedBytes;
+
+    metadataHitRate.precision(4);
+    metadataHitRate = metadataHits / (metadataHits + metadataMisses);
+}
+
+} // namespace memory
+} // namespace gem5
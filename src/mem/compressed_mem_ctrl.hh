@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * CompressedMemCtrl declaration
+ */
+
+#ifndef __MEM_COMPRESSED_MEM_CTRL_HH__
+#define __MEM_COMPRESSED_MEM_CTRL_HH__
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "base/addr_range.hh"
+#include "base/statistics.hh"
+#include "mem/compressed_metadata_cache.hh"
+#include "mem/mem_ctrl.hh"
+#include "params/CompressedMemCtrl.hh"
+
+namespace gem5
+{
+
+namespace compression
+{
+class Base;
+} // namespace compression
+
+namespace memory
+{
+
+/**
+ * A memory controller that keeps the lines of its media compressed, in
+ * the style of LCP and Compresso. Every line is compressed with one of
+ * the cache compressors, using the actual data values, and only the
+ * bursts that hold its compressed data are read or written; lines that
+ * compress to nothing, e.g. zero lines, need no data burst at all.
+ *
+ * The compressed size of each line is part of a metadata block that
+ * covers a group of lines. The blocks live in a region at the top of
+ * the media, which is not part of the address ranges the controller
+ * serves, and the controller caches them: an access that misses in
+ * the metadata cache also reads the metadata block, and dirty blocks
+ * are written back when evicted. A read that misses issues its data and
+ * metadata bursts together, and completes once both are done, plus
+ * the time the compressor takes to decompress the line.
+ *
+ * Only accesses of exactly one aligned line are compressed; any other
+ * access goes to the media uncompressed. The data itself is kept
+ * uncompressed in the backing store, so the model only affects timing.
+ */
+class CompressedMemCtrl : public MemCtrl
+{
+  private:
+    /** Compressor applied to the lines */
+    compression::Base* compressor;
+
+    /** Size of a compressed line, in bytes */
+    const unsigned lineSize;
+
+    /** Number of lines covered by a metadata block */
+    const unsigned linesPerMetadataBlock;
+
+    /** Offset, in the media, of the first metadata block */
+    Addr metadataOffset;
+
+    /** Part of the media the host lines are kept in */
+    AddrRange hostRange;
+
+    /** Cache of the metadata blocks */
+    CompressedMetadataCache metadataCache;
+
+    /**
+     * Internal packets of the metadata reads that no host read waits
+     * for, which are dropped once the read is done
+     */
+    std::unordered_set<PacketPtr> metadataPkts;
+
+    /** Decompression latency of the host reads of compressed lines */
+    std::unordered_map<PacketPtr, Tick> decompressionLatency;
+
+    /** Buffer a line is assembled in to be compressed */
+    std::vector<uint64_t> lineBuffer;
+
+    /**
+     * Get the number of bursts a line needs once compressed.
+     *
+     * @param pkt a line sized access, the data of which is written to
+     *            the line if it is a write
+     * @param decomp_lat set to the decompression latency of the line, 0
+     *                   if it is stored uncompressed
+     * @return the number of data bursts
+     */
+    unsigned compressedBursts(PacketPtr pkt, Cycles &decomp_lat);
+
+    /**
+     * Get the group of lines a line belongs to, which share a metadata
+     * block.
+     *
+     * @param addr address of the line
+     * @return the index of its group
+     */
+    Addr metadataGroup(Addr addr) const;
+
+    /**
+     * Look up the metadata block of a line, allocating it on a miss and
+     * writing back the victim if it is dirty. The write queue must have
+     * room for the write back.
+     *
+     * @param addr address of the line
+     * @param pkt the host packet, for the requestor of internal bursts
+     * @return the address of the metadata block if it missed, MaxAddr
+     *         otherwise
+     */
+    Addr lookupMetadata(Addr addr, PacketPtr pkt);
+
+    /**
+     * Get the address of the metadata block of a group of lines.
+     *
+     * @param group index of the group
+     * @return the address of its block in the media
+     */
+    Addr metadataAddr(Addr group) const;
+
+    /**
+     * Queue the read bursts of a host read, which is responded to once
+     * all of them are done. Bursts that hit in the write queue are not
+     * issued.
+     *
+     * @param pkt the host read
+     * @param data_bursts number of data bursts of the line
+     * @param metadata_addr address of its metadata block if it missed,
+     *                      MaxAddr otherwise
+     */
+    void queueRead(PacketPtr pkt, unsigned data_bursts, Addr metadata_addr);
+
+    /**
+     * Queue a burst that no host packet waits for.
+     *
+     * @param pkt packet to decode the burst with
+     * @param addr address of the burst in the media
+     * @param is_read is the burst a read
+     */
+    void queueBurst(PacketPtr pkt, Addr addr, bool is_read);
+
+    /**
+     * Drop the metadata reads nobody waits for, and add the
+     * decompression to the latency of compressed reads.
+     */
+    void accessAndRespond(PacketPtr pkt, Tick static_latency,
+                          MemInterface* mem_intr) override;
+
+    struct CompressionStats : public statistics::Group
+    {
+        CompressionStats(CompressedMemCtrl &ctrl);
+
+        /** Line sized accesses, and their total compressed size */
+        statistics::Scalar lineReads;
+        statistics::Scalar lineWrites;
+        statistics::Scalar compressedBytes;
+        statistics::Formula compressionRatio;
+
+        /** Bursts saved by compression, and lines that needed none */
+        statistics::Scalar savedBursts;
+        statistics::Scalar zeroBurstLines;
+
+        statistics::Scalar metadataHits;
+        statistics::Scalar metadataMisses;
+        statistics::Formula metadataHitRate;
+
+        /** Metadata bursts issued to the media */
+        statistics::Scalar metadataReads;
+        statistics::Scalar metadataWrites;
+    };
+
+    CompressionStats compressionStats;
+
+  public:
+
+    CompressedMemCtrl(const CompressedMemCtrlParams &p);
+
+  protected:
+
+    bool recvTimingReq(PacketPtr pkt) override;
+
+    AddrRangeList getAddrRanges() override;
+};
+
+} // namespace memory
+} // namespace gem5
+
+#endif //__MEM_COMPRESSED_MEM_CTRL_HH__
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/compressed_metadata_cache.hh"
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+unsigned
+compressedLineBursts(std::size_t size_bits, unsigned line_size,
+                     unsigned burst_size)
+{
+    if (size_bits >= std::size_t(line_size) * 8)
+        return line_size / burst_size;
+    return divCeil(divCeil(size_bits, 8), burst_size);
+}
+
+CompressedMetadataCache::CompressedMetadataCache(uint64_t num_entries,
+                                                 unsigned _assoc)
+    : assoc(_assoc), numSets(assoc ? num_entries / assoc : 0),
+      entries(num_entries)
+{
+    fatal_if(numSets == 0 || num_entries != numSets * assoc,
+             "A metadata cache of %d blocks can not have %d ways.\n",
+             num_entries, assoc);
+}
+
+uint64_t
+CompressedMetadataCache::find(Addr group) const
+{
+    const uint64_t set = (group % numSets) * assoc;
+
+    // an invalid way is the least recently used one
+    uint64_t victim = set;
+    for (uint64_t i = set; i < set + assoc; i++) {
+        if (entries[i].group == group)
+            return i;
+        if (entries[i].lastTouch < entries[victim].lastTouch)
+            victim = i;
+    }
+    return victim;
+}
+
+CompressedMetadataCache::Lookup
+CompressedMetadataCache::access(Addr group, bool write)
+{
+    Entry &entry = entries[find(group)];
+
+    Lookup lookup;
+    lookup.hit = entry.group == group;
+    lookup.victim = MaxAddr;
+    if (!lookup.hit) {
+        if (entry.group != MaxAddr && entry.dirty)
+            lookup.victim = entry.group;
+        entry.group = group;
+        entry.dirty = false;
+    }
+
+    entry.dirty |= write;
+    entry.lastTouch = ++touches;
+    return lookup;
+}
+
+bool
+CompressedMetadataCache::evictsDirty(Addr group) const
+{
+    const Entry &entry = entries[find(group)];
+    return entry.group != group && entry.group != MaxAddr && entry.dirty;
+}
+
+} // namespace memory
+} // namespace gem5
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * CompressedMetadataCache declaration
+ */
+
+#ifndef __MEM_COMPRESSED_METADATA_CACHE_HH__
+#define __MEM_COMPRESSED_METADATA_CACHE_HH__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+/**
+ * Get the number of bursts a line takes in the media once compressed.
+ * A line that does not compress below its size is kept uncompressed.
+ *
+ * @param size_bits compressed size of the line, in bits
+ * @param line_size size of the line, in bytes
+ * @param burst_size size of a burst, in bytes
+ * @return the number of data bursts of the line
+ */
+unsigned compressedLineBursts(std::size_t size_bits, unsigned line_size,
+                              unsigned burst_size);
+
+/**
+ * The cache of the metadata blocks of a CompressedMemCtrl, each of which
+ * holds the compressed sizes of a group of lines. The blocks are
+ * replaced in LRU order, and the cache is updated as if each access was
+ * done as soon as it is looked up.
+ */
+class CompressedMetadataCache
+{
+  public:
+    /** The outcome of an access to the cache */
+    struct Lookup
+    {
+        /** Was the block in the cache */
+        bool hit;
+
+        /** Group of a dirty block to write back, MaxAddr if none */
+        Addr victim;
+    };
+
+  private:
+    struct Entry
+    {
+        /** Group of lines the block covers, MaxAddr if invalid */
+        Addr group = MaxAddr;
+        bool dirty = false;
+        /** Last access to the block, for LRU replacement */
+        uint64_t lastTouch = 0;
+    };
+
+    const unsigned assoc;
+    const uint64_t numSets;
+
+    /** Blocks of the cache, indexed by set and way */
+    std::vector<Entry> entries;
+
+    /** Access counter to order the accesses to the blocks */
+    uint64_t touches = 0;
+
+    /** Find the block of a group, or else the block to replace */
+    uint64_t find(Addr group) const;
+
+  public:
+    /**
+     * @param num_entries Number of blocks the cache holds
+     * @param assoc Number of ways of a set
+     */
+    CompressedMetadataCache(uint64_t num_entries, unsigned assoc);
+
+    /**
+     * Look up the block of a group of lines, allocating it on a miss.
+     * A write makes the block dirty.
+     *
+     * @param group Index of the group of lines
+     * @param write Is the access a write
+     * @return What the access found, and the block it evicted
+     */
+    Lookup access(Addr group, bool write);
+
+    /**
+     * Check, without updating the cache, whether an access to a group
+     * would write back a dirty block.
+     *
+     * @param group Index of the group of lines
+     * @return true if the access would evict a dirty block
+     */
+    bool evictsDirty(Addr group) const;
+};
+
+} // namespace memory
+} // namespace gem5
+
+#endif // __MEM_COMPRESSED_METADATA_CACHE_HH__
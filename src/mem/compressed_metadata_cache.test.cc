@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "base/gtest/logging.hh"
+#include "mem/compressed_metadata_cache.hh"
+
+using namespace gem5;
+using namespace gem5::memory;
+
+namespace
+{
+
+const unsigned numSets = 4;
+
+/** Index of the n-th group that maps to the given set */
+Addr
+groupInSet(unsigned set, unsigned n)
+{
+    return n * numSets + set;
+}
+
+} // anonymous namespace
+
+TEST(CompressedLineBurstsTest, SavedBursts)
+{
+    // 64 byte lines over 32 byte bursts, from a zero line, which needs
+    // no burst, to lines that do not compress
+    EXPECT_EQ(compressedLineBursts(0, 64, 32), 0);
+    EXPECT_EQ(compressedLineBursts(1, 64, 32), 1);
+    EXPECT_EQ(compressedLineBursts(256, 64, 32), 1);
+    EXPECT_EQ(compressedLineBursts(257, 64, 32), 2);
+    EXPECT_EQ(compressedLineBursts(511, 64, 32), 2);
+    EXPECT_EQ(compressedLineBursts(512, 64, 32), 2);
+    EXPECT_EQ(compressedLineBursts(600, 64, 32), 2);
+
+    // the compressed bytes are rounded up to whole bursts
+    EXPECT_EQ(compressedLineBursts(8 * 65, 128, 32), 3);
+    EXPECT_EQ(compressedLineBursts(8 * 96, 128, 32), 3);
+    EXPECT_EQ(compressedLineBursts(8 * 97, 128, 32), 4);
+}
+
+TEST(CompressedMetadataCacheTest, MissThenHit)
+{
+    CompressedMetadataCache cache(numSets * 2, 2);
+
+    auto lookup = cache.access(groupInSet(1, 0), false);
+    EXPECT_FALSE(lookup.hit);
+    EXPECT_EQ(lookup.victim, MaxAddr);
+
+    lookup = cache.access(groupInSet(1, 0), false);
+    EXPECT_TRUE(lookup.hit);
+    EXPECT_EQ(lookup.victim, MaxAddr);
+
+    // a group of another set is not confused with it
+    lookup = cache.access(groupInSet(2, 0), true);
+    EXPECT_FALSE(lookup.hit);
+    lookup = cache.access(groupInSet(1, 0), true);
+    EXPECT_TRUE(lookup.hit);
+}
+
+TEST(CompressedMetadataCacheTest, FillsTheInvalidWaysFirst)
+{
+    const unsigned assoc = 4;
+    CompressedMetadataCache cache(numSets * assoc, assoc);
+
+    for (unsigned n = 0; n < assoc; n++) {
+        EXPECT_FALSE(cache.evictsDirty(groupInSet(0, n)));
+        auto lookup = cache.access(groupInSet(0, n), true);
+        EXPECT_FALSE(lookup.hit);
+        EXPECT_EQ(lookup.victim, MaxAddr);
+    }
+    for (unsigned n = 0; n < assoc; n++)
+        EXPECT_TRUE(cache.access(groupInSet(0, n), false).hit);
+}
+
+TEST(CompressedMetadataCacheTest, WritesBackDirtyVictims)
+{
+    CompressedMetadataCache cache(numSets * 2, 2);
+
+    // the least recently used block is replaced, and only written back
+    // if it was written
+    cache.access(groupInSet(3, 0), true);
+    cache.access(groupInSet(3, 1), false);
+    cache.access(groupInSet(3, 0), false);
+
+    EXPECT_FALSE(cache.evictsDirty(groupInSet(3, 2)));
+    auto lookup = cache.access(groupInSet(3, 2), false);
+    EXPECT_FALSE(lookup.hit);
+    EXPECT_EQ(lookup.victim, MaxAddr);
+
+    EXPECT_TRUE(cache.evictsDirty(groupInSet(3, 3)));
+    lookup = cache.access(groupInSet(3, 3), false);
+    EXPECT_FALSE(lookup.hit);
+    EXPECT_EQ(lookup.victim, groupInSet(3, 0));
+
+    // a block is made dirty by a write that hits in it
+    EXPECT_TRUE(cache.access(groupInSet(3, 2), true).hit);
+    cache.access(groupInSet(3, 3), false);
+    lookup = cache.access(groupInSet(3, 0), false);
+    EXPECT_FALSE(lookup.hit);
+    EXPECT_EQ(lookup.victim, groupInSet(3, 2));
+
+    // the block allocated by a read is clean
+    lookup = cache.access(groupInSet(3, 1), false);
+    EXPECT_FALSE(lookup.hit);
+    EXPECT_EQ(lookup.victim, MaxAddr);
+}
+
+TEST(CompressedMetadataCacheTest, CheckingForWriteBacksKeepsTheCache)
+{
+    CompressedMetadataCache cache(numSets, 1);
+
+    cache.access(groupInSet(0, 0), true);
+    EXPECT_FALSE(cache.evictsDirty(groupInSet(0, 0)));
+    EXPECT_TRUE(cache.evictsDirty(groupInSet(0, 1)));
+    EXPECT_TRUE(cache.evictsDirty(groupInSet(0, 1)));
+
+    EXPECT_TRUE(cache.access(groupInSet(0, 0), false).hit);
+    EXPECT_EQ(cache.access(groupInSet(0, 1), false).victim,
+              groupInSet(0, 0));
+    EXPECT_FALSE(cache.evictsDirty(groupInSet(0, 0)));
+}
+
+TEST(CompressedMetadataCacheTest, RejectsBadOrganisations)
+{
+    gtestLogOutput.str("");
+    EXPECT_ANY_THROW(CompressedMetadataCache(8, 0));
+    EXPECT_ANY_THROW(CompressedMetadataCache(8, 3));
+    EXPECT_ANY_THROW(CompressedMetadataCache(2, 4));
+}
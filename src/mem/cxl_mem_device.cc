@@ -0,0 +1,464 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Implementation of the CXLMemDevice Class, modeling the link and
+ * protocol front end of a CXL.mem type-3 memory expander.
+ */
+
+#include "mem/cxl_mem_device.hh"
+
+#include "base/intmath.hh"
+#include "base/trace.hh"
+#include "debug/CXLMemDevice.hh"
+#include "params/CXLMemDevice.hh"
+#include "sim/stats.hh"
+
+namespace gem5
+{
+
+CXLMemDevice::HostPort::HostPort(const std::string& _name,
+                                 CXLMemDevice& _device,
+                                 DevicePort& _device_port,
+                                 int _resp_limit, const AddrRange& _range)
+    : ResponsePort(_name), device(_device), devicePort(_device_port),
+      ranges{_range}, outstandingResponses(0), retryReq(false),
+      respQueueLimit(_resp_limit),
+      sendEvent([this]{ trySendTiming(); }, _name), linkFreeAt(0)
+{
+}
+
+CXLMemDevice::DevicePort::DevicePort(const std::string& _name,
+                                     CXLMemDevice& _device,
+                                     HostPort& _host_port, int _req_limit)
+    : RequestPort(_name), device(_device), hostPort(_host_port),
+      reqQueueLimit(_req_limit),
+      sendEvent([this]{ trySendTiming(); }, _name), linkFreeAt(0)
+{
+}
+
+CXLMemDevice::CXLMemDevice(const CXLMemDeviceParams &p)
+    : ClockedObject(p),
+      cpu_side_port(p.name + ".cpu_side_port", *this, mem_side_port,
+                    p.resp_size, p.range),
+      mem_side_port(p.name + ".mem_side_port", *this, cpu_side_port,
+                    p.req_size),
+      slotSize(p.slot_size), slotsPerFlit(p.slots_per_flit),
+      // the lanes send a bit per lane per cycle of the lane speed, in
+      // Gb/s, i.e. bits per ns
+      flitTicks(divCeil((slotSize * slotsPerFlit + p.flit_overhead) * 8 *
+                        sim_clock::as_int::ns,
+                        p.num_lanes * p.lane_speed)),
+      linkLatency(p.link_latency + p.protocol_latency),
+      stats(*this)
+{
+    fatal_if(slotSize == 0 || slotsPerFlit == 0,
+             "%s needs flits with non-empty slots\n", name());
+    fatal_if(p.num_lanes == 0 || p.lane_speed == 0,
+             "%s needs a non-zero link bandwidth\n", name());
+}
+
+Port&
+CXLMemDevice::getPort(const std::string &if_name, PortID idx)
+{
+    if (if_name == "mem_side_port")
+        return mem_side_port;
+    else if (if_name == "cpu_side_port")
+        return cpu_side_port;
+    else
+        // pass it along to our super class
+        return ClockedObject::getPort(if_name, idx);
+}
+
+void
+CXLMemDevice::init()
+{
+    if (!cpu_side_port.isConnected() || !mem_side_port.isConnected())
+        fatal("Both ports of a CXL memory device must be connected.\n");
+
+    // notify the host side of the device memory range
+    cpu_side_port.sendRangeChange();
+}
+
+unsigned
+CXLMemDevice::numFlits(PacketPtr pkt) const
+{
+    // requests carry data for writes, responses for reads
+    const bool has_data = pkt->isRequest() ? pkt->hasData() :
+        pkt->hasData() && pkt->isRead();
+
+    const unsigned slots = 1 +
+        (has_data ? divCeil(pkt->getSize(), slotSize) : 0);
+
+    return divCeil(slots, slotsPerFlit);
+}
+
+Tick
+CXLMemDevice::crossLink(PacketPtr pkt, Tick &link_free_at, bool request)
+{
+    // the packet only arrives once its header and payload have
+    // reached us
+    const Tick arrival = curTick() + pkt->headerDelay + pkt->payloadDelay;
+    pkt->headerDelay = pkt->payloadDelay = 0;
+
+    const unsigned flits = numFlits(pkt);
+    const Tick start = std::max(arrival, link_free_at);
+    link_free_at = start + flits * flitTicks;
+
+    // the receiver waits for the last flit to check the message, and
+    // hands it on at the next clock edge
+    const Tick when = clockEdge(ticksToCycles(link_free_at + linkLatency -
+                                              curTick()));
+
+    DPRINTF(CXLMemDevice, "%s %s addr %#x: %d flits, waited %d ticks, "
+            "delivered at %d\n", request ? "Request" : "Response",
+            pkt->cmdString(), pkt->getAddr(), flits, start - arrival,
+            when);
+
+    if (request) {
+        stats.reqPackets++;
+        stats.reqFlits += flits;
+        stats.reqOccupancy += flits * flitTicks;
+        stats.totReqQueueLat += start - arrival;
+    } else {
+        stats.respPackets++;
+        stats.respFlits += flits;
+        stats.respOccupancy += flits * flitTicks;
+        stats.totRespQueueLat += start - arrival;
+    }
+
+    return when;
+}
+
+bool
+CXLMemDevice::HostPort::respQueueFull() const
+{
+    return outstandingResponses == respQueueLimit;
+}
+
+bool
+CXLMemDevice::DevicePort::reqQueueFull() const
+{
+    return transmitList.size() == reqQueueLimit;
+}
+
+bool
+CXLMemDevice::DevicePort::recvTimingResp(PacketPtr pkt)
+{
+    // all checks are done when the request is accepted on the host
+    // side, so we are guaranteed to have space for the response
+    DPRINTF(CXLMemDevice, "recvTimingResp: %s addr 0x%x\n",
+            pkt->cmdString(), pkt->getAddr());
+
+    const Tick when = device.crossLink(pkt, hostPort.linkFreeAt, false);
+    hostPort.schedTimingResp(pkt, when);
+
+    return true;
+}
+
+bool
+CXLMemDevice::HostPort::recvTimingReq(PacketPtr pkt)
+{
+    DPRINTF(CXLMemDevice, "recvTimingReq: %s addr 0x%x\n",
+            pkt->cmdString(), pkt->getAddr());
+
+    panic_if(pkt->cacheResponding(), "Should not see packets where cache "
+             "is responding");
+
+    // we should not see a timing request if we are already in a retry
+    assert(!retryReq);
+
+    DPRINTF(CXLMemDevice, "Response queue size: %d outresp: %d\n",
+            transmitList.size(), outstandingResponses);
+
+    // if the request queue is full then there is no hope
+    if (devicePort.reqQueueFull()) {
+        DPRINTF(CXLMemDevice, "Request queue full\n");
+        retryReq = true;
+    } else if (pkt->needsResponse()) {
+        // look at the response queue if we expect to see a response
+        if (respQueueFull()) {
+            DPRINTF(CXLMemDevice, "Response queue full\n");
+            retryReq = true;
+        } else {
+            // ok to send the request with space for the response
+            DPRINTF(CXLMemDevice, "Reserving space for response\n");
+            ++outstandingResponses;
+        }
+    }
+
+    if (!retryReq) {
+        const Tick when = device.crossLink(pkt, devicePort.linkFreeAt,
+                                           true);
+        devicePort.schedTimingReq(pkt, when);
+    }
+
+    // remember that we are now stalling a packet and that we have to
+    // tell the sending requestor to retry once space becomes available,
+    // we make no distinction whether the stalling is due to the
+    // request queue or response queue being full
+    return !retryReq;
+}
+
+void
+CXLMemDevice::HostPort::retryStalledReq()
+{
+    if (retryReq) {
+        DPRINTF(CXLMemDevice, "Request waiting for retry, now retrying\n");
+        retryReq = false;
+        sendRetryReq();
+    }
+}
+
+void
+CXLMemDevice::DevicePort::schedTimingReq(PacketPtr pkt, Tick when)
+{
+    // if we're about to put this packet at the head of the queue, we
+    // need to schedule an event to do the transmit, otherwise there
+    // should already be an event scheduled for sending the head
+    // packet, and as the link keeps the messages in order, the head
+    // packet is always the first to be ready
+    if (transmitList.empty()) {
+        device.schedule(sendEvent, when);
+    }
+
+    assert(transmitList.size() != reqQueueLimit);
+
+    transmitList.emplace_back(pkt, when);
+}
+
+void
+CXLMemDevice::HostPort::schedTimingResp(PacketPtr pkt, Tick when)
+{
+    if (transmitList.empty()) {
+        device.schedule(sendEvent, when);
+    }
+
+    transmitList.emplace_back(pkt, when);
+}
+
+void
+CXLMemDevice::DevicePort::trySendTiming()
+{
+    assert(!transmitList.empty());
+
+    DeferredPacket req = transmitList.front();
+
+    assert(req.tick <= curTick());
+
+    PacketPtr pkt = req.pkt;
+
+    DPRINTF(CXLMemDevice, "trySend request addr 0x%x, queue size %d\n",
+            pkt->getAddr(), transmitList.size());
+
+    if (sendTimingReq(pkt)) {
+        // send successful
+        transmitList.pop_front();
+        DPRINTF(CXLMemDevice, "trySend request successful\n");
+
+        // if there are more packets to send, schedule event to try again
+        if (!transmitList.empty()) {
+            DeferredPacket next_req = transmitList.front();
+            DPRINTF(CXLMemDevice, "Scheduling next send\n");
+            device.schedule(sendEvent, std::max(next_req.tick,
+                                                device.clockEdge()));
+        }
+
+        // if we have stalled a request due to a full request queue,
+        // then send a retry at this point, also note that if the
+        // request we stalled was waiting for the response queue
+        // rather than the request queue we might stall it again
+        hostPort.retryStalledReq();
+    }
+
+    // if the send failed, then we try again once we receive a retry,
+    // and therefore there is no need to take any action
+}
+
+void
+CXLMemDevice::HostPort::trySendTiming()
+{
+    assert(!transmitList.empty());
+
+    DeferredPacket resp = transmitList.front();
+
+    assert(resp.tick <= curTick());
+
+    PacketPtr pkt = resp.pkt;
+
+    DPRINTF(CXLMemDevice, "trySend response addr 0x%x, outstanding %d\n",
+            pkt->getAddr(), outstandingResponses);
+
+    if (sendTimingResp(pkt)) {
+        // send successful
+        transmitList.pop_front();
+        DPRINTF(CXLMemDevice, "trySend response successful\n");
+
+        assert(outstandingResponses != 0);
+        --outstandingResponses;
+
+        // if there are more packets to send, schedule event to try again
+        if (!transmitList.empty()) {
+            DeferredPacket next_resp = transmitList.front();
+            DPRINTF(CXLMemDevice, "Scheduling next send\n");
+            device.schedule(sendEvent, std::max(next_resp.tick,
+                                                device.clockEdge()));
+        }
+
+        // if there is space in the request queue and we were stalling
+        // a request, it will definitely be possible to accept it now
+        // since there is guaranteed space in the response queue
+        if (!devicePort.reqQueueFull() && retryReq) {
+            DPRINTF(CXLMemDevice, "Request waiting for retry, now "
+                    "retrying\n");
+            retryReq = false;
+            sendRetryReq();
+        }
+    }
+
+    // if the send failed, then we try again once we receive a retry,
+    // and therefore there is no need to take any action
+}
+
+void
+CXLMemDevice::DevicePort::recvReqRetry()
+{
+    trySendTiming();
+}
+
+void
+CXLMemDevice::HostPort::recvRespRetry()
+{
+    trySendTiming();
+}
+
+Tick
+CXLMemDevice::HostPort::recvAtomic(PacketPtr pkt)
+{
+    panic_if(pkt->cacheResponding(), "Should not see packets where cache "
+             "is responding");
+
+    // both directions of an uncontended link
+    const Tick req_latency = device.numFlits(pkt) * device.flitTicks +
+        device.linkLatency;
+    const Tick latency = devicePort.sendAtomic(pkt);
+    const Tick resp_latency = pkt->isResponse() ?
+        device.numFlits(pkt) * device.flitTicks + device.linkLatency : 0;
+
+    return req_latency + latency + resp_latency;
+}
+
+void
+CXLMemDevice::HostPort::recvFunctional(PacketPtr pkt)
+{
+    pkt->pushLabel(name());
+
+    // check the response queue
+    for (auto i = transmitList.begin();  i != transmitList.end(); ++i) {
+        if (pkt->trySatisfyFunctional((*i).pkt)) {
+            pkt->makeResponse();
+            return;
+        }
+    }
+
+    // also check the device-side port's request queue
+    if (devicePort.trySatisfyFunctional(pkt)) {
+        return;
+    }
+
+    pkt->popLabel();
+
+    // fall through if pkt still not satisfied
+    devicePort.sendFunctional(pkt);
+}
+
+bool
+CXLMemDevice::DevicePort::trySatisfyFunctional(PacketPtr pkt)
+{
+    bool found = false;
+    auto i = transmitList.begin();
+
+    while (i != transmitList.end() && !found) {
+        if (pkt->trySatisfyFunctional((*i).pkt)) {
+            pkt->makeResponse();
+            found = true;
+        }
+        ++i;
+    }
+
+    return found;
+}
+
+AddrRangeList
+CXLMemDevice::HostPort::getAddrRanges() const
+{
+    return ranges;
+}
+
+CXLMemDevice::CXLMemDeviceStats::CXLMemDeviceStats(CXLMemDevice &device)
+    : statistics::Group(&device),
+      ADD_STAT(reqPackets, statistics::units::Count::get(),
+               "Requests sent across the link"),
+      ADD_STAT(respPackets, statistics::units::Count::get(),
+               "Responses sent across the link"),
+      ADD_STAT(reqFlits, statistics::units::Count::get(),
+               "Flits sent on the request direction of the link"),
+      ADD_STAT(respFlits, statistics::units::Count::get(),
+               "Flits sent on the response direction of the link"),
+      ADD_STAT(reqOccupancy, statistics::units::Tick::get(),
+               "Request direction occupancy (ticks)"),
+      ADD_STAT(respOccupancy, statistics::units::Tick::get(),
+               "Response direction occupancy (ticks)"),
+      ADD_STAT(reqUtilization, statistics::units::Ratio::get(),
+               "Request direction utilization"),
+      ADD_STAT(respUtilization, statistics::units::Ratio::get(),
+               "Response direction utilization"),
+      ADD_STAT(totReqQueueLat, statistics::units::Tick::get(),
+               "Total ticks requests waited for the link"),
+      ADD_STAT(totRespQueueLat, statistics::units::Tick::get(),
+               "Total ticks responses waited for the link"),
+      ADD_STAT(avgReqQueueLat, statistics::units::Rate<
+                    statistics::units::Tick, statistics::units::Count>::get(),
+               "Average ticks a request waited for the link"),
+      ADD_STAT(avgRespQueueLat, statistics::units::Rate<
+                    statistics::units::Tick, statistics::units::Count>::get(),
+               "Average ticks a response waited for the link")
+{
+    reqUtilization.precision(3);
+    respUtilization.precision(3);
+    avgReqQueueLat.precision(2);
+    avgRespQueueLat.precision(2);
+
+    reqUtilization = reqOccupancy / simTicks;
+    respUtilization = respOccupancy / simTicks;
+    avgReqQueueLat = totReqQueueLat / reqPackets;
+    avgRespQueueLat = totRespQueueLat / respPackets;
+}
+
+} // namespace gem5
@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of the CXLMemDevice Class, modeling the link and protocol
+ * front end of a CXL.mem type-3 memory expander.
+ */
+
+#ifndef __MEM_CXL_MEM_DEVICE_HH__
+#define __MEM_CXL_MEM_DEVICE_HH__
+
+#include <deque>
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "mem/port.hh"
+#include "params/CXLMemDevice.hh"
+#include "sim/clocked_object.hh"
+
+namespace gem5
+{
+
+/**
+ * CXLMemDevice models a CXL.mem type-3 memory expander as seen from the
+ * host. Like the SerialLink, it sits between the host and a memory
+ * controller, the device-side controller of the expander, and adds the
+ * latency of crossing a serial link in both directions.
+ *
+ * The link is modelled at the level of flits. Every message takes a
+ * header slot and, if it carries data, as many data slots as it needs,
+ * and the slots are packed into fixed-size flits. Each direction of the
+ * link serialises one flit after the other at the bandwidth given by
+ * the number of lanes and the lane speed, so a message occupies its
+ * direction of the link until its last flit is sent. Once the last flit
+ * has crossed the link, the message is delivered after the link and
+ * protocol latency. As the latency is the same for all messages, the
+ * link never reorders them.
+ */
+class CXLMemDevice : public ClockedObject
+{
+  protected:
+
+    /**
+     * A deferred packet stores a packet along with its scheduled
+     * transmission time
+     */
+    class DeferredPacket
+    {
+
+      public:
+
+        const Tick tick;
+        const PacketPtr pkt;
+
+        DeferredPacket(PacketPtr _pkt, Tick _tick) : tick(_tick), pkt(_pkt)
+        { }
+    };
+
+    // Forward declaration to allow the host port to have a pointer
+    class DevicePort;
+
+    /**
+     * The port on the host side, which receives requests and sends
+     * responses, and has a buffer for the responses not yet sent.
+     */
+    class HostPort : public ResponsePort
+    {
+
+      private:
+
+        /** The device to which this port belongs. */
+        CXLMemDevice& device;
+
+        /** Port on the device side of the link. */
+        DevicePort& devicePort;
+
+        /** Address range of the device memory */
+        const AddrRangeList ranges;
+
+        /**
+         * Response packet queue, holding the responses until they
+         * have crossed the link.
+         */
+        std::deque<DeferredPacket> transmitList;
+
+        /** Counter to track the outstanding responses. */
+        unsigned int outstandingResponses;
+
+        /** If we should send a retry when space becomes available. */
+        bool retryReq;
+
+        /** Max queue size for reserved responses. */
+        const unsigned int respQueueLimit;
+
+        /**
+         * Is this side blocked from accepting new response packets.
+         *
+         * @return true if the reserved space has reached the set limit
+         */
+        bool respQueueFull() const;
+
+        /**
+         * Handle send event, scheduled when the packet at the head of
+         * the response queue is ready to transmit.
+         */
+        void trySendTiming();
+
+        /** Send event for the response queue. */
+        EventFunctionWrapper sendEvent;
+
+      public:
+
+        /** Tick the response direction of the link is free from */
+        Tick linkFreeAt;
+
+        HostPort(const std::string& _name, CXLMemDevice& _device,
+                 DevicePort& _device_port, int _resp_limit,
+                 const AddrRange& _range);
+
+        /**
+         * Queue a response packet to be sent out later and also schedule
+         * a send if necessary.
+         *
+         * @param pkt a response to send out after a delay
+         * @param when tick when response packet should be sent
+         */
+        void schedTimingResp(PacketPtr pkt, Tick when);
+
+        /**
+         * Retry any stalled request that we have failed to accept at
+         * an earlier point in time. This call will do nothing if no
+         * request is waiting.
+         */
+        void retryStalledReq();
+
+      protected:
+
+        bool recvTimingReq(PacketPtr pkt) override;
+
+        void recvRespRetry() override;
+
+        Tick recvAtomic(PacketPtr pkt) override;
+
+        void recvFunctional(PacketPtr pkt) override;
+
+        AddrRangeList getAddrRanges() const override;
+    };
+
+    /**
+     * The port on the device side, which forwards requests to the
+     * device-side memory controller and receives its responses, and has
+     * a buffer for the requests not yet sent.
+     */
+    class DevicePort : public RequestPort
+    {
+
+      private:
+
+        /** The device to which this port belongs. */
+        CXLMemDevice& device;
+
+        /** Port on the host side of the link. */
+        HostPort& hostPort;
+
+        /**
+         * Request packet queue, holding the requests until they have
+         * crossed the link.
+         */
+        std::deque<DeferredPacket> transmitList;
+
+        /** Max queue size for request packets */
+        const unsigned int reqQueueLimit;
+
+        /**
+         * Handle send event, scheduled when the packet at the head of
+         * the request queue is ready to transmit.
+         */
+        void trySendTiming();
+
+        /** Send event for the request queue. */
+        EventFunctionWrapper sendEvent;
+
+      public:
+
+        /** Tick the request direction of the link is free from */
+        Tick linkFreeAt;
+
+        DevicePort(const std::string& _name, CXLMemDevice& _device,
+                   HostPort& _host_port, int _req_limit);
+
+        /**
+         * Is this side blocked from accepting new request packets.
+         *
+         * @return true if the occupied space has reached the set limit
+         */
+        bool reqQueueFull() const;
+
+        /**
+         * Queue a request packet to be sent out later and also schedule
+         * a send if necessary.
+         *
+         * @param pkt a request to send out after a delay
+         * @param when tick when request packet should be sent
+         */
+        void schedTimingReq(PacketPtr pkt, Tick when);
+
+        /**
+         * Check a functional request against the packets in our
+         * request queue.
+         *
+         * @param pkt packet to check against
+         *
+         * @return true if we find a match
+         */
+        bool trySatisfyFunctional(PacketPtr pkt);
+
+      protected:
+
+        bool recvTimingResp(PacketPtr pkt) override;
+
+        void recvReqRetry() override;
+    };
+
+    /** Host-side port of the device. */
+    HostPort cpu_side_port;
+
+    /** Device-side port of the device. */
+    DevicePort mem_side_port;
+
+    /** Size of a header or data slot in bytes */
+    const unsigned slotSize;
+
+    /** Number of slots packed into a flit */
+    const unsigned slotsPerFlit;
+
+    /** Time to serialise a flit on one direction of the link */
+    const Tick flitTicks;
+
+    /** Latency of a message once its last flit is sent */
+    const Tick linkLatency;
+
+    /**
+     * Number of flits a message takes, one header slot and the data
+     * slots of the message packed into flits.
+     *
+     * @param pkt the message
+     * @return the number of flits
+     */
+    unsigned numFlits(PacketPtr pkt) const;
+
+    /**
+     * Send a message across one direction of the link, waiting for the
+     * link to be free and occupying it while the flits are sent.
+     *
+     * @param pkt the message to send
+     * @param link_free_at tick the direction is free from, updated
+     * @param request if the message is a request
+     * @return tick the message is delivered at the other side
+     */
+    Tick crossLink(PacketPtr pkt, Tick &link_free_at, bool request);
+
+    struct CXLMemDeviceStats : public statistics::Group
+    {
+        CXLMemDeviceStats(CXLMemDevice &device);
+
+        /** Requests and responses sent across the link */
+        statistics::Scalar reqPackets;
+        statistics::Scalar respPackets;
+
+        /** Flits sent in each direction of the link */
+        statistics::Scalar reqFlits;
+        statistics::Scalar respFlits;
+
+        /** Ticks each direction of the link is busy sending flits */
+        statistics::Scalar reqOccupancy;
+        statistics::Scalar respOccupancy;
+        statistics::Formula reqUtilization;
+        statistics::Formula respUtilization;
+
+        /** Ticks messages wait for their direction of the link */
+        statistics::Scalar totReqQueueLat;
+        statistics::Scalar totRespQueueLat;
+        statistics::Formula avgReqQueueLat;
+        statistics::Formula avgRespQueueLat;
+    } stats;
+
+  public:
+
+    Port &getPort(const std::string &if_name,
+                  PortID idx=InvalidPortID) override;
+
+    void init() override;
+
+    typedef CXLMemDeviceParams Params;
+
+    CXLMemDevice(const CXLMemDeviceParams &p);
+};
+
+} // namespace gem5
+
+#endif //__MEM_CXL_MEM_DEVICE_HH__
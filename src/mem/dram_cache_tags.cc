@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/dram_cache_tags.hh"
+
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+DRAMCacheTags::DRAMCacheTags(statistics::Group *parent, uint64_t size,
+                             unsigned line_size, unsigned _assoc,
+                             bool write_allocate, bool write_back)
+    : lineSize(line_size), assoc(_assoc),
+      numSets(assoc ? size / lineSize / assoc : 0),
+      writeAllocate(write_allocate), writeBack(write_back),
+      lines(numSets * assoc), stats(parent)
+{
+    fatal_if(numSets == 0,
+             "A dram cache needs at least one set and way.\n");
+}
+
+DRAMCacheTags::Lookup
+DRAMCacheTags::access(Addr addr, bool write)
+{
+    const uint64_t set = (addr / lineSize) % numSets;
+    Line* const set_lines = &lines[set * assoc];
+
+    // find the line, or else the least recently used way, which is
+    // an invalid one if there is any
+    unsigned way = 0;
+    Lookup lookup;
+    lookup.hit = false;
+    for (unsigned i = 0; i < assoc; i++) {
+        if (set_lines[i].addr == addr) {
+            lookup.hit = true;
+            way = i;
+            break;
+        }
+        if (set_lines[i].lastTouch < set_lines[way].lastTouch)
+            way = i;
+    }
+
+    Line& line = set_lines[way];
+    lookup.slot = (set * assoc + way) * lineSize;
+    lookup.fill = !lookup.hit && (!write || writeAllocate);
+    lookup.victim = MaxAddr;
+
+    if (lookup.fill) {
+        if (line.addr != MaxAddr && line.dirty) {
+            lookup.victim = line.addr;
+            stats.writebacks++;
+        }
+        line.addr = addr;
+        line.dirty = false;
+        stats.fills++;
+    }
+
+    if (lookup.hit || lookup.fill) {
+        line.lastTouch = ++touches;
+        if (write) {
+            if (writeBack)
+                line.dirty = true;
+            else
+                stats.writeThroughs++;
+        }
+    }
+
+    if (write && lookup.hit)
+        stats.writeHits++;
+    else if (write)
+        stats.writeMisses++;
+    else if (lookup.hit)
+        stats.readHits++;
+    else
+        stats.readMisses++;
+
+    return lookup;
+}
+
+DRAMCacheTags::DRAMCacheStats::DRAMCacheStats(statistics::Group *parent)
+    : statistics::Group(parent, "dramCache"),
+      ADD_STAT(readHits, statistics::units::Count::get(),
+               "Number of reads that hit in the dram cache"),
+      ADD_STAT(readMisses, statistics::units::Count::get(),
+               "Number of reads that missed in the dram cache"),
+      ADD_STAT(writeHits, statistics::units::Count::get(),
+               "Number of writes that hit in the dram cache"),
+      ADD_STAT(writeMisses, statistics::units::Count::get(),
+               "Number of writes that missed in the dram cache"),
+      ADD_STAT(hitRate, statistics::units::Ratio::get(),
+               "Hit rate of the dram cache"),
+      ADD_STAT(fills, statistics::units::Count::get(),
+               "Number of lines allocated in the dram cache"),
+      ADD_STAT(writebacks, statistics::units::Count::get(),
+               "Number of dirty lines written back to the nvm"),
+      ADD_STAT(writeThroughs, statistics::units::Count::get(),
+               "Number of writes written through to the nvm"),
+      ADD_STAT(tagReads, statistics::units::Count::get(),
+               "Number of dram reads only done to check a tag")
+{
+    hitRate.precision(4);
+    hitRate = (readHits + writeHits) /
+        (readHits + readMisses + writeHits + writeMisses);
+}
+
+} // namespace memory
+} // namespace gem5
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * DRAMCacheTags declaration
+ */
+
+#ifndef __MEM_DRAM_CACHE_TAGS_HH__
+#define __MEM_DRAM_CACHE_TAGS_HH__
+
+#include <cstdint>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+/**
+ * The tags of a dram cache of nvm lines, as used by the HeteroMemCtrl.
+ * An alloy cache is the direct-mapped case, with one way per set. The
+ * lines are replaced in LRU order, and the tags are updated as if each
+ * access was done as soon as it is looked up.
+ */
+class DRAMCacheTags
+{
+  public:
+    /** The outcome of an access to the cache */
+    struct Lookup
+    {
+        /** Was the line in the cache */
+        bool hit;
+
+        /** Was the line allocated by the access */
+        bool fill;
+
+        /** Offset of the slot of the line in the dram */
+        Addr slot;
+
+        /** Nvm address of a dirty line to write back, if any */
+        Addr victim;
+    };
+
+  private:
+    struct Line
+    {
+        /** Nvm address of the line, MaxAddr if invalid */
+        Addr addr = MaxAddr;
+        bool dirty = false;
+        /** Last access to the line, for LRU replacement */
+        uint64_t lastTouch = 0;
+    };
+
+    const unsigned lineSize;
+    const unsigned assoc;
+    const uint64_t numSets;
+
+    /** Allocate lines on write misses */
+    const bool writeAllocate;
+
+    /** Write dirty lines back on eviction, or write through */
+    const bool writeBack;
+
+    /** Tags of the cache, indexed by set and way */
+    std::vector<Line> lines;
+
+    /** Access counter to order the accesses to the lines */
+    uint64_t touches = 0;
+
+  public:
+    /**
+     * @param parent Stats group the stats of the cache belong to
+     * @param size Size of the dram the lines are kept in
+     * @param line_size Size of a line
+     * @param assoc Number of ways of a set, one for an alloy cache
+     * @param write_allocate Allocate lines on write misses
+     * @param write_back Keep written lines dirty rather than writing
+     *                   them through
+     */
+    DRAMCacheTags(statistics::Group *parent, uint64_t size,
+                  unsigned line_size, unsigned assoc, bool write_allocate,
+                  bool write_back);
+
+    /**
+     * Look up a line and update the tags as if the access was done,
+     * allocating the line on a miss if the fill policy allows.
+     *
+     * @param addr Nvm address of the line
+     * @param write Is the access a write
+     * @return What the access found, and where the line is kept
+     */
+    Lookup access(Addr addr, bool write);
+
+    struct DRAMCacheStats : public statistics::Group
+    {
+        DRAMCacheStats(statistics::Group *parent);
+
+        statistics::Scalar readHits;
+        statistics::Scalar readMisses;
+        statistics::Scalar writeHits;
+        statistics::Scalar writeMisses;
+        statistics::Formula hitRate;
+
+        /** Lines allocated in the cache */
+        statistics::Scalar fills;
+
+        /** Dirty lines written back to the nvm on eviction */
+        statistics::Scalar writebacks;
+
+        /** Host writes written through to the nvm */
+        statistics::Scalar writeThroughs;
+
+        /** Dram reads of a line only done to check its tag */
+        statistics::Scalar tagReads;
+    } stats;
+};
+
+} // namespace memory
+} // namespace gem5
+
+#endif // __MEM_DRAM_CACHE_TAGS_HH__
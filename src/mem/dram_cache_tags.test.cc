@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <list>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "base/stats/group.hh"
+#include "mem/dram_cache_tags.hh"
+
+// The version tags are declared as extern
+namespace gem5
+{
+std::set<std::string> version_tags;
+} // namespace gem5
+
+using namespace gem5;
+using namespace gem5::memory;
+
+namespace
+{
+
+const unsigned lineSize = 64;
+const unsigned numLines = 32;
+
+/**
+ * The organisations under test: an alloy cache, which is direct mapped,
+ * and set-associative caches.
+ */
+class DRAMCacheTagsTest : public testing::TestWithParam<unsigned>
+{
+  protected:
+    statistics::Group root{nullptr};
+
+    unsigned assoc() const { return GetParam(); }
+    unsigned numSets() const { return numLines / assoc(); }
+
+    /** Address of the n-th line that maps to the given set */
+    Addr
+    lineInSet(unsigned set, unsigned n) const
+    {
+        return (n * numSets() + set) * lineSize;
+    }
+};
+
+TEST_P(DRAMCacheTagsTest, ReadMissFillsThenHits)
+{
+    DRAMCacheTags tags(&root, numLines * lineSize, lineSize, assoc(),
+                       true, true);
+
+    auto lookup = tags.access(lineInSet(3, 0), false);
+    EXPECT_FALSE(lookup.hit);
+    EXPECT_TRUE(lookup.fill);
+    EXPECT_EQ(lookup.victim, MaxAddr);
+    EXPECT_EQ(lookup.slot / lineSize / assoc(), 3);
+
+    const Addr slot = lookup.slot;
+    lookup = tags.access(lineInSet(3, 0), false);
+    EXPECT_TRUE(lookup.hit);
+    EXPECT_FALSE(lookup.fill);
+    EXPECT_EQ(lookup.slot, slot);
+
+    EXPECT_EQ(tags.stats.readMisses.value(), 1);
+    EXPECT_EQ(tags.stats.readHits.value(), 1);
+    EXPECT_EQ(tags.stats.fills.value(), 1);
+    EXPECT_EQ(tags.stats.writebacks.value(), 0);
+}
+
+/** A set holds as many lines as it has ways, and evicts in LRU order */
+TEST_P(DRAMCacheTagsTest, EvictsLeastRecentlyUsed)
+{
+    DRAMCacheTags tags(&root, numLines * lineSize, lineSize, assoc(),
+                       true, true);
+
+    for (unsigned n = 0; n < assoc(); n++)
+        EXPECT_FALSE(tags.access(lineInSet(1, n), false).hit);
+    for (unsigned n = 0; n < assoc(); n++)
+        EXPECT_TRUE(tags.access(lineInSet(1, n), false).hit);
+
+    // touch the first line again, so the second is the oldest
+    tags.access(lineInSet(1, 0), false);
+    EXPECT_FALSE(tags.access(lineInSet(1, assoc()), false).hit);
+    EXPECT_EQ(tags.stats.fills.value(), assoc() + 1);
+
+    // a direct-mapped set only has room for the new line
+    if (assoc() > 1)
+        EXPECT_TRUE(tags.access(lineInSet(1, 0), false).hit);
+    const Addr evicted = lineInSet(1, assoc() == 1 ? 0 : 1);
+    EXPECT_FALSE(tags.access(evicted, false).hit);
+}
+
+TEST_P(DRAMCacheTagsTest, WriteBackDirtyVictim)
+{
+    DRAMCacheTags tags(&root, numLines * lineSize, lineSize, assoc(),
+                       true, true);
+
+    // a write miss allocates the line and leaves it dirty
+    auto lookup = tags.access(lineInSet(2, 0), true);
+    EXPECT_FALSE(lookup.hit);
+    EXPECT_TRUE(lookup.fill);
+    EXPECT_TRUE(tags.access(lineInSet(2, 0), true).hit);
+
+    // the dirty line is the oldest, so it goes first, and then a
+    // clean line is dropped without a writeback
+    for (unsigned n = 1; n < assoc(); n++)
+        tags.access(lineInSet(2, n), false);
+    lookup = tags.access(lineInSet(2, assoc()), false);
+    EXPECT_TRUE(lookup.fill);
+    EXPECT_EQ(lookup.victim, lineInSet(2, 0));
+    lookup = tags.access(lineInSet(2, assoc() + 1), false);
+    EXPECT_TRUE(lookup.fill);
+    EXPECT_EQ(lookup.victim, MaxAddr);
+
+    EXPECT_EQ(tags.stats.writeMisses.value(), 1);
+    EXPECT_EQ(tags.stats.writeHits.value(), 1);
+    EXPECT_EQ(tags.stats.writebacks.value(), 1);
+    EXPECT_EQ(tags.stats.writeThroughs.value(), 0);
+    EXPECT_EQ(tags.stats.fills.value(), assoc() + 2);
+}
+
+TEST_P(DRAMCacheTagsTest, WriteThroughNoAllocate)
+{
+    DRAMCacheTags tags(&root, numLines * lineSize, lineSize, assoc(),
+                       false, false);
+
+    // a write miss does not allocate the line
+    auto lookup = tags.access(lineInSet(0, 0), true);
+    EXPECT_FALSE(lookup.hit);
+    EXPECT_FALSE(lookup.fill);
+    EXPECT_FALSE(tags.access(lineInSet(0, 0), false).hit);
+
+    // a write hit is written through, and leaves the line clean
+    EXPECT_TRUE(tags.access(lineInSet(0, 0), true).hit);
+    for (unsigned n = 1; n <= assoc(); n++) {
+        lookup = tags.access(lineInSet(0, n), false);
+        EXPECT_EQ(lookup.victim, MaxAddr);
+    }
+
+    EXPECT_EQ(tags.stats.writeMisses.value(), 1);
+    EXPECT_EQ(tags.stats.writeHits.value(), 1);
+    EXPECT_EQ(tags.stats.writeThroughs.value(), 1);
+    EXPECT_EQ(tags.stats.writebacks.value(), 0);
+    EXPECT_EQ(tags.stats.fills.value(), assoc() + 1);
+}
+
+/**
+ * Check the accounting over a random mix of reads and writes against a
+ * plain LRU list per set.
+ */
+TEST_P(DRAMCacheTagsTest, MatchesLRUModel)
+{
+    struct ModelLine
+    {
+        Addr addr;
+        bool dirty;
+    };
+
+    DRAMCacheTags tags(&root, numLines * lineSize, lineSize, assoc(),
+                       true, true);
+    std::vector<std::list<ModelLine>> sets(numSets());
+    std::mt19937 rng(7);
+    unsigned hits = 0, misses = 0, writebacks = 0;
+
+    for (unsigned i = 0; i < 20000; i++) {
+        const Addr addr = (rng() % (numLines * 3)) * lineSize;
+        const bool write = rng() % 3 == 0;
+        auto &set = sets[addr / lineSize % numSets()];
+
+        auto it = set.begin();
+        while (it != set.end() && it->addr != addr)
+            ++it;
+        const bool hit = it != set.end();
+        Addr victim = MaxAddr;
+        ModelLine line{addr, false};
+        if (hit) {
+            line = *it;
+            set.erase(it);
+        } else if (set.size() == assoc()) {
+            if (set.back().dirty)
+                victim = set.back().addr;
+            set.pop_back();
+        }
+        line.dirty = line.dirty || write;
+        set.push_front(line);
+
+        const auto lookup = tags.access(addr, write);
+        ASSERT_EQ(lookup.hit, hit) << "access " << i;
+        ASSERT_EQ(lookup.victim, victim) << "access " << i;
+        hits += hit;
+        misses += !hit;
+        writebacks += victim != MaxAddr;
+    }
+
+    EXPECT_EQ(tags.stats.readHits.value() + tags.stats.writeHits.value(),
+              hits);
+    EXPECT_EQ(tags.stats.readMisses.value() +
+              tags.stats.writeMisses.value(), misses);
+    EXPECT_EQ(tags.stats.fills.value(), misses);
+    EXPECT_EQ(tags.stats.writebacks.value(), writebacks);
+    EXPECT_GT(writebacks, 1000);
+}
+
+INSTANTIATE_TEST_SUITE_P(Organisations, DRAMCacheTagsTest,
+                         testing::Values(1, 4),
+                         [](const testing::TestParamInfo<unsigned> &info) {
+                             return info.param == 1 ? "Alloy" :
+                                                      "SetAssociative";
+                         });
+
+} // anonymous namespace
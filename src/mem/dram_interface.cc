@@ -40,7 +40,6 @@
 
 #include "mem/dram_interface.hh"
 
-#include "base/bitfield.hh"
 #include "base/cprintf.hh"
 #include "base/trace.hh"
 #include "debug/DRAM.hh"
@@ -59,116 +58,52 @@ namespace memory
 std::pair<MemPacketQueue::iterator, Tick>
 DRAMInterface::chooseNextFRFCFS(MemPacketQueue& queue, Tick min_col_at) const
 {
-    std::vector<uint32_t> earliest_banks(ranksPerChannel, 0);
+    // The queue indexes its DRAM packets per bank and row, so rather than
+    // walking every packet we only look at the oldest row hit and the
+    // oldest row miss of each bank. The choice is the same as that of a
+    // first-come first-served walk of the queue: search for seamless row
+    // hits first, if no seamless row hit is found then determine if
+    // there are other packets that can be issued without incurring
+    // additional bus delay due to bank timing, and otherwise take the
+    // oldest row hit or, failing that, go for the earliest possible
+    // bank. Will select closed rows first to enable more open row
+    // possibilies in future selections
+    std::vector<MemPacketQueue::BankState> bank_states;
+    bank_states.reserve(banksPerRank * ranksPerChannel);
 
-    // Has minBankPrep been called to populate earliest_banks?
-    bool filled_earliest_banks = false;
-    // can the PRE/ACT sequence be done without impacting utlization?
-    bool hidden_bank_prep = false;
-
-    // search for seamless row hits first, if no seamless row hit is
-    // found then determine if there are other packets that can be issued
-    // without incurring additional bus delay due to bank timing
-    // Will select closed rows first to enable more open row possibilies
-    // in future selections
-    bool found_hidden_bank = false;
-
-    // remember if we found a row hit, not seamless, but bank prepped
-    // and ready
-    bool found_prepped_pkt = false;
-
-    // if we have no row hit, prepped or not, and no seamless packet,
-    // just go for the earliest possible
-    bool found_earliest_pkt = false;
-
-    Tick selected_col_at = MaxTick;
-    auto selected_pkt_it = queue.end();
-
-    for (auto i = queue.begin(); i != queue.end() ; ++i) {
-        MemPacket* pkt = *i;
-
-        // select optimal DRAM packet in Q
-        if (pkt->isDram() && (pkt->pseudoChannel == pseudoChannel)) {
-            const Bank& bank = ranks[pkt->rank]->banks[pkt->bank];
-            const Tick col_allowed_at = pkt->isRead() ? bank.rdAllowedAt :
-                                                        bank.wrAllowedAt;
-
-            DPRINTF(DRAM, "%s checking DRAM packet in bank %d, row %d\n",
-                    __func__, pkt->bank, pkt->row);
-
-            // check if rank is not doing a refresh and thus is available,
-            // if not, jump to the next packet
-            if (burstReady(pkt)) {
-
-                DPRINTF(DRAM,
-                        "%s bank %d - Rank %d available\n", __func__,
-                        pkt->bank, pkt->rank);
-
-                // check if it is a row hit
-                if (bank.openRow == pkt->row) {
-                    // no additional rank-to-rank or same bank-group
-                    // delays, or we switched read/write and might as well
-                    // go for the row hit
-                    if (col_allowed_at <= min_col_at) {
-                        // FCFS within the hits, giving priority to
-                        // commands that can issue seamlessly, without
-                        // additional delay, such as same rank accesses
-                        // and/or different bank-group accesses
-                        DPRINTF(DRAM, "%s Seamless buffer hit\n", __func__);
-                        selected_pkt_it = i;
-                        selected_col_at = col_allowed_at;
-                        // no need to look through the remaining queue entries
-                        break;
-                    } else if (!found_hidden_bank && !found_prepped_pkt) {
-                        // if we did not find a packet to a closed row that can
-                        // issue the bank commands without incurring delay, and
-                        // did not yet find a packet to a prepped row, remember
-                        // the current one
-                        selected_pkt_it = i;
-                        selected_col_at = col_allowed_at;
-                        found_prepped_pkt = true;
-                        DPRINTF(DRAM, "%s Prepped row buffer hit\n", __func__);
-                    }
-                } else if (!found_earliest_pkt) {
-                    // if we have not initialised the bank status, do it
-                    // now, and only once per scheduling decisions
-                    if (!filled_earliest_banks) {
-                        // determine entries with earliest bank delay
-                        std::tie(earliest_banks, hidden_bank_prep) =
-                            minBankPrep(queue, min_col_at);
-                        filled_earliest_banks = true;
-                    }
-
-                    // bank is amongst first available banks
-                    // minBankPrep will give priority to packets that can
-                    // issue seamlessly
-                    if (bits(earliest_banks[pkt->rank],
-                             pkt->bank, pkt->bank)) {
-                        found_earliest_pkt = true;
-                        found_hidden_bank = hidden_bank_prep;
-
-                        // give priority to packets that can issue
-                        // bank commands 'behind the scenes'
-                        // any additional delay if any will be due to
-                        // col-to-col command requirements
-                        if (hidden_bank_prep || !found_prepped_pkt) {
-                            selected_pkt_it = i;
-                            selected_col_at = col_allowed_at;
-                        }
-                    }
-                }
-            } else {
-                DPRINTF(DRAM, "%s bank %d - Rank %d not available\n", __func__,
-                        pkt->bank, pkt->rank);
-            }
+    for (int i = 0; i < ranksPerChannel; i++) {
+        // check if rank is not doing a refresh and thus is available,
+        // if not, skip its banks
+        const bool available = ranks[i]->inRefIdleState();
+        if (!available)
+            DPRINTF(DRAM, "%s Rank %d not available\n", __func__, i);
+
+        for (const Bank& bank : ranks[i]->banks) {
+            bank_states.push_back({available, bank.openRow,
+                                   bank.rdAllowedAt, bank.wrAllowedAt});
         }
     }
 
-    if (selected_pkt_it == queue.end()) {
+    // determine banks with earliest bank delay only if needed,
+    // minBankPrep will give priority to packets that can issue
+    // seamlessly
+    const MemPacketQueue::Entry *selected = queue.chooseNextFRFCFS(
+        pseudoChannel, bank_states, banksPerRank, min_col_at,
+        [&] { return minBankPrep(queue, min_col_at); });
+
+    if (!selected) {
         DPRINTF(DRAM, "%s no available DRAM ranks found\n", __func__);
+        return std::make_pair(queue.end(), MaxTick);
     }
 
-    return std::make_pair(selected_pkt_it, selected_col_at);
+    const MemPacket* pkt = *selected->pkt;
+    const Bank& bank = ranks[pkt->rank]->banks[pkt->bank];
+    DPRINTF(DRAM, "%s selected DRAM packet in bank %d, row %d\n",
+            __func__, pkt->bank, pkt->row);
+
+    return std::make_pair(selected->pkt,
+                          pkt->isRead() ? bank.rdAllowedAt :
+                                          bank.wrAllowedAt);
 }
 
 void
@@ -657,6 +592,7 @@ DRAMInterface::DRAMInterface(const DRAMInterfaceParams &_p)
       maxAccessesPerRow(_p.max_accesses_per_row),
       timeStampOffset(0), activeRank(0),
       enableDRAMPowerdown(_p.enable_dram_powerdown),
+      lazyIdleRefresh(_p.lazy_idle_refresh),
       lastStatsResetTick(0),
       stats(*this)
 {
@@ -798,6 +734,8 @@ DRAMInterface::isBusy(bool read_queue_empty, bool all_writes_nvm)
 {
     int busy_ranks = 0;
     for (auto r : ranks) {
+        r->catchUpRefresh();
+
         if (!r->inRefIdleState()) {
             if (r->pwrState != PWR_SREF) {
                 // rank is busy refreshing
@@ -919,6 +857,9 @@ DRAMInterface::decodePacket(const PacketPtr pkt, Addr pkt_addr,
 
 void DRAMInterface::setupRank(const uint8_t rank, const bool is_read)
 {
+    // bring the rank up to date before it has work queued
+    ranks[rank]->catchUpRefresh();
+
     // increment entry count of the rank based on packet type
     if (is_read) {
         ++ranks[rank]->readEntries;
@@ -1038,27 +979,19 @@ DRAMInterface::minBankPrep(const MemPacketQueue& queue,
     // delay on the data bus
     bool hidden_bank_prep = false;
 
-    // determine if we have queued transactions targetting the
-    // bank in question
-    std::vector<bool> got_waiting(ranksPerChannel * banksPerRank, false);
-    for (const auto& p : queue) {
-        if (p->pseudoChannel != pseudoChannel)
-            continue;
-        if (p->isDram() && ranks[p->rank]->inRefIdleState())
-            got_waiting[p->bankId] = true;
-    }
-
     // Find command with optimal bank timing
     // Will prioritize commands that can issue seamlessly.
     for (int i = 0; i < ranksPerChannel; i++) {
+        // skip ranks that are currently refreshing
+        if (!ranks[i]->inRefIdleState())
+            continue;
+
         for (int j = 0; j < banksPerRank; j++) {
             uint16_t bank_id = i * banksPerRank + j;
 
             // if we have waiting requests for the bank, and it is
             // amongst the first available, update the mask
-            if (got_waiting[bank_id]) {
-                // make sure this rank is not currently refreshing.
-                assert(ranks[i]->inRefIdleState());
+            if (queue.bankQueue(pseudoChannel, bank_id)) {
                 // simplistic approximation of when the bank can issue
                 // an activate, ignoring any rank-to-rank switching
                 // cost in this calculation
@@ -1119,7 +1052,8 @@ DRAMInterface::Rank::Rank(const DRAMInterfaceParams &_p,
                          int _rank, DRAMInterface& _dram)
     : EventManager(&_dram), dram(_dram),
       pwrStateTrans(PWR_IDLE), pwrStatePostRefresh(PWR_IDLE),
-      pwrStateTick(0), refreshDueAt(0), pwrState(PWR_IDLE),
+      pwrStateTick(0), refreshDueAt(0), lazyRefreshAt(MaxTick),
+      pwrState(PWR_IDLE),
       refreshState(REF_IDLE), inLowPowerState(false), rank(_rank),
       readEntries(0), writeEntries(0), outstandingEvents(0),
       wakeUpAllowedAt(0), power(_p, false), banks(_p.banks_per_rank),
@@ -1168,6 +1102,8 @@ DRAMInterface::Rank::startup(Tick ref_tick)
 void
 DRAMInterface::Rank::suspend()
 {
+    catchUpRefresh();
+
     deschedule(refreshEvent);
 
     // Update the stats
@@ -1283,9 +1219,90 @@ DRAMInterface::Rank::processWriteDoneEvent()
     --outstandingEvents;
 }
 
+bool
+DRAMInterface::Rank::canRefreshLazily() const
+{
+    // the rank must be idle with nothing queued or in flight, and
+    // nothing that could make the refresh wait or be bypassed
+    return dram.lazyIdleRefresh && !dram.enableDRAMPowerdown &&
+        (pwrState == PWR_IDLE) && !inLowPowerState &&
+        (outstandingEvents == 0) && (numBanksActive == 0) &&
+        (readEntries == 0) && (writeEntries == 0) &&
+        !writeDoneEvent.scheduled() && !activateEvent.scheduled() &&
+        !prechargeEvent.scheduled() && !powerEvent.scheduled() &&
+        !wakeUpEvent.scheduled() &&
+        !((rank == dram.activeRank) &&
+          dram.ctrl->requestEventScheduled(dram.pseudoChannel)) &&
+        (dram.ctrl->drainState() == DrainState::Running);
+}
+
+void
+DRAMInterface::Rank::catchUpRefresh()
+{
+    if (lazyRefreshAt == MaxTick)
+        return;
+
+    // an idle rank refreshes every tREFI - tRP, as the refresh is
+    // started as soon as it is due and the next one is scheduled
+    // tRP early to leave time for precharging
+    const Tick period = dram.tREFI - dram.tRP;
+    unsigned int refreshes = 0;
+
+    while (lazyRefreshAt < curTick()) {
+        const Tick ref_done_at = lazyRefreshAt + dram.tRFC;
+
+        stats.pwrStateTime[PWR_IDLE] += lazyRefreshAt - pwrStateTick;
+
+        for (auto &b : banks) {
+            b.actAllowedAt = ref_done_at;
+        }
+
+        cmdList.push_back(Command(MemCommand::REF, 0, lazyRefreshAt));
+        refreshDueAt = lazyRefreshAt + dram.tREFI;
+        ++refreshes;
+
+        // if the refresh is still running, the event loop finishes it
+        if (ref_done_at > curTick())
+            break;
+
+        stats.pwrStateTime[PWR_REF] += dram.tRFC;
+        pwrStateTick = ref_done_at;
+        lazyRefreshAt += period;
+    }
+
+    if (lazyRefreshAt < curTick()) {
+        pwrState = PWR_REF;
+        pwrStateTick = lazyRefreshAt;
+        refreshState = REF_RUN;
+        ++outstandingEvents;
+        schedule(refreshEvent, lazyRefreshAt + dram.tRFC);
+    } else {
+        schedule(refreshEvent, lazyRefreshAt);
+    }
+
+    DPRINTF(DRAM, "Caught up with %d lazy refreshes, next event at %llu\n",
+            refreshes, refreshEvent.when());
+
+    lazyRefreshAt = MaxTick;
+
+    // the commands are all in the past, so hand them to DRAMPower
+    // just like the refresh itself would have done
+    if (refreshes != 0)
+        flushCmdList();
+}
+
 void
 DRAMInterface::Rank::processRefreshEvent()
 {
+    // an idle rank is refreshed without going through the state
+    // machine, and the refreshes are accounted for once it is used
+    if ((refreshState == REF_IDLE) && canRefreshLazily()) {
+        lazyRefreshAt = curTick();
+
+        DPRINTF(DRAM, "Refresh due, refreshing lazily\n");
+        return;
+    }
+
     // when first preparing the refresh, remember when it was due
     if ((refreshState == REF_IDLE) || (refreshState == REF_SREF_EXIT)) {
         // remember when the refresh is due
@@ -1811,6 +1828,8 @@ DRAMInterface::Rank::computeStats()
 {
     DPRINTF(DRAM,"Computing stats due to a dump callback\n");
 
+    catchUpRefresh();
+
     // Update the stats
     updatePowerStats();
 
@@ -2016,6 +2035,9 @@ DRAMInterface::RankStats::regStats()
 void
 DRAMInterface::RankStats::resetStats()
 {
+    // account for the lazy refreshes before the stats are cleared
+    rank.catchUpRefresh();
+
     statistics::Group::resetStats();
 
     rank.resetStats();
@@ -256,6 +256,19 @@ class DRAMInterface : public MemInterface
          */
         Tick refreshDueAt;
 
+        /**
+         * Start of the next refresh of a rank that is idle and
+         * refreshed lazily, without any events, or MaxTick when the
+         * refresh state machine is driven by events.
+         */
+        Tick lazyRefreshAt;
+
+        /**
+         * Check if the rank is quiescent enough for its refreshes to
+         * be computed when it is next used rather than with events.
+         */
+        bool canRefreshLazily() const;
+
         /**
          * Function to update Power Stats
          */
@@ -369,6 +382,14 @@ class DRAMInterface : public MemInterface
          */
         void suspend();
 
+        /**
+         * Account for all the refreshes a lazily refreshed rank
+         * performed up to curTick(), and hand control back to the
+         * refresh event loop. Must be called before the rank state is
+         * inspected or changed.
+         */
+        void catchUpRefresh();
+
         /**
          * Check if there is no refresh and no preparation of refresh ongoing
          * i.e. the refresh state machine is in idle
@@ -548,6 +569,9 @@ class DRAMInterface : public MemInterface
     /** Enable or disable DRAM powerdown states. */
     bool enableDRAMPowerdown;
 
+    /** Refresh idle ranks lazily rather than with events. */
+    const bool lazyIdleRefresh;
+
     /** The time when stats were last reset used to calculate average power */
     Tick lastStatsResetTick;
 
@@ -47,10 +47,10 @@ HBMCtrl::HBMCtrl(const HBMCtrlParams &p) :
     MemCtrl(p),
     retryRdReqPC1(false), retryWrReqPC1(false),
     nextReqEventPC1([this] {processNextReqEvent(pc1Int, respQueuePC1,
-                         respondEventPC1, nextReqEventPC1, retryWrReqPC1);},
-                         name()),
+                         retryWrReqPC1);}, name()),
     respondEventPC1([this] {processRespondEvent(pc1Int, respQueuePC1,
-                         respondEventPC1, retryRdReqPC1); }, name()),
+                         retryRdReqPC1); }, name()),
+    respQueuePC1(false),
     pc1Int(p.dram_2)
 {
     DPRINTF(MemCtrl, "Setting up HBM controller\n");
@@ -170,7 +170,7 @@ class HBMCtrl : public MemCtrl
      * Response queue for pkts sent to second pseudo channel
      * The first pseudo channel uses MemCtrl::respQueue
      */
-    std::deque<MemPacket*> respQueuePC1;
+    MemPacketQueue respQueuePC1;
 
     /**
      * Holds count of row commands issued in burst window starting at
@@ -217,6 +217,22 @@ class HBMCtrl : public MemCtrl
         }
     }
 
+    /**
+     * Schedule the respondEvent of a pseudo channel
+     *
+     * @param Tick to schedule the event at
+     * @param pseudo_channel pseudo channel number the response is for
+     */
+    void scheduleRespondEvent(Tick tick, uint8_t pseudo_channel) override
+    {
+        if (pseudo_channel == 0) {
+            MemCtrl::scheduleRespondEvent(tick, pseudo_channel);
+        } else {
+            assert(pseudo_channel == 1);
+            schedule(respondEventPC1, tick);
+        }
+    }
+
     /**
      * Is there a read/write burst Event scheduled?
      *
@@ -59,7 +59,11 @@ namespace memory
 
 HeteroMemCtrl::HeteroMemCtrl(const HeteroMemCtrlParams &p) :
     MemCtrl(p),
-    nvm(p.nvm)
+    nvm(p.nvm),
+    dramCacheOrg(p.dram_cache_org), lineSize(0),
+    tagLatency(p.dram_cache_org == enums::set_assoc ?
+               p.dram_cache_tag_latency : 0),
+    writeBack(p.dram_cache_write_back)
 {
     DPRINTF(MemCtrl, "Setting up controller\n");
     readQueue.resize(p.qos_priorities);
@@ -70,6 +74,13 @@ HeteroMemCtrl::HeteroMemCtrl(const HeteroMemCtrlParams &p) :
     fatal_if(dynamic_cast<NVMInterface*>(nvm) == nullptr,
             "HeteroMemCtrl's nvm interface must be of type NVMInterface.\n");
 
+    // requests are routed by range, and a dram cache keeps its lines
+    // in the dram range, so the two ranges must be disjoint
+    fatal_if(dram->getAddrRange().intersects(nvm->getAddrRange()),
+             "HeteroMemCtrl's dram range %s overlaps its nvm range %s.\n",
+             dram->getAddrRange().to_string(),
+             nvm->getAddrRange().to_string());
+
     // hook up interfaces to the controller
     dram->setCtrl(this, commandWindow);
     nvm->setCtrl(this, commandWindow);
@@ -85,6 +96,30 @@ HeteroMemCtrl::HeteroMemCtrl(const HeteroMemCtrlParams &p) :
         fatal("Write buffer low threshold %d must be smaller than the "
               "high threshold %d\n", p.write_low_thresh_perc,
               p.write_high_thresh_perc);
+
+    if (dramCache()) {
+        lineSize = dram->bytesPerBurst();
+        fatal_if(nvm->bytesPerBurst() != lineSize,
+                 "HeteroMemCtrl's dram cache needs dram and nvm bursts of "
+                 "the same size.\n");
+        // a host access is a single line, as the bursts an access to
+        // the cache needs are all line sized
+        fatal_if(system()->cacheLineSize() > lineSize,
+                 "HeteroMemCtrl's dram cache needs cache lines of at most "
+                 "the %d byte burst size, got %d bytes.\n", lineSize,
+                 system()->cacheLineSize());
+        fatal_if(dram->isInAddrMap(),
+                 "HeteroMemCtrl's dram must not be in the address map when "
+                 "it caches the nvm.\n");
+        fatal_if(dram->getAddrRange().interleaved(),
+                 "HeteroMemCtrl's dram cache needs a contiguous dram "
+                 "range.\n");
+
+        dramCacheTags = std::make_unique<DRAMCacheTags>(
+            this, dram->getAddrRange().size(), lineSize,
+            dramCacheOrg == enums::alloy ? 1 : p.dram_cache_assoc,
+            p.dram_cache_write_allocate, writeBack);
+    }
 }
 
 Tick
@@ -92,7 +127,27 @@ HeteroMemCtrl::recvAtomic(PacketPtr pkt)
 {
     Tick latency = 0;
 
-    if (dram->getAddrRange().contains(pkt->getAddr())) {
+    if (dramCache()) {
+        panic_if(!nvm->getAddrRange().contains(pkt->getAddr()),
+                 "Can't handle address range for packet %s\n",
+                 pkt->print());
+
+        DRAMCacheAccess acc;
+        acc.addr = pkt->getAddr() & ~Addr(lineSize - 1);
+        acc.write = pkt->isWrite();
+        if (pkt->isRead() || pkt->isWrite())
+            lookupDRAMCache(acc);
+
+        latency = MemCtrl::recvAtomicLogic(pkt, nvm);
+        if (latency != 0) {
+            // an alloy cache reads the line to check the tag, and a
+            // miss then goes to the nvm
+            latency = tagLatency +
+                (dramCacheOrg == enums::alloy || acc.hit ?
+                 dram->accessLatency() : 0) +
+                (acc.hit ? 0 : nvm->accessLatency());
+        }
+    } else if (dram->getAddrRange().contains(pkt->getAddr())) {
         latency = MemCtrl::recvAtomicLogic(pkt, dram);
     } else if (nvm->getAddrRange().contains(pkt->getAddr())) {
         latency = MemCtrl::recvAtomicLogic(pkt, nvm);
@@ -122,6 +177,43 @@ HeteroMemCtrl::recvTimingReq(PacketPtr pkt)
     }
     prevArrival = curTick();
 
+    if (dramCache()) {
+        panic_if(!nvm->getAddrRange().contains(pkt->getAddr()),
+                 "Can't handle address range for packet %s\n",
+                 pkt->print());
+        panic_if((pkt->getAddr() & (lineSize - 1)) + pkt->getSize() >
+                 lineSize, "DRAM cache accesses must not cross a line, "
+                 "got %s\n", pkt->print());
+
+        qosSchedule( { &readQueue, &writeQueue }, lineSize, pkt);
+
+        // the bursts an access needs beyond its own are queued as the
+        // access proceeds, and may take the queues past their size
+        // for a while, which then holds off further requests
+        if (pkt->isWrite()) {
+            if (writeQueueFull(1)) {
+                DPRINTF(MemCtrl, "Write queue full, not accepting\n");
+                retryWrReq = true;
+                stats.numWrRetry++;
+                return false;
+            }
+            stats.writeReqs++;
+            stats.bytesWrittenSys += pkt->getSize();
+        } else {
+            if (readQueueFull(1)) {
+                DPRINTF(MemCtrl, "Read queue full, not accepting\n");
+                retryRdReq = true;
+                stats.numRdRetry++;
+                return false;
+            }
+            stats.readReqs++;
+            stats.bytesReadSys += pkt->getSize();
+        }
+
+        accessDRAMCache(pkt);
+        return true;
+    }
+
     // What type of media does this packet access?
     bool is_dram;
     if (dram->getAddrRange().contains(pkt->getAddr())) {
@@ -192,19 +284,202 @@ HeteroMemCtrl::recvTimingReq(PacketPtr pkt)
     return true;
 }
 
+void
+HeteroMemCtrl::lookupDRAMCache(DRAMCacheAccess& acc)
+{
+    const DRAMCacheTags::Lookup lookup =
+        dramCacheTags->access(acc.addr, acc.write);
+    acc.hit = lookup.hit;
+    acc.fill = lookup.fill;
+    acc.slot = dram->getAddrRange().start() + lookup.slot;
+    acc.victim = lookup.victim;
+
+    DPRINTF(MemCtrl, "DRAM cache %s %#x %s, slot %#x%s\n",
+            acc.write ? "write" : "read", acc.addr,
+            acc.hit ? "hit" : "miss", acc.slot,
+            acc.victim != MaxAddr ? ", dirty victim" : "");
+}
+
+void
+HeteroMemCtrl::accessDRAMCache(PacketPtr pkt)
+{
+    DRAMCacheAccess* acc = new DRAMCacheAccess;
+    acc->addr = pkt->getAddr() & ~Addr(lineSize - 1);
+    acc->write = pkt->isWrite();
+    lookupDRAMCache(*acc);
+
+    // the bursts of the access are decoded with a packet of its own,
+    // as the host packet of a write is gone once it is responded to
+    RequestPtr req = std::make_shared<Request>(acc->addr, lineSize, 0,
+                                               pkt->requestorId());
+    acc->pkt = new Packet(req, MemCmd::ReadReq);
+    acc->pkt->qosValue(pkt->qosValue());
+    acc->hostRead = acc->write ? nullptr : pkt;
+
+    if (dramCacheOrg == enums::alloy) {
+        if (!acc->write && acc->hit) {
+            // the data comes with the tag
+            queueBurst(pkt, acc->slot, true, dram);
+        } else {
+            // read the line to check its tag, which also gets the data
+            // of a dirty victim
+            dramCacheTags->stats.tagReads++;
+            queueBurst(acc->pkt, acc->slot, true, dram);
+            waitForRead(acc, acc->pkt);
+        }
+    } else {
+        if (!acc->write) {
+            if (acc->hit) {
+                queueBurst(pkt, acc->slot, true, dram);
+            } else {
+                queueBurst(pkt, acc->addr, true, nvm);
+                waitForRead(acc, pkt);
+            }
+        }
+
+        if (acc->victim != MaxAddr) {
+            // read the dirty victim out before it is replaced
+            queueBurst(acc->pkt, acc->slot, true, dram);
+            waitForRead(acc, acc->pkt);
+        } else if (acc->write) {
+            dramCacheWrite(*acc);
+        }
+    }
+
+    if (acc->write) {
+        // as for uncached media, writes are responded to once queued
+        MemCtrl::accessAndRespond(pkt, frontendLatency, nvm);
+    }
+
+    if (acc->readsPending == 0) {
+        delete acc->pkt;
+        delete acc;
+    }
+}
+
+void
+HeteroMemCtrl::dramCacheReadDone(DRAMCacheAccess* acc, PacketPtr pkt,
+                                 Tick static_latency)
+{
+    if (pkt == acc->hostRead) {
+        // the data of a read miss arrived from the nvm
+        MemCtrl::accessAndRespond(pkt, static_latency + tagLatency, nvm);
+    } else {
+        // the line in the cache was read, with its tag for an alloy
+        // cache
+        if (acc->victim != MaxAddr)
+            queueBurst(acc->pkt, acc->victim, false, nvm);
+
+        if (acc->write) {
+            dramCacheWrite(*acc);
+        } else if (dramCacheOrg == enums::alloy) {
+            // the tag did not match, so get the line from the nvm
+            queueBurst(acc->hostRead, acc->addr, true, nvm);
+            waitForRead(acc, acc->hostRead);
+        }
+    }
+
+    assert(acc->readsPending != 0);
+    if (--acc->readsPending == 0) {
+        // fill the line once its data arrived and the victim is out
+        if (acc->fill && !acc->write)
+            queueBurst(acc->pkt, acc->slot, false, dram);
+
+        delete acc->pkt;
+        delete acc;
+    }
+}
+
+void
+HeteroMemCtrl::dramCacheWrite(const DRAMCacheAccess& acc)
+{
+    if (acc.hit || acc.fill) {
+        queueBurst(acc.pkt, acc.slot, false, dram);
+        if (!writeBack)
+            queueBurst(acc.pkt, acc.addr, false, nvm);
+    } else {
+        // write around the cache
+        queueBurst(acc.pkt, acc.addr, false, nvm);
+    }
+}
+
+void
+HeteroMemCtrl::queueBurst(PacketPtr pkt, Addr addr, bool is_read,
+                          MemInterface* mem_intr)
+{
+    if (!is_read &&
+        isInWriteQueue.find(burstAlign(addr, mem_intr)) !=
+        isInWriteQueue.end()) {
+        DPRINTF(MemCtrl, "Merging write burst with existing queue entry\n");
+        stats.mergedWrBursts++;
+        return;
+    }
+
+    MemPacket* mem_pkt = mem_intr->decodePacket(pkt, addr, lineSize, is_read,
+                                                mem_intr->pseudoChannel);
+    mem_intr->setupRank(mem_pkt->rank, is_read);
+    mem_pkt->readyTime = MaxTick;
+
+    // the scheduler runs on the dram interface, which thus counts the
+    // queued bursts to both media
+    if (is_read) {
+        stats.readBursts++;
+        readQueue[mem_pkt->qosValue()].push_back(mem_pkt);
+        dram->readQueueSize++;
+    } else {
+        stats.writeBursts++;
+        writeQueue[mem_pkt->qosValue()].push_back(mem_pkt);
+        isInWriteQueue.insert(burstAlign(addr, mem_intr));
+        dram->writeQueueSize++;
+    }
+
+    logRequest(is_read ? MemCtrl::READ : MemCtrl::WRITE,
+               mem_pkt->requestorId(), mem_pkt->qosValue(), addr, 1);
+
+    if (!nextReqEvent.scheduled()) {
+        schedule(nextReqEvent, curTick());
+    }
+}
+
+void
+HeteroMemCtrl::waitForRead(DRAMCacheAccess* acc, PacketPtr pkt)
+{
+    pendingCacheReads[pkt] = acc;
+    acc->readsPending++;
+}
+
+void
+HeteroMemCtrl::accessAndRespond(PacketPtr pkt, Tick static_latency,
+                                MemInterface* mem_intr)
+{
+    if (!dramCache()) {
+        MemCtrl::accessAndRespond(pkt, static_latency, mem_intr);
+        return;
+    }
+
+    auto it = pendingCacheReads.find(pkt);
+    if (it != pendingCacheReads.end()) {
+        DRAMCacheAccess* acc = it->second;
+        pendingCacheReads.erase(it);
+        dramCacheReadDone(acc, pkt, static_latency);
+    } else {
+        // a read hit, the data of which lives in the nvm
+        MemCtrl::accessAndRespond(pkt, static_latency + tagLatency, nvm);
+    }
+}
+
 void
 HeteroMemCtrl::processRespondEvent(MemInterface* mem_intr,
                         MemPacketQueue& queue,
-                        EventFunctionWrapper& resp_event,
                         bool& retry_rd_req)
 {
     DPRINTF(MemCtrl,
             "processRespondEvent(): Some req has reached its readyTime\n");
 
     if (queue.front()->isDram()) {
-        MemCtrl::processRespondEvent(dram, queue, resp_event, retry_rd_req);
+        MemCtrl::processRespondEvent(dram, queue, retry_rd_req);
     } else {
-        MemCtrl::processRespondEvent(nvm, queue, resp_event, retry_rd_req);
+        MemCtrl::processRespondEvent(nvm, queue, retry_rd_req);
     }
 }
 
@@ -385,6 +660,25 @@ HeteroMemCtrl::pktSizeCheck(MemPacket* mem_pkt, MemInterface* mem_intr) const
     }
 }
 
+Tick
+HeteroMemCtrl::recvAtomicBackdoor(PacketPtr pkt, MemBackdoorPtr &backdoor)
+{
+    // the dram cache tags are only kept up to date by the accesses
+    // reaching the controller, so there are no backdoors to the nvm
+    if (dramCache())
+        return recvAtomic(pkt);
+
+    return MemCtrl::recvAtomicBackdoor(pkt, backdoor);
+}
+
+void
+HeteroMemCtrl::recvMemBackdoorReq(const MemBackdoorReq &req,
+                                  MemBackdoorPtr &backdoor)
+{
+    if (!dramCache())
+        MemCtrl::recvMemBackdoorReq(req, backdoor);
+}
+
 void
 HeteroMemCtrl::recvFunctional(PacketPtr pkt)
 {
@@ -460,7 +754,9 @@ AddrRangeList
 HeteroMemCtrl::getAddrRanges()
 {
     AddrRangeList ranges;
-    ranges.push_back(dram->getAddrRange());
+    // the dram is hidden when it caches the nvm
+    if (!dramCache())
+        ranges.push_back(dram->getAddrRange());
     ranges.push_back(nvm->getAddrRange());
     return ranges;
 }
@@ -46,6 +46,11 @@
 #ifndef __HETERO_MEM_CTRL_HH__
 #define __HETERO_MEM_CTRL_HH__
 
+#include <memory>
+#include <unordered_map>
+
+#include "enums/DRAMCacheOrg.hh"
+#include "mem/dram_cache_tags.hh"
 #include "mem/mem_ctrl.hh"
 #include "params/HeteroMemCtrl.hh"
 
@@ -95,7 +100,6 @@ class HeteroMemCtrl : public MemCtrl
 
     virtual void processRespondEvent(MemInterface* mem_intr,
                         MemPacketQueue& queue,
-                        EventFunctionWrapper& resp_event,
                         bool& retry_rd_req) override;
 
     /**
@@ -121,6 +125,120 @@ class HeteroMemCtrl : public MemCtrl
      */
     virtual bool nvmWriteBlock(MemInterface* mem_intr) override;
 
+    /**
+     * Responds to a read, or in dram cache mode continues the cache
+     * access a read burst belongs to.
+     */
+    void accessAndRespond(PacketPtr pkt, Tick static_latency,
+                          MemInterface* mem_intr) override;
+
+    /**
+     * In dram cache mode, the dram holds copies of nvm lines. The tags
+     * are kept here, and the accesses to the cache are turned into the
+     * dram and nvm bursts they need, which go through the queues like
+     * any other burst. The data itself always lives in the nvm, so the
+     * dram bursts only model the timing of the cache.
+     */
+    const enums::DRAMCacheOrg dramCacheOrg;
+
+    /** Is the dram used as a cache of the nvm */
+    bool dramCache() const { return dramCacheOrg != enums::uncached; }
+
+    /** Size of a dram cache line, the burst size of both media */
+    unsigned lineSize;
+
+    /** Latency of the SRAM tag lookup of a set-associative cache */
+    const Tick tagLatency;
+
+    /** Write dirty lines back on eviction, or write through */
+    const bool writeBack;
+
+    /** Tags of the dram cache */
+    std::unique_ptr<DRAMCacheTags> dramCacheTags;
+
+    /**
+     * An access to the dram cache that is waiting for a read burst to
+     * complete before issuing its remaining bursts.
+     */
+    struct DRAMCacheAccess
+    {
+        /** Packet the internal bursts of the access are decoded with */
+        PacketPtr pkt = nullptr;
+
+        /** Host read waiting for its data, if any */
+        PacketPtr hostRead = nullptr;
+
+        /** Nvm address of the line and dram address of its slot */
+        Addr addr = 0;
+        Addr slot = 0;
+
+        /** Is the access a host write */
+        bool write = false;
+
+        /** Was the line in the cache, and is it now */
+        bool hit = false;
+        bool fill = false;
+
+        /** Nvm address of a dirty line to write back, if any */
+        Addr victim = MaxAddr;
+
+        /** Read bursts still outstanding */
+        unsigned readsPending = 0;
+    };
+
+    /**
+     * Accesses waiting for read bursts, by the packet of the bursts
+     * (the host read, or the internal packet of the access)
+     */
+    std::unordered_map<PacketPtr, DRAMCacheAccess*> pendingCacheReads;
+
+    /**
+     * Look up a line in the dram cache and update the tags as if the
+     * access was done, allocating the line on a miss if the fill
+     * policy allows.
+     *
+     * @param acc the access, with its address and direction set
+     */
+    void lookupDRAMCache(DRAMCacheAccess& acc);
+
+    /**
+     * Start a timing access to the dram cache.
+     *
+     * @param pkt the host packet
+     */
+    void accessDRAMCache(PacketPtr pkt);
+
+    /**
+     * Continue an access once one of its read bursts completed.
+     *
+     * @param acc the access
+     * @param pkt the packet of the burst
+     * @param static_latency latency to respond to a host read with
+     */
+    void dramCacheReadDone(DRAMCacheAccess* acc, PacketPtr pkt,
+                           Tick static_latency);
+
+    /**
+     * Write the data of a host write to the cache or the nvm.
+     *
+     * @param acc the access
+     */
+    void dramCacheWrite(const DRAMCacheAccess& acc);
+
+    /**
+     * Queue a line sized burst for an access to the dram cache.
+     *
+     * @param pkt packet to decode the burst with
+     * @param addr address of the burst in the media
+     * @param is_read is the burst a read
+     * @param mem_intr the media to access
+     */
+    void queueBurst(PacketPtr pkt, Addr addr, bool is_read,
+                    MemInterface* mem_intr);
+
+    /** Keep track of an access waiting for a read burst */
+    void waitForRead(DRAMCacheAccess* acc, PacketPtr pkt);
+
   public:
 
     HeteroMemCtrl(const HeteroMemCtrlParams &p);
@@ -132,7 +250,11 @@ class HeteroMemCtrl : public MemCtrl
   protected:
 
     Tick recvAtomic(PacketPtr pkt) override;
+    Tick recvAtomicBackdoor(PacketPtr pkt,
+                            MemBackdoorPtr &backdoor) override;
     void recvFunctional(PacketPtr pkt) override;
+    void recvMemBackdoorReq(const MemBackdoorReq &req,
+                            MemBackdoorPtr &backdoor) override;
     bool recvTimingReq(PacketPtr pkt) override;
 
 };
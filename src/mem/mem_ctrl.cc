@@ -62,9 +62,10 @@ MemCtrl::MemCtrl(const MemCtrlParams &p) :
     port(name() + ".port", *this), isTimingMode(false),
     retryRdReq(false), retryWrReq(false),
     nextReqEvent([this] {processNextReqEvent(dram, respQueue,
-                         respondEvent, nextReqEvent, retryWrReq);}, name()),
+                         retryWrReq);}, name()),
     respondEvent([this] {processRespondEvent(dram, respQueue,
-                         respondEvent, retryRdReq); }, name()),
+                         retryRdReq); }, name()),
+    respQueue(false),
     dram(p.dram),
     readBufferSize(dram->readBufferSize),
     writeBufferSize(dram->writeBufferSize),
@@ -487,7 +488,6 @@ MemCtrl::recvTimingReq(PacketPtr pkt)
 void
 MemCtrl::processRespondEvent(MemInterface* mem_intr,
                         MemPacketQueue& queue,
-                        EventFunctionWrapper& resp_event,
                         bool& retry_rd_req)
 {
 
@@ -524,8 +524,9 @@ MemCtrl::processRespondEvent(MemInterface* mem_intr,
 
     if (!queue.empty()) {
         assert(queue.front()->readyTime >= curTick());
-        assert(!resp_event.scheduled());
-        schedule(resp_event, queue.front()->readyTime);
+        assert(!respondEventScheduled(mem_intr->pseudoChannel));
+        scheduleRespondEvent(queue.front()->readyTime,
+                             mem_intr->pseudoChannel);
     } else {
         // if there is nothing left in any queue, signal a drain
         if (drainState() == DrainState::Draining &&
@@ -880,8 +881,6 @@ MemCtrl::nonDetermReads(MemInterface* mem_intr) {
 void
 MemCtrl::processNextReqEvent(MemInterface* mem_intr,
                         MemPacketQueue& resp_queue,
-                        EventFunctionWrapper& resp_event,
-                        EventFunctionWrapper& next_req_event,
                         bool& retry_wr_req) {
     // transition is handled by QoS algorithm if enabled
     if (turnPolicy) {
@@ -1022,11 +1021,12 @@ MemCtrl::processNextReqEvent(MemInterface* mem_intr,
             // Insert into response queue. It will be sent back to the
             // requestor at its readyTime
             if (resp_queue.empty()) {
-                assert(!resp_event.scheduled());
-                schedule(resp_event, mem_pkt->readyTime);
+                assert(!respondEventScheduled(mem_intr->pseudoChannel));
+                scheduleRespondEvent(mem_pkt->readyTime,
+                                     mem_intr->pseudoChannel);
             } else {
                 assert(resp_queue.back()->readyTime <= mem_pkt->readyTime);
-                assert(resp_event.scheduled());
+                assert(respondEventScheduled(mem_intr->pseudoChannel));
             }
 
             resp_queue.push_back(mem_pkt);
@@ -1139,8 +1139,9 @@ MemCtrl::processNextReqEvent(MemInterface* mem_intr,
     }
     // It is possible that a refresh to another rank kicks things back into
     // action before reaching this point.
-    if (!next_req_event.scheduled())
-        schedule(next_req_event, std::max(mem_intr->nextReqTime, curTick()));
+    if (!requestEventScheduled(mem_intr->pseudoChannel))
+        restartScheduler(std::max(mem_intr->nextReqTime, curTick()),
+                         mem_intr->pseudoChannel);
 
     if (retry_wr_req && mem_intr->writeQueueSize < writeBufferSize) {
         retry_wr_req = false;
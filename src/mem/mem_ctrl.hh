@@ -55,6 +55,7 @@
 #include "base/callback.hh"
 #include "base/statistics.hh"
 #include "enums/MemSched.hh"
+#include "mem/mem_packet_queue.hh"
 #include "mem/qos/mem_ctrl.hh"
 #include "mem/qport.hh"
 #include "params/MemCtrl.hh"
@@ -215,11 +216,6 @@ class MemPacket
 
 };
 
-// The memory packets are store in a multiple dequeue structure,
-// based on their QoS priority
-typedef std::deque<MemPacket*> MemPacketQueue;
-
-
 /**
  * The memory controller is a single-channel memory controller capturing
  * the most important timing constraints associated with a
@@ -297,18 +293,19 @@ class MemCtrl : public qos::MemCtrl
      * Bunch of things requires to setup "events" in gem5
      * When event "respondEvent" occurs for example, the method
      * processRespondEvent is called; no parameters are allowed
-     * in these methods
+     * in these methods. The methods (re)schedule the events of the
+     * interface through respondEventScheduled, scheduleRespondEvent,
+     * requestEventScheduled and restartScheduler, so that a
+     * controller with several channels can map them to its own
+     * events.
      */
     virtual void processNextReqEvent(MemInterface* mem_intr,
                           MemPacketQueue& resp_queue,
-                          EventFunctionWrapper& resp_event,
-                          EventFunctionWrapper& next_req_event,
                           bool& retry_wr_req);
     EventFunctionWrapper nextReqEvent;
 
     virtual void processRespondEvent(MemInterface* mem_intr,
                         MemPacketQueue& queue,
-                        EventFunctionWrapper& resp_event,
                         bool& retry_rd_req);
     EventFunctionWrapper respondEvent;
 
@@ -489,7 +486,7 @@ class MemCtrl : public qos::MemCtrl
      * as sizing the read queue, this and the main read queue need to
      * be added together.
      */
-    std::deque<MemPacket*> respQueue;
+    MemPacketQueue respQueue;
 
     /**
      * Holds count of commands issued in burst window starting at
@@ -730,6 +727,18 @@ class MemCtrl : public qos::MemCtrl
         return respondEvent.scheduled();
     }
 
+    /**
+     * Schedule the respondEvent
+     *
+     * @param Tick to schedule the event at
+     * @param pseudo_channel pseudo channel number the response is for
+     */
+    virtual void scheduleRespondEvent(Tick tick, uint8_t pseudo_channel = 0)
+    {
+        assert(pseudo_channel == 0);
+        schedule(respondEvent, tick);
+    }
+
     /**
      * Is there a read/write burst Event scheduled?
      *
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/mem_packet_queue.hh"
+
+#include <algorithm>
+#include <cassert>
+
+#include "base/bitfield.hh"
+#include "mem/mem_ctrl.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+const MemPacketQueue::Entry *
+MemPacketQueue::BankQueue::oldestToOtherRow(uint32_t row) const
+{
+    for (const auto &entry : pkts) {
+        if ((*entry.pkt)->row != row)
+            return &entry;
+    }
+    return nullptr;
+}
+
+void
+MemPacketQueue::push_back(MemPacket *mem_pkt)
+{
+    auto it = queue.insert(queue.end(), mem_pkt);
+
+    if (!indexBanks || !mem_pkt->isDram())
+        return;
+
+    if (mem_pkt->pseudoChannel >= bankQueues.size())
+        bankQueues.resize(mem_pkt->pseudoChannel + 1);
+    auto &channel = bankQueues[mem_pkt->pseudoChannel];
+    if (mem_pkt->bankId >= channel.size())
+        channel.resize(mem_pkt->bankId + 1);
+
+    BankQueue &bank_queue = channel[mem_pkt->bankId];
+    Entry entry{it, nextSeq++};
+    bank_queue.pkts.push_back(entry);
+    bank_queue.rows[mem_pkt->row].push_back(entry);
+}
+
+void
+MemPacketQueue::removeFromIndex(iterator it)
+{
+    MemPacket *mem_pkt = *it;
+    BankQueue &bank_queue =
+        bankQueues[mem_pkt->pseudoChannel][mem_pkt->bankId];
+
+    // Packets mostly leave a bank in order, so these searches usually
+    // stop at the front
+    auto is_pkt = [it](const Entry &entry) { return entry.pkt == it; };
+
+    auto pkt_it = std::find_if(bank_queue.pkts.begin(),
+                               bank_queue.pkts.end(), is_pkt);
+    assert(pkt_it != bank_queue.pkts.end());
+    bank_queue.pkts.erase(pkt_it);
+
+    auto row_it = bank_queue.rows.find(mem_pkt->row);
+    assert(row_it != bank_queue.rows.end());
+    auto &row_pkts = row_it->second;
+    auto entry_it = std::find_if(row_pkts.begin(), row_pkts.end(), is_pkt);
+    assert(entry_it != row_pkts.end());
+    row_pkts.erase(entry_it);
+    if (row_pkts.empty())
+        bank_queue.rows.erase(row_it);
+}
+
+MemPacketQueue::iterator
+MemPacketQueue::erase(iterator it)
+{
+    if (indexBanks && (*it)->isDram())
+        removeFromIndex(it);
+    return queue.erase(it);
+}
+
+const MemPacketQueue::Entry *
+MemPacketQueue::chooseNextFRFCFS(uint8_t pseudo_channel,
+                                 const std::vector<BankState> &banks,
+                                 unsigned banks_per_rank, Tick min_col_at,
+                                 const MinBankPrep &min_bank_prep) const
+{
+    // oldest row hit that can issue seamlessly
+    const Entry *seamless_hit = nullptr;
+    // oldest row hit, not seamless, but bank prepped and ready
+    const Entry *prepped_hit = nullptr;
+    // is there any packet to a row that is not open
+    bool found_row_miss = false;
+
+    for (uint16_t bank_id = 0; bank_id < banks.size(); bank_id++) {
+        // skip the banks of ranks that are refreshing
+        const BankState &bank = banks[bank_id];
+        const BankQueue *bank_queue = bankQueue(pseudo_channel, bank_id);
+        if (!bank.available || !bank_queue)
+            continue;
+
+        const Entry *hit = bank_queue->oldestToRow(bank.openRow);
+        if (hit) {
+            const Tick col_allowed_at = (*hit->pkt)->isRead() ?
+                bank.rdAllowedAt : bank.wrAllowedAt;
+
+            // no additional rank-to-rank or same bank-group delays, or
+            // we switched read/write and might as well go for the row
+            // hit
+            if (col_allowed_at <= min_col_at) {
+                if (!seamless_hit || hit->seq < seamless_hit->seq)
+                    seamless_hit = hit;
+            } else if (!prepped_hit || hit->seq < prepped_hit->seq) {
+                prepped_hit = hit;
+            }
+        }
+
+        found_row_miss = found_row_miss ||
+            bank_queue->oldestToOtherRow(bank.openRow);
+    }
+
+    // FCFS within the hits, giving priority to commands that can issue
+    // seamlessly, without additional delay, such as same rank accesses
+    // and/or different bank-group accesses
+    if (seamless_hit)
+        return seamless_hit;
+
+    // the oldest packet to a closed row amongst the first available
+    // banks
+    const Entry *earliest_pkt = nullptr;
+    bool hidden_bank_prep = false;
+
+    if (found_row_miss) {
+        std::vector<uint32_t> earliest_banks;
+        std::tie(earliest_banks, hidden_bank_prep) = min_bank_prep();
+
+        for (uint16_t bank_id = 0; bank_id < banks.size(); bank_id++) {
+            const unsigned bank = bank_id % banks_per_rank;
+            if (!banks[bank_id].available ||
+                !bits(earliest_banks[bank_id / banks_per_rank], bank, bank))
+                continue;
+
+            const BankQueue *bank_queue = bankQueue(pseudo_channel, bank_id);
+            const Entry *miss = bank_queue ?
+                bank_queue->oldestToOtherRow(banks[bank_id].openRow) :
+                nullptr;
+            if (miss && (!earliest_pkt || miss->seq < earliest_pkt->seq))
+                earliest_pkt = miss;
+        }
+    }
+
+    // give priority to packets that can issue bank commands 'behind the
+    // scenes', any additional delay if any will be due to col-to-col
+    // command requirements, otherwise prefer a prepped row hit
+    if (earliest_pkt && (hidden_bank_prep || !prepped_hit))
+        return earliest_pkt;
+    return prepped_hit;
+}
+
+} // namespace memory
+} // namespace gem5
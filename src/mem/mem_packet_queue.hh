@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * MemPacketQueue declaration
+ */
+
+#ifndef __MEM_MEM_PACKET_QUEUE_HH__
+#define __MEM_MEM_PACKET_QUEUE_HH__
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+class MemPacket;
+
+/**
+ * A queue of memory packets in arrival order. The memory packets are
+ * stored in multiple such queues, based on their QoS priority.
+ *
+ * Packets to DRAM are additionally indexed by pseudo channel, bank and
+ * row so that the FR-FCFS scheduler can find the oldest row hit and the
+ * oldest row miss for each bank without scanning the whole queue. The
+ * arrival order of indexed packets is kept as a sequence number so
+ * selections across banks match a first-come first-served scan.
+ * Iterators stay valid until the packet they point to is erased.
+ */
+class MemPacketQueue
+{
+  private:
+    typedef std::list<MemPacket*> Container;
+
+  public:
+    typedef Container::iterator iterator;
+    typedef Container::const_iterator const_iterator;
+
+    /** A queued DRAM packet and its arrival order in the queue */
+    struct Entry
+    {
+        iterator pkt;
+        uint64_t seq;
+    };
+
+    /** The DRAM packets queued for a single bank, oldest first */
+    class BankQueue
+    {
+      private:
+        friend class MemPacketQueue;
+
+        std::deque<Entry> pkts;
+        std::unordered_map<uint32_t, std::deque<Entry>> rows;
+
+      public:
+        bool empty() const { return pkts.empty(); }
+
+        /** Oldest packet to the given row, nullptr if there is none */
+        const Entry *
+        oldestToRow(uint32_t row) const
+        {
+            auto it = rows.find(row);
+            return it == rows.end() ? nullptr : &it->second.front();
+        }
+
+        /** Oldest packet to any other row, nullptr if there is none */
+        const Entry *oldestToOtherRow(uint32_t row) const;
+    };
+
+    /** The state of a DRAM bank the FR-FCFS scheduler looks at */
+    struct BankState
+    {
+        /** Is the rank of the bank available, i.e. not refreshing */
+        bool available;
+        uint32_t openRow;
+        Tick rdAllowedAt;
+        Tick wrAllowedAt;
+    };
+
+    /**
+     * Find the earliest banks ready to issue an activate, as one-hot
+     * masks of banks per rank, and whether their prep can be hidden.
+     */
+    typedef std::function<std::pair<std::vector<uint32_t>, bool>()>
+        MinBankPrep;
+
+  private:
+    Container queue;
+
+    /** Should DRAM packets be indexed by bank and row */
+    const bool indexBanks;
+
+    /** Per pseudo channel, per bank (over all ranks) index */
+    std::vector<std::vector<BankQueue>> bankQueues;
+
+    /** Sequence number handed to the next indexed packet */
+    uint64_t nextSeq = 0;
+
+    void removeFromIndex(iterator it);
+
+  public:
+    explicit MemPacketQueue(bool index_banks = true)
+        : indexBanks(index_banks)
+    { }
+
+    iterator begin() { return queue.begin(); }
+    iterator end() { return queue.end(); }
+    const_iterator begin() const { return queue.begin(); }
+    const_iterator end() const { return queue.end(); }
+
+    bool empty() const { return queue.empty(); }
+    size_t size() const { return queue.size(); }
+
+    MemPacket *front() const { return queue.front(); }
+    MemPacket *back() const { return queue.back(); }
+
+    void push_back(MemPacket *mem_pkt);
+    iterator erase(iterator it);
+    void pop_front() { erase(queue.begin()); }
+
+    /**
+     * Get the DRAM packets queued for a bank.
+     *
+     * @param pseudo_channel Pseudo channel of the DRAM interface
+     * @param bank_id Bank id over all ranks, as in MemPacket::bankId
+     * @return The bank's packets, nullptr if there are none
+     */
+    const BankQueue *
+    bankQueue(uint8_t pseudo_channel, uint16_t bank_id) const
+    {
+        if (pseudo_channel >= bankQueues.size() ||
+            bank_id >= bankQueues[pseudo_channel].size()) {
+            return nullptr;
+        }
+        const BankQueue &bank_queue = bankQueues[pseudo_channel][bank_id];
+        return bank_queue.empty() ? nullptr : &bank_queue;
+    }
+
+    /**
+     * Choose the DRAM packet of a pseudo channel that a first-come
+     * first-served walk of the queue by the FR-FCFS scheduler would,
+     * looking only at the oldest row hit and row miss of each bank:
+     * the oldest seamless row hit, otherwise the oldest row miss to
+     * one of the earliest banks if its prep can be hidden or there is
+     * no row hit, and otherwise the oldest row hit. Like the read and
+     * write queues of the controller, the queue must hold either only
+     * reads or only writes, as only the oldest row hit of a bank is
+     * checked for a seamless issue.
+     *
+     * @param pseudo_channel Pseudo channel of the DRAM interface
+     * @param banks State of the banks, indexed as MemPacket::bankId
+     * @param banks_per_rank Number of banks of each rank
+     * @param min_col_at Minimum tick for 'seamless' issue
+     * @param min_bank_prep Only called if there is a row miss
+     * @return The selected packet, nullptr if there is none
+     */
+    const Entry *chooseNextFRFCFS(uint8_t pseudo_channel,
+                                  const std::vector<BankState> &banks,
+                                  unsigned banks_per_rank, Tick min_col_at,
+                                  const MinBankPrep &min_bank_prep) const;
+};
+
+} // namespace memory
+} // namespace gem5
+
+#endif // __MEM_MEM_PACKET_QUEUE_HH__
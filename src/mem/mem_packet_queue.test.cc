@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "base/bitfield.hh"
+#include "mem/mem_ctrl.hh"
+#include "mem/mem_packet_queue.hh"
+#include "mem/packet.hh"
+#include "mem/request.hh"
+#include "sim/cur_tick.hh"
+#include "sim/eventq.hh"
+
+using namespace gem5;
+using namespace gem5::memory;
+
+namespace
+{
+
+const unsigned ranksPerChannel = 2;
+const unsigned banksPerRank = 4;
+const unsigned numRows = 3;
+const Tick minColAt = 10;
+
+/**
+ * The first-come first-served walk of the whole queue that the DRAM
+ * interface used before the queue was indexed by bank and row, used as
+ * the reference for the packet the indexed selection should choose.
+ */
+MemPacketQueue::iterator
+referenceFRFCFS(MemPacketQueue &queue, uint8_t pseudo_channel,
+                const std::vector<MemPacketQueue::BankState> &banks,
+                const MemPacketQueue::MinBankPrep &min_bank_prep)
+{
+    std::vector<uint32_t> earliest_banks;
+    bool filled_earliest_banks = false;
+    bool hidden_bank_prep = false;
+    bool found_hidden_bank = false;
+    bool found_prepped_pkt = false;
+    bool found_earliest_pkt = false;
+
+    auto selected_pkt_it = queue.end();
+
+    for (auto i = queue.begin(); i != queue.end(); ++i) {
+        MemPacket *pkt = *i;
+        if (!pkt->isDram() || pkt->pseudoChannel != pseudo_channel)
+            continue;
+
+        const MemPacketQueue::BankState &bank = banks[pkt->bankId];
+        if (!bank.available)
+            continue;
+
+        if (bank.openRow == pkt->row) {
+            const Tick col_allowed_at = pkt->isRead() ? bank.rdAllowedAt :
+                                                        bank.wrAllowedAt;
+            if (col_allowed_at <= minColAt) {
+                selected_pkt_it = i;
+                break;
+            } else if (!found_hidden_bank && !found_prepped_pkt) {
+                selected_pkt_it = i;
+                found_prepped_pkt = true;
+            }
+        } else if (!found_earliest_pkt) {
+            if (!filled_earliest_banks) {
+                std::tie(earliest_banks, hidden_bank_prep) =
+                    min_bank_prep();
+                filled_earliest_banks = true;
+            }
+            if (bits(earliest_banks[pkt->rank], pkt->bank, pkt->bank)) {
+                found_earliest_pkt = true;
+                found_hidden_bank = hidden_bank_prep;
+                if (hidden_bank_prep || !found_prepped_pkt)
+                    selected_pkt_it = i;
+            }
+        }
+    }
+
+    return selected_pkt_it;
+}
+
+class MemPacketQueueTest : public testing::TestWithParam<bool>
+{
+  protected:
+    EventQueue eventQueue{"mem_packet_queue_test"};
+    std::mt19937 rng{42};
+    std::vector<std::unique_ptr<Packet>> packets;
+    std::vector<std::unique_ptr<MemPacket>> memPackets;
+
+    void SetUp() override { curEventQueue(&eventQueue); }
+
+    /** Make a read or a write, as the queue under test holds */
+    MemPacket *
+    makeMemPacket(bool dram, uint8_t channel, uint8_t rank, uint8_t bank,
+                  uint32_t row)
+    {
+        const bool read = GetParam();
+        const Addr addr = packets.size() * 64;
+
+        auto req = std::make_shared<Request>(addr, 64, 0, 0);
+        packets.emplace_back(new Packet(req, read ? MemCmd::ReadReq :
+                                                    MemCmd::WriteReq));
+        memPackets.emplace_back(new MemPacket(
+            packets.back().get(), read, dram, channel, rank, bank, row,
+            rank * banksPerRank + bank, addr, 64));
+        return memPackets.back().get();
+    }
+
+    /** Make a packet to a random bank and row of a few channels */
+    MemPacket *
+    makeRandomMemPacket()
+    {
+        const bool dram = rng() % 8 != 0;
+        const uint8_t channel = rng() % 4 == 0;
+        const uint8_t rank = rng() % ranksPerChannel;
+        const uint8_t bank = rng() % banksPerRank;
+        return makeMemPacket(dram, channel, rank, bank, rng() % numRows);
+    }
+
+    /** Draw a column time before, at or after the seamless limit */
+    Tick colAllowedAt() { return minColAt - 1 + rng() % 3; }
+
+    std::vector<MemPacketQueue::BankState>
+    makeBankStates()
+    {
+        std::vector<MemPacketQueue::BankState> banks;
+        for (unsigned i = 0; i < ranksPerChannel; i++) {
+            // most ranks are available, as refresh is rare
+            const bool available = rng() % 4 != 0;
+            for (unsigned j = 0; j < banksPerRank; j++) {
+                // one more than the rows in use for a precharged bank
+                const uint32_t open_row = rng() % (numRows + 1);
+                banks.push_back({available, open_row, colAllowedAt(),
+                                 colAllowedAt()});
+            }
+        }
+        return banks;
+    }
+};
+
+/**
+ * Check the indexed choice against the queue walk over a long random
+ * mix of arrivals and departures, with ties on the seamless limit and
+ * random earliest banks, so that the row hit, bank prep and age
+ * tiebreaks across banks and ranks are all exercised.
+ */
+TEST_P(MemPacketQueueTest, MatchesQueueWalk)
+{
+    MemPacketQueue queue;
+    unsigned selected = 0;
+    unsigned prep_calls = 0;
+
+    for (unsigned step = 0; step < 20000; step++) {
+        if (queue.empty() || rng() % 8 < 5) {
+            queue.push_back(makeRandomMemPacket());
+        } else {
+            auto it = queue.begin();
+            std::advance(it, rng() % queue.size());
+            queue.erase(it);
+        }
+
+        const auto banks = makeBankStates();
+
+        std::vector<uint32_t> earliest_banks(ranksPerChannel);
+        for (auto &mask : earliest_banks)
+            mask = rng() % (1 << banksPerRank);
+        const bool hidden_bank_prep = rng() % 2;
+        auto min_bank_prep = [&] {
+            prep_calls++;
+            return std::make_pair(earliest_banks, hidden_bank_prep);
+        };
+
+        const auto expected =
+            referenceFRFCFS(queue, 0, banks, min_bank_prep);
+        const MemPacketQueue::Entry *entry = queue.chooseNextFRFCFS(
+            0, banks, banksPerRank, minColAt, min_bank_prep);
+
+        if (expected == queue.end()) {
+            EXPECT_EQ(entry, nullptr) << "step " << step;
+        } else {
+            ASSERT_NE(entry, nullptr) << "step " << step;
+            EXPECT_EQ(*entry->pkt, *expected) << "step " << step;
+            selected++;
+        }
+    }
+
+    // make sure the mix actually made choices and needed the bank prep
+    EXPECT_GT(selected, 10000);
+    EXPECT_GT(prep_calls, 1000);
+}
+
+/** Packets that arrive first win when everything else is equal */
+TEST_P(MemPacketQueueTest, OldestWinsTies)
+{
+    MemPacketQueue queue;
+    std::vector<MemPacketQueue::BankState> banks(
+        ranksPerChannel * banksPerRank, {true, 0, minColAt, minColAt});
+
+    auto make = [&](uint8_t rank, uint8_t bank, uint32_t row) {
+        MemPacket *mem_pkt = makeMemPacket(true, 0, rank, bank, row);
+        queue.push_back(mem_pkt);
+        return mem_pkt;
+    };
+    auto no_prep = [] {
+        ADD_FAILURE() << "no row miss to prep for";
+        return std::make_pair(std::vector<uint32_t>(), false);
+    };
+
+    // seamless row hits in later banks and ranks lose to older ones
+    MemPacket *first = make(1, 3, 0);
+    make(0, 0, 0);
+    make(1, 3, 0);
+    auto entry = queue.chooseNextFRFCFS(0, banks, banksPerRank, minColAt,
+                                        no_prep);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(*entry->pkt, first);
+
+    queue.erase(entry->pkt);
+    entry = queue.chooseNextFRFCFS(0, banks, banksPerRank, minColAt,
+                                   no_prep);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ((*entry->pkt)->bankId, 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(ReadsAndWrites, MemPacketQueueTest,
+                         testing::Bool());
+
+} // anonymous namespace
@@ -0,0 +1,410 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/multi_channel_mem_ctrl.hh"
+
+#include <algorithm>
+
+#include "base/trace.hh"
+#include "debug/Drain.hh"
+#include "debug/MemCtrl.hh"
+#include "mem/dram_interface.hh"
+#include "sim/system.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+MultiChannelMemCtrl::MultiChannelMemCtrl(const MultiChannelMemCtrlParams &p)
+    : MemCtrl(p),
+      coordinatedWriteDrain(p.coordinated_write_drain),
+      channelEvent([this] { processChannelEvent(); }, name()),
+      inChannelEvent(false),
+      multiChannelStats(*this)
+{
+    DPRINTF(MemCtrl, "Setting up multi-channel controller\n");
+
+    fatal_if(p.channels.empty(), "%s must have at least one channel\n",
+             name());
+    fatal_if(p.channels.size() > 256, "%s supports at most 256 channels\n",
+             name());
+    fatal_if(p.channels.front() != dram,
+             "%s must use its first channel as the dram interface\n",
+             name());
+
+    // the read and write buffers are shared by all channels, while the
+    // write thresholds apply to each channel and thus remain based on
+    // the buffer of a single channel
+    readBufferSize = 0;
+    writeBufferSize = 0;
+
+    channels.reserve(p.channels.size());
+    for (int i = 0; i < p.channels.size(); i++) {
+        DRAMInterface *dram_intr = p.channels[i];
+        channels.emplace_back(dram_intr);
+        dram_intr->setCtrl(this, commandWindow, i);
+
+        readBufferSize += dram_intr->readBufferSize;
+        writeBufferSize += dram_intr->writeBufferSize;
+    }
+}
+
+void
+MultiChannelMemCtrl::startup()
+{
+    MemCtrl::startup();
+
+    if (isTimingMode) {
+        for (auto &ch : channels) {
+            ch.dram->nextBurstAt = curTick() + ch.dram->commandOffset();
+        }
+    }
+}
+
+MultiChannelMemCtrl::Channel &
+MultiChannelMemCtrl::channelFor(Addr addr)
+{
+    for (auto &ch : channels) {
+        if (ch.dram->getAddrRange().contains(addr))
+            return ch;
+    }
+    panic("Can't handle address %#x\n", addr);
+}
+
+Tick
+MultiChannelMemCtrl::recvAtomic(PacketPtr pkt)
+{
+    return recvAtomicLogic(pkt, channelFor(pkt->getAddr()).dram);
+}
+
+Tick
+MultiChannelMemCtrl::recvAtomicBackdoor(PacketPtr pkt,
+                                        MemBackdoorPtr &backdoor)
+{
+    Channel &ch = channelFor(pkt->getAddr());
+    Tick latency = recvAtomicLogic(pkt, ch.dram);
+    ch.dram->getBackdoor(backdoor);
+    return latency;
+}
+
+void
+MultiChannelMemCtrl::recvFunctional(PacketPtr pkt)
+{
+    for (auto &ch : channels) {
+        if (recvFunctionalLogic(pkt, ch.dram))
+            return;
+    }
+    panic("Can't handle address range for packet %s\n", pkt->print());
+}
+
+void
+MultiChannelMemCtrl::recvMemBackdoorReq(const MemBackdoorReq &req,
+        MemBackdoorPtr &backdoor)
+{
+    channelFor(req.range().start()).dram->getBackdoor(backdoor);
+}
+
+bool
+MultiChannelMemCtrl::readBufferFull(unsigned int pkt_count) const
+{
+    size_t resp_size = 0;
+    for (const auto &ch : channels) {
+        resp_size += ch.respQueue.size();
+    }
+
+    DPRINTF(MemCtrl,
+            "Read queue limit %d, current size %d, entries needed %d\n",
+            readBufferSize, totalReadQueueSize + resp_size, pkt_count);
+
+    return totalReadQueueSize + resp_size + pkt_count > readBufferSize;
+}
+
+bool
+MultiChannelMemCtrl::recvTimingReq(PacketPtr pkt)
+{
+    // This is where we enter from the outside world
+    DPRINTF(MemCtrl, "recvTimingReq: request %s addr %#x size %d\n",
+            pkt->cmdString(), pkt->getAddr(), pkt->getSize());
+
+    panic_if(pkt->cacheResponding(), "Should not see packets where cache "
+             "is responding");
+
+    panic_if(!(pkt->isRead() || pkt->isWrite()),
+             "Should only see read and writes at memory controller\n");
+
+    // Calc avg gap between requests
+    if (prevArrival != 0) {
+        stats.totGap += curTick() - prevArrival;
+    }
+    prevArrival = curTick();
+
+    DRAMInterface *dram_intr = channelFor(pkt->getAddr()).dram;
+    const uint8_t pc = dram_intr->pseudoChannel;
+
+    // Find out how many memory packets a pkt translates to
+    unsigned size = pkt->getSize();
+    uint32_t burst_size = dram_intr->bytesPerBurst();
+    unsigned offset = pkt->getAddr() & (burst_size - 1);
+    unsigned int pkt_count = divCeil(offset + size, burst_size);
+
+    // run the QoS scheduler and assign a QoS priority value to the packet
+    qosSchedule({ &readQueue, &writeQueue }, burst_size, pkt);
+
+    // check the shared buffers and do not accept if full
+    if (pkt->isWrite()) {
+        assert(size != 0);
+        if (writeQueueFull(pkt_count)) {
+            DPRINTF(MemCtrl, "Write queue full, not accepting\n");
+            // remember that we have to retry this port
+            retryWrReq = true;
+            stats.numWrRetry++;
+            return false;
+        }
+
+        addToWriteQueue(pkt, pkt_count, dram_intr);
+        if (!requestEventScheduled(pc)) {
+            DPRINTF(MemCtrl, "Request scheduled immediately\n");
+            restartScheduler(curTick(), pc);
+        }
+        stats.writeReqs++;
+        stats.bytesWrittenSys += size;
+    } else {
+        assert(pkt->isRead());
+        assert(size != 0);
+        if (readBufferFull(pkt_count)) {
+            DPRINTF(MemCtrl, "Read queue full, not accepting\n");
+            // remember that we have to retry this port
+            retryRdReq = true;
+            stats.numRdRetry++;
+            return false;
+        }
+
+        if (!addToReadQueue(pkt, pkt_count, dram_intr)) {
+            if (!requestEventScheduled(pc)) {
+                DPRINTF(MemCtrl, "Request scheduled immediately\n");
+                restartScheduler(curTick(), pc);
+            }
+        }
+        stats.readReqs++;
+        stats.bytesReadSys += size;
+    }
+
+    return true;
+}
+
+void
+MultiChannelMemCtrl::scheduleRespondEvent(Tick tick, uint8_t pseudo_channel)
+{
+    Channel &ch = channels[pseudo_channel];
+    assert(ch.respondAt == MaxTick && tick >= curTick());
+    ch.respondAt = tick;
+    scheduleChannelEvent(tick);
+}
+
+void
+MultiChannelMemCtrl::restartScheduler(Tick tick, uint8_t pseudo_channel)
+{
+    Channel &ch = channels[pseudo_channel];
+    assert(ch.nextReqAt == MaxTick && tick >= curTick());
+    ch.nextReqAt = tick;
+    scheduleChannelEvent(tick);
+}
+
+void
+MultiChannelMemCtrl::scheduleChannelEvent(Tick tick)
+{
+    // while the channels are being processed the event is rescheduled
+    // once they are all done
+    if (inChannelEvent)
+        return;
+
+    if (!channelEvent.scheduled()) {
+        schedule(channelEvent, tick);
+    } else if (channelEvent.when() > tick) {
+        reschedule(channelEvent, tick);
+    }
+}
+
+void
+MultiChannelMemCtrl::processChannelEvent()
+{
+    inChannelEvent = true;
+
+    for (auto &ch : channels) {
+        // deliver the responses first, as they make room in the read
+        // buffer
+        if (ch.respondAt == curTick()) {
+            ch.respondAt = MaxTick;
+            processRespondEvent(ch.dram, ch.respQueue, retryRdReq);
+        }
+
+        if (ch.nextReqAt == curTick()) {
+            ch.nextReqAt = MaxTick;
+
+            const bool was_writing = ch.dram->busStateNext == WRITE;
+            processNextReqEvent(ch.dram, ch.respQueue, retryWrReq);
+
+            if (coordinatedWriteDrain && !was_writing &&
+                ch.dram->busStateNext == WRITE) {
+                coordinateWriteDrain(ch);
+            }
+        }
+    }
+
+    inChannelEvent = false;
+
+    // processing a channel can make an earlier channel due right away,
+    // in which case the event is scheduled for this tick again
+    Tick next = MaxTick;
+    for (const auto &ch : channels) {
+        next = std::min({next, ch.nextReqAt, ch.respondAt});
+    }
+
+    if (next != MaxTick)
+        schedule(channelEvent, next);
+}
+
+void
+MultiChannelMemCtrl::coordinateWriteDrain(const Channel &leader)
+{
+    for (auto &ch : channels) {
+        DRAMInterface *dram_intr = ch.dram;
+        if (&ch == &leader || dram_intr->busStateNext == WRITE ||
+            dram_intr->writeQueueSize <= writeLowThreshold) {
+            continue;
+        }
+
+        DPRINTF(MemCtrl, "Channel %d switching to writes along with "
+                "channel %d, %d writes waiting\n", dram_intr->pseudoChannel,
+                leader.dram->pseudoChannel, dram_intr->writeQueueSize);
+
+        dram_intr->busStateNext = WRITE;
+        multiChannelStats.coordinatedWriteSwitches++;
+    }
+}
+
+Tick
+MultiChannelMemCtrl::doBurstAccess(MemPacket* mem_pkt, MemInterface* mem_intr)
+{
+    // every channel has its own command bus, so track the commands of
+    // the burst in the burst windows of its channel
+    Channel &ch = channels[mem_intr->pseudoChannel];
+    burstTicks.swap(ch.burstTicks);
+    Tick cmd_at = MemCtrl::doBurstAccess(mem_pkt, mem_intr);
+    burstTicks.swap(ch.burstTicks);
+    return cmd_at;
+}
+
+bool
+MultiChannelMemCtrl::respQEmpty()
+{
+    return std::all_of(channels.begin(), channels.end(),
+                       [](const Channel &ch) { return ch.respQueue.empty(); });
+}
+
+bool
+MultiChannelMemCtrl::allIntfDrained() const
+{
+    return std::all_of(channels.begin(), channels.end(),
+                       [](const Channel &ch)
+                       { return ch.dram->allRanksDrained(); });
+}
+
+DrainState
+MultiChannelMemCtrl::drain()
+{
+    // if there is anything in any of our internal queues, keep track
+    // of that as well
+    if (totalWriteQueueSize || totalReadQueueSize || !respQEmpty() ||
+        !allIntfDrained()) {
+        DPRINTF(Drain, "Memory controller not drained, write: %d, "
+                "read: %d\n", totalWriteQueueSize, totalReadQueueSize);
+
+        for (auto &ch : channels) {
+            // the only queue that is not drained automatically over
+            // time is the write queue, thus kick things into action
+            const uint8_t pc = ch.dram->pseudoChannel;
+            if (ch.dram->writeQueueSize && !requestEventScheduled(pc)) {
+                DPRINTF(Drain, "Scheduling channel %d from drain\n", pc);
+                restartScheduler(curTick(), pc);
+            }
+
+            ch.dram->drainRanks();
+        }
+
+        return DrainState::Draining;
+    } else {
+        return DrainState::Drained;
+    }
+}
+
+void
+MultiChannelMemCtrl::drainResume()
+{
+    if (!isTimingMode && system()->isTimingMode()) {
+        // if we switched to timing mode, kick things into action,
+        // and behave as if we restored from a checkpoint
+        startup();
+        for (auto &ch : channels) {
+            ch.dram->startup();
+        }
+    } else if (isTimingMode && !system()->isTimingMode()) {
+        // if we switch from timing mode, stop the refresh events to
+        // not cause issues with KVM
+        for (auto &ch : channels) {
+            ch.dram->suspend();
+        }
+    }
+
+    // update the mode
+    isTimingMode = system()->isTimingMode();
+}
+
+AddrRangeList
+MultiChannelMemCtrl::getAddrRanges()
+{
+    AddrRangeList ranges;
+    for (const auto &ch : channels) {
+        ranges.push_back(ch.dram->getAddrRange());
+    }
+    return ranges;
+}
+
+MultiChannelMemCtrl::MultiChannelStats::MultiChannelStats(
+        MultiChannelMemCtrl &ctrl)
+    : statistics::Group(&ctrl),
+      ADD_STAT(coordinatedWriteSwitches, statistics::units::Count::get(),
+               "Number of channels switched to writes along with another "
+               "channel")
+{
+}
+
+} // namespace memory
+} // namespace gem5
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * MultiChannelMemCtrl declaration
+ */
+
+#ifndef __MEM_MULTI_CHANNEL_MEM_CTRL_HH__
+#define __MEM_MULTI_CHANNEL_MEM_CTRL_HH__
+
+#include <unordered_set>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "mem/mem_ctrl.hh"
+#include "params/MultiChannelMemCtrl.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+class DRAMInterface;
+
+/**
+ * A memory controller for several independent DRAM channels. Rather
+ * than instantiating a controller per channel behind an interleaving
+ * crossbar, the channels share the controller queues and are all
+ * served by a single scheduling loop driven by a single event. Each
+ * channel keeps its own data and command bus, bus direction and
+ * response queue, and is represented to the shared MemCtrl code as a
+ * pseudo channel, as done by the HBMCtrl for its two pseudo channels.
+ *
+ * As all channels are visible to the one controller, policies can
+ * also be coordinated across channels. At the moment this is limited
+ * to optionally draining writes in all channels together.
+ */
+class MultiChannelMemCtrl : public MemCtrl
+{
+  private:
+
+    struct Channel
+    {
+        Channel(DRAMInterface *_dram) : dram(_dram), respQueue(false) {}
+
+        /** The DRAM interface of the channel */
+        DRAMInterface *dram;
+
+        /** Reads of the channel waiting for their response */
+        MemPacketQueue respQueue;
+
+        /**
+         * Commands issued in each burst window on the command bus of
+         * the channel, see MemCtrl::burstTicks
+         */
+        std::unordered_multiset<Tick> burstTicks;
+
+        /**
+         * When the request and response loops of the channel are
+         * next due, or MaxTick if they are not scheduled. These are
+         * the channel's equivalent of the nextReqEvent and
+         * respondEvent of a single channel controller.
+         */
+        Tick nextReqAt = MaxTick;
+        Tick respondAt = MaxTick;
+    };
+
+    std::vector<Channel> channels;
+
+    /** Drain writes in all channels when one of them has to */
+    const bool coordinatedWriteDrain;
+
+    /**
+     * The single event serving the request and response loops of all
+     * channels, scheduled for the earliest one due
+     */
+    EventFunctionWrapper channelEvent;
+
+    /** Set while the channel loops are being processed */
+    bool inChannelEvent;
+
+    void processChannelEvent();
+
+    /** Make sure channelEvent is scheduled no later than tick */
+    void scheduleChannelEvent(Tick tick);
+
+    /**
+     * Let other channels follow a channel that has just switched to
+     * writes, if they have enough writes queued themselves.
+     */
+    void coordinateWriteDrain(const Channel &leader);
+
+    /** Channel serving the given address */
+    Channel &channelFor(Addr addr);
+
+    /** Check if the read queue and the response queues are full */
+    bool readBufferFull(unsigned int pkt_count) const;
+
+    struct MultiChannelStats : public statistics::Group
+    {
+        MultiChannelStats(MultiChannelMemCtrl &ctrl);
+
+        statistics::Scalar coordinatedWriteSwitches;
+    } multiChannelStats;
+
+  protected:
+
+    bool respQEmpty() override;
+
+    Tick doBurstAccess(MemPacket* mem_pkt, MemInterface* mem_intr) override;
+
+    AddrRangeList getAddrRanges() override;
+
+  public:
+
+    MultiChannelMemCtrl(const MultiChannelMemCtrlParams &p);
+
+    bool respondEventScheduled(uint8_t pseudo_channel) const override
+    {
+        return channels[pseudo_channel].respondAt != MaxTick;
+    }
+
+    void scheduleRespondEvent(Tick tick, uint8_t pseudo_channel) override;
+
+    bool requestEventScheduled(uint8_t pseudo_channel) const override
+    {
+        return channels[pseudo_channel].nextReqAt != MaxTick;
+    }
+
+    void restartScheduler(Tick tick, uint8_t pseudo_channel) override;
+
+    bool allIntfDrained() const override;
+
+    DrainState drain() override;
+
+    void startup() override;
+    void drainResume() override;
+
+  protected:
+
+    Tick recvAtomic(PacketPtr pkt) override;
+    Tick recvAtomicBackdoor(PacketPtr pkt, MemBackdoorPtr &backdoor) override;
+    void recvFunctional(PacketPtr pkt) override;
+    void recvMemBackdoorReq(const MemBackdoorReq &req,
+            MemBackdoorPtr &backdoor) override;
+    bool recvTimingReq(PacketPtr pkt) override;
+};
+
+} // namespace memory
+} // namespace gem5
+
+#endif //__MEM_MULTI_CHANNEL_MEM_CTRL_HH__
@@ -45,6 +45,7 @@
 
 #include "mem/noncoherent_xbar.hh"
 
+#include "base/cast.hh"
 #include "base/logging.hh"
 #include "base/trace.hh"
 #include "debug/NoncoherentXBar.hh"
@@ -143,10 +144,18 @@ NoncoherentXBar::recvTimingReq(PacketPtr pkt, PortID cpu_side_port_id)
     const bool expect_response = pkt->needsResponse() &&
         !pkt->cacheResponding();
 
+    // on the fast path the packet carries the route of its response
+    const bool route_in_pkt = fastPath && expect_response;
+    if (route_in_pkt)
+        pkt->pushSenderState(new RouteState(cpu_side_port_id));
+
     // since it is a normal request, attempt to send the packet
     bool success = memSidePorts[mem_side_port_id]->sendTimingReq(pkt);
 
     if (!success)  {
+        if (route_in_pkt)
+            delete pkt->popSenderState();
+
         DPRINTF(NoncoherentXBar, "recvTimingReq: src %s %s 0x%x RETRY\n",
                 src_port->name(), pkt->cmdString(), pkt->getAddr());
 
@@ -161,7 +170,7 @@ NoncoherentXBar::recvTimingReq(PacketPtr pkt, PortID cpu_side_port_id)
     }
 
     // remember where to route the response to
-    if (expect_response) {
+    if (expect_response && !route_in_pkt) {
         assert(routeTo.find(pkt->req) == routeTo.end());
         routeTo[pkt->req] = cpu_side_port_id;
     }
@@ -182,10 +191,14 @@ NoncoherentXBar::recvTimingResp(PacketPtr pkt, PortID mem_side_port_id)
     // determine the source port based on the id
     RequestPort *src_port = memSidePorts[mem_side_port_id];
 
-    // determine the destination
-    const auto route_lookup = routeTo.find(pkt->req);
-    assert(route_lookup != routeTo.end());
-    const PortID cpu_side_port_id = route_lookup->second;
+    // determine the destination, which on the fast path the packet
+    // carries itself
+    const auto route_lookup =
+        fastPath ? routeTo.end() : routeTo.find(pkt->req);
+    assert(fastPath || route_lookup != routeTo.end());
+    const PortID cpu_side_port_id = fastPath ?
+        safe_cast<RouteState *>(pkt->senderState)->port :
+        route_lookup->second;
     assert(cpu_side_port_id != InvalidPortID);
     assert(cpu_side_port_id < respLayers.size());
 
@@ -214,6 +227,12 @@ NoncoherentXBar::recvTimingResp(PacketPtr pkt, PortID mem_side_port_id)
     // determine how long to be crossbar layer is busy
     Tick packetFinishTime = clockEdge(Cycles(1)) + pkt->payloadDelay;
 
+    // remove the request from the routing table
+    if (fastPath)
+        delete pkt->popSenderState();
+    else
+        routeTo.erase(route_lookup);
+
     // send the packet through the destination CPU-side port, and pay for
     // any outstanding latency
     Tick latency = pkt->headerDelay;
@@ -221,9 +240,6 @@ NoncoherentXBar::recvTimingResp(PacketPtr pkt, PortID mem_side_port_id)
     cpuSidePorts[cpu_side_port_id]->schedTimingResp(pkt,
                                         curTick() + latency);
 
-    // remove the request from the routing table
-    routeTo.erase(route_lookup);
-
     respLayers[cpu_side_port_id]->succeededTiming(packetFinishTime);
 
     // stats updates
@@ -51,7 +51,9 @@ PacketQueue::PacketQueue(EventManager& _em, const std::string& _label,
                          const std::string& _sendEventName,
                          bool force_order,
                          bool disable_sanity_check)
-    : em(_em), sendEvent([this]{ processSendEvent(); }, _sendEventName),
+    : transmitRing(16), ringHead(0), ringSize(0), addrFilter{},
+      unindexedPackets(0), em(_em),
+      sendEvent([this]{ processSendEvent(); }, _sendEventName),
       _disableSanityCheck(disable_sanity_check),
       forceOrder(force_order),
       label(_label), waitingOnRetry(false)
@@ -62,6 +64,84 @@ PacketQueue::~PacketQueue()
 {
 }
 
+void
+PacketQueue::growRing()
+{
+    std::vector<DeferredPacket> ring(transmitRing.size() * 2);
+    for (size_t i = 0; i < ringSize; ++i)
+        ring[i] = ringAt(i);
+    transmitRing.swap(ring);
+    ringHead = 0;
+}
+
+void
+PacketQueue::insertAt(size_t pos, const DeferredPacket &dp)
+{
+    if (ringSize == transmitRing.size())
+        growRing();
+    for (size_t i = ringSize; i > pos; --i)
+        ringAt(i) = ringAt(i - 1);
+    ringAt(pos) = dp;
+    ++ringSize;
+    updateAddrFilter(dp.pkt, 1);
+}
+
+void
+PacketQueue::pushFront(const DeferredPacket &dp)
+{
+    if (ringSize == transmitRing.size())
+        growRing();
+    ringHead = (ringHead - 1) & (transmitRing.size() - 1);
+    ringAt(0) = dp;
+    ++ringSize;
+    updateAddrFilter(dp.pkt, 1);
+}
+
+void
+PacketQueue::popFront()
+{
+    assert(!empty());
+    updateAddrFilter(ringAt(0).pkt, -1);
+    ringAt(0).pkt = nullptr;
+    ringHead = (ringHead + 1) & (transmitRing.size() - 1);
+    --ringSize;
+}
+
+void
+PacketQueue::updateAddrFilter(PacketPtr pkt, int delta)
+{
+    const Addr first = pkt->getAddr() >> addrGranuleBits;
+    const Addr last = pkt->getSize() == 0 ? first :
+        (pkt->getAddr() + pkt->getSize() - 1) >> addrGranuleBits;
+
+    if (last - first >= maxIndexedGranules) {
+        unindexedPackets += delta;
+        return;
+    }
+    for (Addr granule = first; granule <= last; ++granule)
+        addrFilter[addrFilterIndex(granule)] += delta;
+}
+
+bool
+PacketQueue::mayOverlap(Addr start, Addr size) const
+{
+    if (empty())
+        return false;
+    if (unindexedPackets)
+        return true;
+
+    const Addr first = start >> addrGranuleBits;
+    const Addr last = size == 0 ? first :
+        (start + size - 1) >> addrGranuleBits;
+    if (last - first >= addrFilter.size())
+        return true;
+    for (Addr granule = first; granule <= last; ++granule) {
+        if (addrFilter[addrFilterIndex(granule)])
+            return true;
+    }
+    return false;
+}
+
 void
 PacketQueue::retry()
 {
@@ -76,8 +156,10 @@ PacketQueue::checkConflict(const PacketPtr pkt, const int blk_size) const
 {
     // caller is responsible for ensuring that all packets have the
     // same alignment
-    for (const auto& p : transmitList) {
-        if (p.pkt->matchBlockAddr(pkt, blk_size))
+    if (!mayOverlap(pkt->getBlockAddr(blk_size), blk_size))
+        return false;
+    for (size_t i = 0; i < ringSize; ++i) {
+        if (ringAt(i).pkt->matchBlockAddr(pkt, blk_size))
             return true;
     }
     return false;
@@ -86,15 +168,20 @@ PacketQueue::checkConflict(const PacketPtr pkt, const int blk_size) const
 bool
 PacketQueue::trySatisfyFunctional(PacketPtr pkt)
 {
+    // only packets overlapping the functional access can affect it,
+    // so skip the scan if the filter rules that out
+    if (!mayOverlap(pkt->getAddr(), pkt->getSize()))
+        return false;
+
     pkt->pushLabel(label);
 
-    auto i = transmitList.begin();
+    size_t i = 0;
     bool found = false;
 
-    while (!found && i != transmitList.end()) {
+    while (!found && i < ringSize) {
         // If the buffered packet contains data, and it overlaps the
         // current packet, then update data
-        found = pkt->trySatisfyFunctional(i->pkt);
+        found = pkt->trySatisfyFunctional(ringAt(i).pkt);
         ++i;
     }
 
@@ -118,7 +205,7 @@ PacketQueue::schedSendTiming(PacketPtr pkt, Tick when)
 
     // add a very basic sanity check on the port to ensure the
     // invisible buffer is not growing beyond reasonable limits
-    if (!_disableSanityCheck && transmitList.size() > 1024) {
+    if (!_disableSanityCheck && ringSize > 1024) {
         panic("Packet queue %s has grown beyond 1024 packets\n",
               name());
     }
@@ -134,20 +221,20 @@ PacketQueue::schedSendTiming(PacketPtr pkt, Tick when)
     // this belongs in the middle somewhere, so search from the end to
     // order by tick; however, if forceOrder is set, also make sure
     // not to re-order in front of some existing packet with the same
-    // address
-    auto it = transmitList.end();
-    while (it != transmitList.begin()) {
-        --it;
-        if ((forceOrder && it->pkt->matchAddr(pkt)) || it->tick <= when) {
-            // emplace inserts the element before the position pointed to by
-            // the iterator, so advance it one step
-            transmitList.emplace(++it, when, pkt);
+    // address, in the common case this appends at the tail
+    size_t pos = ringSize;
+    while (pos > 0) {
+        const DeferredPacket &dp = ringAt(pos - 1);
+        if ((forceOrder && dp.pkt->matchAddr(pkt)) || dp.tick <= when) {
+            insertAt(pos, DeferredPacket(when, pkt));
             return;
         }
+        --pos;
     }
-    // either the packet list is empty or this has to be inserted
-    // before every other packet
-    transmitList.emplace_front(when, pkt);
+    // either the queue is empty, as it normally is for the response
+    // to a cache hit, or this has to be inserted before every other
+    // packet
+    pushFront(DeferredPacket(when, pkt));
     schedSendEvent(when);
 }
 
@@ -178,7 +265,7 @@ PacketQueue::schedSendEvent(Tick when)
         // we get a MaxTick when there is no more to send, so if we're
         // draining, we may be done at this point
         if (drainState() == DrainState::Draining &&
-            transmitList.empty() && !sendEvent.scheduled()) {
+            empty() && !sendEvent.scheduled()) {
 
             DPRINTF(Drain, "PacketQueue done draining,"
                     "processing drain event\n");
@@ -194,14 +281,14 @@ PacketQueue::sendDeferredPacket()
     assert(!waitingOnRetry);
     assert(deferredPacketReady());
 
-    DeferredPacket dp = transmitList.front();
+    DeferredPacket dp = front();
 
-    // take the packet of the list before sending it, as sending of
+    // take the packet of the queue before sending it, as sending of
     // the packet in some cases causes a new packet to be enqueued
     // (most notaly when responding to the timing CPU, leading to a
     // new request hitting in the L1 icache, leading to a new
     // response)
-    transmitList.pop_front();
+    popFront();
 
     // use the appropriate implementation of sendTiming based on the
     // type of queue
@@ -212,8 +299,8 @@ PacketQueue::sendDeferredPacket()
     if (!waitingOnRetry) {
         schedSendEvent(deferredPacketReadyTime());
     } else {
-        // put the packet back at the front of the list
-        transmitList.emplace_front(dp);
+        // put the packet back at the front of the queue
+        pushFront(dp);
     }
 }
 
@@ -227,7 +314,7 @@ PacketQueue::processSendEvent()
 DrainState
 PacketQueue::drain()
 {
-    if (transmitList.empty()) {
+    if (empty()) {
         return DrainState::Drained;
     } else {
         DPRINTF(Drain, "PacketQueue not drained\n");
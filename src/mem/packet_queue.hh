@@ -49,7 +49,8 @@
  * for the flow control of the port.
  */
 
-#include <list>
+#include <array>
+#include <vector>
 
 #include "mem/port.hh"
 #include "sim/drain.hh"
@@ -71,15 +72,90 @@ class PacketQueue : public Drainable
       public:
         Tick tick;      ///< The tick when the packet is ready to transmit
         PacketPtr pkt;  ///< Pointer to the packet to transmit
-        DeferredPacket(Tick t, PacketPtr p)
+        DeferredPacket(Tick t = MaxTick, PacketPtr p = nullptr)
             : tick(t), pkt(p)
         {}
     };
 
-    typedef std::list<DeferredPacket> DeferredPacketList;
+    /**
+     * The outgoing packets, ordered by tick, in a circular buffer whose
+     * size is a power of two. Packets are nearly always scheduled at or
+     * after the last one in the queue, so insertion is normally an O(1)
+     * append at the tail, and sending pops the head. The buffer only
+     * grows, so once it has reached the working size of the queue no
+     * further allocations are made.
+     */
+    std::vector<DeferredPacket> transmitRing;
+
+    /** Index of the head of the queue in the ring. */
+    size_t ringHead;
+
+    /** Number of packets in the ring. */
+    size_t ringSize;
+
+    /** Get the i-th packet from the head of the queue. */
+    DeferredPacket &
+    ringAt(size_t i)
+    { return transmitRing[(ringHead + i) & (transmitRing.size() - 1)]; }
+
+    const DeferredPacket &
+    ringAt(size_t i) const
+    { return transmitRing[(ringHead + i) & (transmitRing.size() - 1)]; }
+
+    /** Double the ring, keeping the packets in order. */
+    void growRing();
+
+    /** Insert a packet at position pos, shifting the later ones. */
+    void insertAt(size_t pos, const DeferredPacket &dp);
+
+    /** Put a packet at the head of the queue. */
+    void pushFront(const DeferredPacket &dp);
+
+    /** Remove the packet at the head of the queue. */
+    void popFront();
+
+    /** Log2 of the number of counters in the address filter. */
+    static constexpr unsigned addrFilterBits = 8;
+
+    /** Log2 of the address granule tracked by the address filter. */
+    static constexpr unsigned addrGranuleBits = 6;
+
+    /** Packets spanning more granules than this are not indexed. */
+    static constexpr Addr maxIndexedGranules = 4;
+
+    /**
+     * A counting filter of the address granules touched by the queued
+     * packets. Functional accesses and conflict checks only scan the
+     * queue if one of the granules they cover has a non-zero count,
+     * which avoids the scan entirely in the common case of no overlap.
+     */
+    std::array<uint32_t, 1 << addrFilterBits> addrFilter;
+
+    /** Number of queued packets too large to be put in the filter. */
+    unsigned unindexedPackets;
+
+    /** Get the filter counter of an address granule. */
+    static unsigned
+    addrFilterIndex(Addr granule)
+    {
+        return (granule ^ (granule >> addrFilterBits)) &
+            ((1 << addrFilterBits) - 1);
+    }
+
+    /** Add or remove a packet from the address filter. */
+    void updateAddrFilter(PacketPtr pkt, int delta);
+
+    /**
+     * Check whether any queued packet may overlap the given address
+     * range. False positives are possible, false negatives are not.
+     */
+    bool mayOverlap(Addr start, Addr size) const;
+
+    /** Check whether the queue holds no packets at all. */
+    bool empty() const { return ringSize == 0; }
 
-    /** A list of outgoing packets. */
-    DeferredPacketList transmitList;
+    /** Get the packet at the head of the queue, which must exist. */
+    const DeferredPacket &front() const { return ringAt(0); }
 
     /** The manager which is used for the event queue */
     EventManager& em;
@@ -92,7 +168,7 @@ class PacketQueue : public Drainable
 
      /*
       * Optionally disable the sanity check
-      * on the size of the transmitList. The
+      * on the size of the queue. The
       * sanity check will be enabled by default.
       */
     bool _disableSanityCheck;
@@ -114,7 +190,7 @@ class PacketQueue : public Drainable
 
     /** Check whether we have a packet ready to go on the transmit list. */
     bool deferredPacketReady() const
-    { return !transmitList.empty() && transmitList.front().tick <= curTick(); }
+    { return !empty() && front().tick <= curTick(); }
 
     /**
      * Attempt to send a packet. Note that a subclass of the
@@ -140,7 +216,7 @@ class PacketQueue : public Drainable
      * @param _label Label to push on the label stack for print request packets
      * @param force_order Force insertion order for packets with same address
      * @param disable_sanity_check Flag used to disable the sanity check
-     *        on the size of the transmitList. The check is enabled by default.
+     *        on the size of the queue. The check is enabled by default.
      */
     PacketQueue(EventManager& _em, const std::string& _label,
                 const std::string& _sendEventName,
@@ -164,13 +240,13 @@ class PacketQueue : public Drainable
     /**
      * Get the size of the queue.
      */
-    size_t size() const { return transmitList.size(); }
+    size_t size() const { return ringSize; }
 
     /**
      * Get the next packet ready time.
      */
     Tick deferredPacketReadyTime() const
-    { return transmitList.empty() ? MaxTick : transmitList.front().tick; }
+    { return empty() ? MaxTick : front().tick; }
 
     /**
      * Check if a packet corresponding to the same address exists in the
@@ -214,7 +290,7 @@ class PacketQueue : public Drainable
 
     /**
       * This allows a user to explicitly disable the sanity check
-      * on the size of the transmitList, which is enabled by default.
+      * on the size of the queue, which is enabled by default.
       * Users must use this function to explicitly disable the sanity
       * check.
       */
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <list>
+#include <memory>
+#include <random>
+
+#include "mem/packet.hh"
+#include "mem/packet_queue.hh"
+#include "mem/request.hh"
+#include "sim/cur_tick.hh"
+#include "sim/eventq.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/**
+ * The transmit list the packet queue used before it became a ring,
+ * with the same insertion rule, used as the reference for the order in
+ * which packets leave the queue.
+ */
+class ReferenceList
+{
+  public:
+    struct Entry
+    {
+        Tick tick;
+        PacketPtr pkt;
+    };
+
+    std::list<Entry> entries;
+
+    void
+    insert(PacketPtr pkt, Tick when, bool force_order)
+    {
+        auto it = entries.end();
+        while (it != entries.begin()) {
+            --it;
+            if ((force_order && it->pkt->matchAddr(pkt)) ||
+                it->tick <= when) {
+                entries.emplace(++it, Entry{when, pkt});
+                return;
+            }
+        }
+        entries.emplace_front(Entry{when, pkt});
+    }
+};
+
+/**
+ * A packet queue that checks every packet it sends against the head
+ * of the reference list, and refuses some sends to exercise retries.
+ */
+class CheckedQueue : public PacketQueue
+{
+  public:
+    CheckedQueue(EventManager &em, bool force_order, std::mt19937 &_rng)
+        : PacketQueue(em, "queue", "queue.send_event", force_order),
+          rng(_rng)
+    {}
+
+    const std::string name() const override { return "queue"; }
+
+    using PacketQueue::retry;
+
+    ReferenceList reference;
+    bool refuseSome = false;
+    bool refused = false;
+    unsigned sent = 0;
+
+  protected:
+    bool
+    sendTiming(PacketPtr pkt) override
+    {
+        EXPECT_FALSE(reference.entries.empty());
+        if (reference.entries.empty())
+            return true;
+
+        const auto &head = reference.entries.front();
+        EXPECT_EQ(head.pkt, pkt);
+        EXPECT_GE(curTick(), head.tick);
+
+        if (refuseSome && rng() % 5 == 0) {
+            refused = true;
+            return false;
+        }
+
+        reference.entries.pop_front();
+        delete pkt;
+        ++sent;
+        return true;
+    }
+
+  private:
+    std::mt19937 &rng;
+};
+
+class PacketQueueTest : public testing::TestWithParam<bool>
+{
+  protected:
+    EventQueue eventQueue{"packet_queue_test"};
+    EventManager eventManager{&eventQueue};
+    std::mt19937 rng{42};
+
+    void SetUp() override { curEventQueue(&eventQueue); }
+
+    PacketPtr
+    makePacket(Addr addr)
+    {
+        auto req = std::make_shared<Request>(addr, 32, 0, 0);
+        return new Packet(req, MemCmd::ReadResp);
+    }
+
+    /** Queue a packet on both the ring and the reference list. */
+    void
+    schedule(CheckedQueue &queue, Addr addr, Tick when)
+    {
+        PacketPtr pkt = makePacket(addr);
+        queue.reference.insert(pkt, when, GetParam());
+        queue.schedSendTiming(pkt, when);
+    }
+
+    /** Service all events up to and including the given tick. */
+    void
+    runUntil(Tick tick)
+    {
+        while (!eventQueue.empty() && eventQueue.nextTick() <= tick)
+            eventQueue.serviceOne();
+        eventQueue.setCurTick(tick);
+    }
+};
+
+} // anonymous namespace
+
+/**
+ * Fill the queue in batches with random ready times, many of them
+ * equal and many in the past of the current tail, then let it drain.
+ */
+TEST_P(PacketQueueTest, BatchesMatchList)
+{
+    CheckedQueue queue(eventManager, GetParam(), rng);
+    unsigned queued = 0;
+
+    for (int batch = 0; batch < 50; ++batch) {
+        const int count = 1 + rng() % 40;
+        for (int i = 0; i < count; ++i) {
+            schedule(queue, (rng() % 16) * 32, curTick() + rng() % 8);
+            ++queued;
+        }
+        runUntil(MaxTick - 1);
+        EXPECT_TRUE(queue.reference.entries.empty());
+        EXPECT_EQ(queue.size(), 0);
+        eventQueue.setCurTick(curTick() + 100);
+    }
+
+    EXPECT_EQ(queue.sent, queued);
+}
+
+/**
+ * Interleave insertions with sends and refused sends, so that packets
+ * are queued while others are waiting, are put back at the head after
+ * a refusal, and the ring wraps around and grows.
+ */
+TEST_P(PacketQueueTest, InterleavedMatchesList)
+{
+    CheckedQueue queue(eventManager, GetParam(), rng);
+    queue.refuseSome = true;
+    unsigned queued = 0;
+    size_t max_size = 0;
+
+    for (int step = 0; step < 5000; ++step) {
+        const int count = rng() % (step % 500 < 50 ? 8 : 3);
+        for (int i = 0; i < count; ++i) {
+            Tick delay = rng() % 4 == 0 ? rng() % 50 : 10 + rng() % 3;
+            schedule(queue, (rng() % 64) * 32, curTick() + delay);
+            ++queued;
+        }
+        max_size = std::max(max_size, queue.size());
+
+        if (queue.refused && rng() % 2) {
+            queue.refused = false;
+            queue.retry();
+        }
+        runUntil(curTick() + 1 + rng() % 10);
+    }
+
+    queue.refuseSome = false;
+    if (queue.refused) {
+        queue.refused = false;
+        queue.retry();
+    }
+    runUntil(MaxTick - 1);
+
+    EXPECT_TRUE(queue.reference.entries.empty());
+    EXPECT_EQ(queue.sent, queued);
+    // the ring must have grown past its initial size
+    EXPECT_GT(max_size, 16);
+}
+
+INSTANTIATE_TEST_SUITE_P(ForceOrder, PacketQueueTest, testing::Bool());
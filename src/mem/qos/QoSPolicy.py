@@ -133,3 +133,31 @@ class QoSPropFairPolicy(QoSPolicy):
                     )
 
     weight = Param.Float(0.5, "Pf score weight")
+
+
+class QoSPartitionBandwidthPolicy(QoSPolicy):
+    type = "QoSPartitionBandwidthPolicy"
+    cxx_header = "mem/qos/policy_part_bw.hh"
+    cxx_class = "gem5::memory::qos::PartitionBandwidthPolicy"
+
+    # The partition manager reads the partition ID of the packets,
+    # e.g. an MPAM MSC for the partition IDs of Arm requests
+    partition_manager = Param.PartitionManager(
+        "Reads the partition ID of the packets"
+    )
+
+    # The bandwidth limits are fractions of the peak bandwidth, like
+    # the MPAM memory bandwidth minimum and maximum controls
+    partition_ids = VectorParam.UInt64([], "Regulated partition IDs")
+    min_bandwidth = VectorParam.Float(
+        [], "Fraction of the peak bandwidth below which a partition is boosted"
+    )
+    max_bandwidth = VectorParam.Float(
+        [], "Fraction of the peak bandwidth from which a partition is demoted"
+    )
+    peak_bandwidth = Param.MemoryBandwidth("Peak bandwidth of the memory")
+
+    window = Param.Latency("1us", "Window the bandwidth is measured over")
+    regulation_threshold = Param.Unsigned(
+        0, "Packets in the read or write queue from which to regulate"
+    )
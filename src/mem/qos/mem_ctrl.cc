@@ -233,7 +233,7 @@ MemCtrl::schedule(const PacketPtr pkt)
     assert(pkt->req);
 
     if (policy) {
-        return schedule(pkt->req->requestorId(), pkt->getSize());
+        return policy->schedule(pkt);
     } else {
         DPRINTF(QOS, "qos::MemCtrl::schedule Packet received [Qv %d], "
                 "but QoS scheduler not initialized\n",
@@ -110,13 +110,14 @@ class Policy : public SimObject
                               const uint64_t data) = 0;
 
     /**
-     * Schedules a packet. Non virtual interface for the scheduling
-     * method requiring a requestor id.
+     * Schedules a packet. By default this defers to the scheduling
+     * method requiring a requestor id, but policies using more of the
+     * packet than its requestor can override it.
      *
      * @param pkt pointer to packet to schedule
      * @return QoS priority value
      */
-    uint8_t schedule(const PacketPtr pkt);
+    virtual uint8_t schedule(const PacketPtr pkt);
 
   protected:
     /** Pointer to parent memory controller implementing the policy */
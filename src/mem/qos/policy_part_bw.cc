@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/qos/policy_part_bw.hh"
+
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/QOS.hh"
+#include "mem/cache/tags/partitioning_policies/partition_manager.hh"
+#include "params/QoSPartitionBandwidthPolicy.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+namespace qos
+{
+
+PartitionBandwidthPolicy::PartitionBandwidthPolicy(const Params &p)
+  : Policy(p), partitionManager(p.partition_manager), window(p.window),
+    regulationThreshold(p.regulation_threshold), stats(*this, p)
+{
+    fatal_if(!partitionManager, "%s needs a partition manager\n", name());
+    fatal_if(window == 0, "%s needs a non-zero window\n", name());
+    fatal_if(p.min_bandwidth.size() != p.partition_ids.size() ||
+             p.max_bandwidth.size() != p.partition_ids.size(),
+             "%s needs a minimum and maximum bandwidth per partition\n",
+             name());
+
+    // the peak bandwidth is in ticks per byte
+    const double window_bytes = window / p.peak_bandwidth;
+
+    for (int i = 0; i < p.partition_ids.size(); i++) {
+        const double min_bw = p.min_bandwidth[i];
+        const double max_bw = p.max_bandwidth[i];
+        fatal_if(min_bw < 0 || min_bw > max_bw || max_bw > 1,
+                 "%s: bandwidth limits of partition %d must be fractions "
+                 "with the minimum no larger than the maximum\n",
+                 name(), p.partition_ids[i]);
+
+        Partition part;
+        part.minBytes = min_bw * window_bytes;
+        part.maxBytes = max_bw * window_bytes;
+        part.index = i;
+
+        fatal_if(!partitions.emplace(p.partition_ids[i], part).second,
+                 "%s: partition %d is listed twice\n", name(),
+                 p.partition_ids[i]);
+    }
+}
+
+void
+PartitionBandwidthPolicy::init()
+{
+    fatal_if(memCtrl->numPriorities() < 3,
+             "%s needs at least three QoS priorities\n", name());
+}
+
+uint64_t
+PartitionBandwidthPolicy::recentBytes(Partition &part) const
+{
+    const uint64_t cur_window = curTick() / window;
+
+    if (cur_window != part.window) {
+        part.prevBytes = cur_window == part.window + 1 ? part.curBytes : 0;
+        part.curBytes = 0;
+        part.window = cur_window;
+    }
+
+    const Tick elapsed = curTick() % window;
+    return part.curBytes + part.prevBytes * (window - elapsed) / window;
+}
+
+uint8_t
+PartitionBandwidthPolicy::schedulePartition(uint64_t partition_id,
+                                            uint64_t bytes, uint64_t queued)
+{
+    const uint8_t max_prio = memCtrl->numPriorities() - 1;
+    uint8_t prio = max_prio / 2;
+
+    auto it = partitions.find(partition_id);
+    if (it == partitions.end())
+        return prio;
+
+    Partition &part = it->second;
+    const uint64_t recent_bytes = recentBytes(part);
+
+    if (queued >= regulationThreshold) {
+        if (recent_bytes < part.minBytes) {
+            prio = max_prio;
+            stats.belowMin[part.index]++;
+        } else if (recent_bytes >= part.maxBytes) {
+            prio = 0;
+            stats.aboveMax[part.index]++;
+        }
+    }
+
+    DPRINTF(QOS, "Partition %d used %d bytes recently (min %d, max %d), "
+            "priority %d\n", partition_id, recent_bytes, part.minBytes,
+            part.maxBytes, prio);
+
+    part.curBytes += bytes;
+    stats.bytes[part.index] += bytes;
+
+    return prio;
+}
+
+uint8_t
+PartitionBandwidthPolicy::schedule(const PacketPtr pkt)
+{
+    assert(pkt->req);
+
+    const uint64_t partition_id =
+        partitionManager->readPacketPartitionID(pkt);
+    requestorPartitions[pkt->requestorId()] = partition_id;
+
+    const uint64_t queued = pkt->isRead() ?
+        memCtrl->getTotalReadQueueSize() : memCtrl->getTotalWriteQueueSize();
+
+    return schedulePartition(partition_id, pkt->getSize(), queued);
+}
+
+uint8_t
+PartitionBandwidthPolicy::schedule(const RequestorID id, const uint64_t data)
+{
+    auto it = requestorPartitions.find(id);
+    const uint64_t partition_id = it == requestorPartitions.end() ?
+        0 : it->second;
+
+    return schedulePartition(partition_id, data,
+                             memCtrl->getTotalReadQueueSize() +
+                             memCtrl->getTotalWriteQueueSize());
+}
+
+PartitionBandwidthPolicy::PolicyStats::PolicyStats(
+        PartitionBandwidthPolicy &policy, const Params &p)
+  : statistics::Group(&policy),
+    ADD_STAT(belowMin, statistics::units::Count::get(),
+             "Packets scheduled while below the minimum bandwidth"),
+    ADD_STAT(aboveMax, statistics::units::Count::get(),
+             "Packets scheduled while at or above the maximum bandwidth"),
+    ADD_STAT(bytes, statistics::units::Byte::get(),
+             "Bytes scheduled per partition")
+{
+    const int num_partitions = p.partition_ids.size();
+    belowMin.init(num_partitions);
+    aboveMax.init(num_partitions);
+    bytes.init(num_partitions);
+
+    for (int i = 0; i < num_partitions; i++) {
+        const std::string partition =
+            csprintf("partition%d", p.partition_ids[i]);
+        belowMin.subname(i, partition);
+        aboveMax.subname(i, partition);
+        bytes.subname(i, partition);
+    }
+}
+
+} // namespace qos
+} // namespace memory
+} // namespace gem5
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_QOS_POLICY_PART_BW_HH__
+#define __MEM_QOS_POLICY_PART_BW_HH__
+
+#include <cstdint>
+#include <unordered_map>
+
+#include "base/statistics.hh"
+#include "mem/qos/policy.hh"
+
+namespace gem5
+{
+
+struct QoSPartitionBandwidthPolicyParams;
+
+namespace partitioning_policy
+{
+class PartitionManager;
+} // namespace partitioning_policy
+
+namespace memory
+{
+
+namespace qos
+{
+
+/**
+ * Partition Bandwidth QoS Policy
+ * Regulates the memory bandwidth used by each partition, in the
+ * manner of the MPAM memory bandwidth minimum and maximum partitioning
+ * controls. The partition ID of a packet is read by a partition
+ * manager, e.g. an MPAM MSC to use the partition IDs tagged on Arm
+ * requests.
+ *
+ * The bandwidth each partition used over a sliding window is compared
+ * to its limits: a partition below its minimum bandwidth gets the
+ * highest priority, a partition at or above its maximum bandwidth the
+ * lowest, and any other partition a priority in between. Partitions
+ * without limits always get the middle priority. Optionally, the
+ * bandwidth is only regulated when the read or write queue the packet
+ * goes to is contended.
+ */
+class PartitionBandwidthPolicy : public Policy
+{
+    using Params = QoSPartitionBandwidthPolicyParams;
+
+  public:
+    PartitionBandwidthPolicy(const Params &);
+
+    void init() override;
+
+    /**
+     * Schedules a packet based on the recent bandwidth of its
+     * partition, and accounts for the bytes of the packet
+     *
+     * @param pkt pointer to packet to schedule
+     * @return QoS priority value
+     */
+    uint8_t schedule(const PacketPtr pkt) override;
+
+    /**
+     * Schedules a requestor based on the partition of its last packet
+     *
+     * @param id requestor id to schedule
+     * @param data bytes to account for
+     * @return QoS priority value
+     */
+    uint8_t schedule(const RequestorID id, const uint64_t data) override;
+
+  protected:
+    struct Partition
+    {
+        /** Bytes per window below which the partition is boosted */
+        uint64_t minBytes;
+
+        /** Bytes per window from which the partition is demoted */
+        uint64_t maxBytes;
+
+        /** Index of the stats of the partition */
+        int index;
+
+        /** Current window, and the bytes in it and the one before */
+        uint64_t window = 0;
+        uint64_t curBytes = 0;
+        uint64_t prevBytes = 0;
+    };
+
+    /**
+     * Estimate the bytes the partition used over the last window,
+     * from the bytes of the current window and the part of the
+     * previous window that is still within the last window
+     */
+    uint64_t recentBytes(Partition &part) const;
+
+    /**
+     * Select the priority of a partition and account for the bytes
+     *
+     * @param partition_id partition to schedule
+     * @param bytes bytes to account for
+     * @param queued packets in the queue(s) the bytes go to
+     * @return QoS priority value
+     */
+    uint8_t schedulePartition(uint64_t partition_id, uint64_t bytes,
+                              uint64_t queued);
+
+    /** Reads the partition ID of the packets */
+    const partitioning_policy::PartitionManager *partitionManager;
+
+    /** Length of the window the bandwidth is measured over */
+    const Tick window;
+
+    /** Queued packets from which the bandwidth is regulated */
+    const uint64_t regulationThreshold;
+
+    /** Regulated partitions, by partition ID */
+    std::unordered_map<uint64_t, Partition> partitions;
+
+    /** Partition of the last packet of each requestor */
+    std::unordered_map<RequestorID, uint64_t> requestorPartitions;
+
+    struct PolicyStats : public statistics::Group
+    {
+        PolicyStats(PartitionBandwidthPolicy &policy, const Params &p);
+
+        /** Packets scheduled while below the minimum bandwidth */
+        statistics::Vector belowMin;
+
+        /** Packets scheduled while at or above the maximum bandwidth */
+        statistics::Vector aboveMax;
+
+        /** Bytes scheduled for each partition */
+        statistics::Vector bytes;
+    } stats;
+};
+
+} // namespace qos
+} // namespace memory
+} // namespace gem5
+
+#endif // __MEM_QOS_POLICY_PART_BW_HH__
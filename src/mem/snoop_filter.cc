@@ -42,6 +42,9 @@
 
 #include "mem/snoop_filter.hh"
 
+#include <iomanip>
+
+#include "base/intmath.hh"
 #include "base/logging.hh"
 #include "base/trace.hh"
 #include "debug/SnoopFilter.hh"
@@ -50,14 +53,192 @@
 namespace gem5
 {
 
-const int SnoopFilter::SNOOP_MASK_SIZE;
+void
+SnoopFilter::SnoopMask::print(std::ostream &os) const
+{
+    // most significant non-zero word first
+    size_t top = high.size();
+    while (top > 0 && !high[top - 1])
+        --top;
+
+    const auto flags = os.flags();
+    const auto fill = os.fill();
+    os << std::hex << (top ? high[top - 1] : low);
+    for (size_t w = top; w > 0; --w) {
+        os << std::setw(16) << std::setfill('0')
+           << (w > 1 ? high[w - 2] : low);
+    }
+    os.flags(flags);
+    os.fill(fill);
+}
+
+SnoopFilter::FlatTable::FlatTable()
+    : slots(InitialSlots), count(0)
+{
+}
+
+SnoopFilter::Entry *
+SnoopFilter::FlatTable::find(Addr line)
+{
+    const size_t mask = slots.size() - 1;
+    for (size_t i = home(line); ; i = (i + 1) & mask) {
+        Entry &entry = slots[i];
+        if (entry.line == line)
+            return &entry;
+        if (entry.line == InvalidLine)
+            return nullptr;
+    }
+}
+
+SnoopFilter::Entry *
+SnoopFilter::FlatTable::insert(Addr line)
+{
+    assert(line != InvalidLine);
+
+    // keep the load factor at or below one half to keep probe
+    // sequences short
+    if (2 * (count + 1) > slots.size())
+        grow();
+
+    const size_t mask = slots.size() - 1;
+    size_t i = home(line);
+    while (slots[i].line != InvalidLine) {
+        assert(slots[i].line != line);
+        i = (i + 1) & mask;
+    }
+    ++count;
+    slots[i].line = line;
+    return &slots[i];
+}
+
+void
+SnoopFilter::FlatTable::erase(Entry *entry)
+{
+    assert(owns(entry) && entry->line != InvalidLine);
+
+    // shift back any following entry of the run whose home slot is
+    // not cyclically in (hole, i], so that lookups still find it
+    const size_t mask = slots.size() - 1;
+    size_t hole = entry - slots.data();
+    for (size_t i = (hole + 1) & mask; slots[i].line != InvalidLine;
+         i = (i + 1) & mask) {
+        const size_t h = home(slots[i].line);
+        const bool stays = hole <= i ? (hole < h && h <= i) :
+            (hole < h || h <= i);
+        if (!stays) {
+            slots[hole] = std::move(slots[i]);
+            hole = i;
+        }
+    }
+    slots[hole] = Entry();
+    --count;
+}
 
 void
-SnoopFilter::eraseIfNullEntry(SnoopFilterCache::iterator& sf_it)
+SnoopFilter::FlatTable::grow()
 {
-    SnoopItem& sf_item = sf_it->second;
+    std::vector<Entry> old(slots.size() * 2);
+    old.swap(slots);
+
+    const size_t mask = slots.size() - 1;
+    for (auto &entry : old) {
+        if (entry.line == InvalidLine)
+            continue;
+        size_t i = home(entry.line);
+        while (slots[i].line != InvalidLine)
+            i = (i + 1) & mask;
+        slots[i] = std::move(entry);
+    }
+}
+
+SnoopFilter::SnoopFilter(const SnoopFilterParams &p)
+    : SimObject(p),
+      linesize(p.system->cacheLineSize()), lookupLatency(p.lookup_latency),
+      maxEntryCount(p.max_capacity / p.system->cacheLineSize()),
+      assoc(p.assoc), numSets(p.assoc ? maxEntryCount / p.assoc : 0),
+      ways(numSets * assoc), touchCount(0),
+      stats(this)
+{
+    fatal_if(assoc && (numSets == 0 || !isPowerOf2(numSets)),
+             "%s: a capacity of %d lines and associativity of %d does not "
+             "give a power of two number of sets\n", name(), maxEntryCount,
+             assoc);
+}
+
+SnoopFilter::Entry *
+SnoopFilter::findEntry(Addr line)
+{
+    if (assoc) {
+        const size_t set = (line / linesize) & (numSets - 1);
+        for (size_t w = set * assoc; w < (set + 1) * assoc; ++w) {
+            if (ways[w].line == line) {
+                ways[w].lastTouch = ++touchCount;
+                return &ways[w];
+            }
+        }
+        // the overflow table is empty in the common case
+        if (table.empty())
+            return nullptr;
+    }
+    return table.find(line);
+}
+
+SnoopFilter::Entry *
+SnoopFilter::allocateEntry(Addr line)
+{
+    if (assoc) {
+        const size_t set = (line / linesize) & (numSets - 1);
+        Entry *victim = nullptr;
+        for (size_t w = set * assoc; w < (set + 1) * assoc; ++w) {
+            Entry &entry = ways[w];
+            if (entry.line == InvalidLine) {
+                victim = &entry;
+                break;
+            }
+            // never drop a line with requests in flight, as their
+            // responses rely on the entry being there
+            if (entry.item.requested.none() &&
+                (!victim || entry.lastTouch < victim->lastTouch)) {
+                victim = &entry;
+            }
+        }
+
+        if (victim) {
+            if (victim->line != InvalidLine) {
+                DPRINTF(SnoopFilter, "%s: evicting %#x SF value %x.%x\n",
+                        __func__, victim->line, victim->item.requested,
+                        victim->item.holder);
+                stats.evictions++;
+                if (victim->item.holder.any()) {
+                    stats.backInvalidations++;
+                    pendingBackInvalidations.push_back(BackInvalidation{
+                        victim->line & ~Addr(linesize - 1),
+                        (victim->line & LineSecure) != 0,
+                        maskToPortList(victim->item.holder)});
+                }
+            }
+            *victim = Entry();
+            victim->line = line;
+            victim->lastTouch = ++touchCount;
+            return victim;
+        }
+
+        DPRINTF(SnoopFilter, "%s: no victim for %#x, overflowing set\n",
+                __func__, line);
+        stats.overflows++;
+    }
+    return table.insert(line);
+}
+
+void
+SnoopFilter::eraseIfNullEntry(Entry *entry)
+{
+    SnoopItem& sf_item = entry->item;
     if ((sf_item.requested | sf_item.holder).none()) {
-        cachedLocations.erase(sf_it);
+        if (table.owns(entry))
+            table.erase(entry);
+        else
+            *entry = Entry();
         DPRINTF(SnoopFilter, "%s:   Removed SF entry.\n",
                 __func__);
     }
@@ -78,22 +259,32 @@ SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
         line_addr |= LineSecure;
     }
     SnoopMask req_port = portToMask(cpu_side_port);
-    reqLookupResult.it = cachedLocations.find(line_addr);
-    bool is_hit = (reqLookupResult.it != cachedLocations.end());
+    Entry *sf_entry = findEntry(line_addr);
+    bool is_hit = sf_entry != nullptr;
+
+    // A bounded filter may have evicted (and back-invalidated) the
+    // line while an eviction for it was on its way, so there is no
+    // point tracking it again.
+    if (!is_hit && assoc && cpkt->isEviction())
+        allocate = false;
 
     // If the snoop filter has no entry, and we should not allocate,
     // do not create a new snoop filter entry, simply return a NULL
     // portlist.
-    if (!is_hit && !allocate)
+    if (!is_hit && !allocate) {
+        reqLookupResult.line = InvalidLine;
         return snoopDown(lookupLatency);
+    }
 
-    // If no hit in snoop filter create a new element and update iterator
+    // If no hit in snoop filter create a new element
     if (!is_hit) {
-        reqLookupResult.it =
-            cachedLocations.emplace(line_addr, SnoopItem()).first;
+        sf_entry = allocateEntry(line_addr);
     }
-    SnoopItem& sf_item = reqLookupResult.it->second;
+    reqLookupResult.line = line_addr;
+    SnoopItem& sf_item = sf_entry->item;
     SnoopMask interested = sf_item.holder | sf_item.requested;
+    SnoopMask others = interested;
+    others.reset(req_port);
 
     // Store unmodified value of snoop filter item in temp storage in
     // case we need to revert because of a send retry in
@@ -113,8 +304,7 @@ SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
 
     // If we are not allocating, we are done
     if (!allocate)
-        return snoopSelected(maskToPortList(interested & ~req_port),
-                             lookupLatency);
+        return snoopSelected(maskToPortList(others), lookupLatency);
 
     if (cpkt->needsResponse()) {
         if (!cpkt->cacheResponding()) {
@@ -140,44 +330,53 @@ SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
         }
     } else { // if (!cpkt->needsResponse())
         assert(cpkt->isEviction());
-        // make sure that the sender actually had the line
-        panic_if((sf_item.holder & req_port).none(), "requestor %x is not a " \
-                 "holder :( SF value %x.%x\n", req_port,
-                 sf_item.requested, sf_item.holder);
+        // make sure that the sender actually had the line, unless a
+        // bounded filter back-invalidated it and the line was since
+        // allocated again by someone else
+        panic_if(!assoc && (sf_item.holder & req_port).none(),
+                 "requestor %x is not a holder :( SF value %x.%x\n",
+                 req_port, sf_item.requested, sf_item.holder);
         // CleanEvicts and Writebacks -> the sender and all caches above
         // it may not have the line anymore.
         if (!cpkt->isBlockCached()) {
-            sf_item.holder &= ~req_port;
+            sf_item.holder.reset(req_port);
             DPRINTF(SnoopFilter, "%s:   new SF value %x.%x\n",
                     __func__,  sf_item.requested, sf_item.holder);
         }
     }
 
-    return snoopSelected(maskToPortList(interested & ~req_port), lookupLatency);
+    return snoopSelected(maskToPortList(others), lookupLatency);
 }
 
 void
 SnoopFilter::finishRequest(bool will_retry, Addr addr, bool is_secure)
 {
-    if (reqLookupResult.it != cachedLocations.end()) {
-        // since we rely on the caller, do a basic check to ensure
-        // that finishRequest is being called following lookupRequest
-        assert(reqLookupResult.it->first == \
-                (is_secure ? ((addr & ~(Addr(linesize - 1))) | LineSecure) : \
-                 (addr & ~(Addr(linesize - 1)))));
-        if (will_retry) {
-            SnoopItem retry_item = reqLookupResult.retryItem;
-            // Undo any changes made in lookupRequest to the snoop filter
-            // entry if the request will come again. retryItem holds
-            // the previous value of the snoopfilter entry.
-            reqLookupResult.it->second = retry_item;
-
-            DPRINTF(SnoopFilter, "%s:   restored SF value %x.%x\n",
-                    __func__,  retry_item.requested, retry_item.holder);
-        }
+    if (reqLookupResult.line == InvalidLine)
+        return;
+
+    // since we rely on the caller, do a basic check to ensure
+    // that finishRequest is being called following lookupRequest
+    assert(reqLookupResult.line == \
+            (is_secure ? ((addr & ~(Addr(linesize - 1))) | LineSecure) : \
+             (addr & ~(Addr(linesize - 1)))));
 
-        eraseIfNullEntry(reqLookupResult.it);
+    Entry *sf_entry = findEntry(reqLookupResult.line);
+    reqLookupResult.line = InvalidLine;
+    if (!sf_entry)
+        return;
+
+    if (will_retry) {
+        SnoopItem retry_item = reqLookupResult.retryItem;
+        // Undo any changes made in lookupRequest to the snoop filter
+        // entry if the request will come again. retryItem holds
+        // the previous value of the snoopfilter entry.
+        sf_entry->item = retry_item;
+
+        DPRINTF(SnoopFilter, "%s:   restored SF value %x.%x\n",
+                __func__,  retry_item.requested, retry_item.holder);
     }
+
+    eraseIfNullEntry(sf_entry);
 }
 
 std::pair<SnoopFilter::SnoopList, Cycles>
@@ -191,10 +390,10 @@ SnoopFilter::lookupSnoop(const Packet* cpkt)
     if (cpkt->isSecure()) {
         line_addr |= LineSecure;
     }
-    auto sf_it = cachedLocations.find(line_addr);
-    bool is_hit = (sf_it != cachedLocations.end());
+    Entry *sf_entry = findEntry(line_addr);
+    bool is_hit = sf_entry != nullptr;
 
-    panic_if(!is_hit && (cachedLocations.size() >= maxEntryCount),
+    panic_if(!assoc && !is_hit && (table.size() >= maxEntryCount),
              "snoop filter exceeded capacity of %d cache blocks\n",
              maxEntryCount);
 
@@ -204,7 +403,7 @@ SnoopFilter::lookupSnoop(const Packet* cpkt)
     if (!is_hit)
         return snoopDown(lookupLatency);
 
-    SnoopItem& sf_item = sf_it->second;
+    SnoopItem& sf_item = sf_entry->item;
 
     SnoopMask interested = (sf_item.holder | sf_item.requested);
 
@@ -231,10 +430,10 @@ SnoopFilter::lookupSnoop(const Packet* cpkt)
         // upward snoops
         DPRINTF(SnoopFilter, "%s:   old SF value %x.%x\n",
                 __func__, sf_item.requested, sf_item.holder);
-        sf_item.holder = 0;
+        sf_item.holder.reset();
         DPRINTF(SnoopFilter, "%s:   new SF value %x.%x\n",
                 __func__, sf_item.requested, sf_item.holder);
-        eraseIfNullEntry(sf_it);
+        eraseIfNullEntry(sf_entry);
     }
 
     return snoopSelected(maskToPortList(interested), lookupLatency);
@@ -264,7 +463,10 @@ SnoopFilter::updateSnoopResponse(const Packet* cpkt,
     }
     SnoopMask rsp_mask = portToMask(rsp_port);
     SnoopMask req_mask = portToMask(req_port);
-    SnoopItem& sf_item = cachedLocations[line_addr];
+    Entry *sf_entry = findEntry(line_addr);
+    if (!sf_entry)
+        sf_entry = allocateEntry(line_addr);
+    SnoopItem& sf_item = sf_entry->item;
 
     DPRINTF(SnoopFilter, "%s:   old SF value %x.%x\n",
             __func__,  sf_item.requested, sf_item.holder);
@@ -286,12 +488,12 @@ SnoopFilter::updateSnoopResponse(const Packet* cpkt,
                 "%s: dropping %x because non-shared snoop "
                 "response SF val: %x.%x\n", __func__,  rsp_mask,
                 sf_item.requested, sf_item.holder);
-        sf_item.holder = 0;
+        sf_item.holder.reset();
     }
     assert(!cpkt->isWriteback());
     // @todo Deal with invalidating responses
     sf_item.holder |=  req_mask;
-    sf_item.requested &= ~req_mask;
+    sf_item.requested.reset(req_mask);
     assert((sf_item.requested | sf_item.holder).any());
     DPRINTF(SnoopFilter, "%s:   new SF value %x.%x\n",
             __func__, sf_item.requested, sf_item.holder);
@@ -311,26 +513,25 @@ SnoopFilter::updateSnoopForward(const Packet* cpkt,
     if (cpkt->isSecure()) {
         line_addr |= LineSecure;
     }
-    auto sf_it = cachedLocations.find(line_addr);
-    bool is_hit = sf_it != cachedLocations.end();
+    Entry *sf_entry = findEntry(line_addr);
 
     // Nothing to do if it is not a hit
-    if (!is_hit)
+    if (!sf_entry)
         return;
 
     // If the snoop response has no sharers the line is passed in
     // Modified state, and we know that there are no other copies, or
     // they will all be invalidated imminently
     if (!cpkt->hasSharers()) {
-        SnoopItem& sf_item = sf_it->second;
+        SnoopItem& sf_item = sf_entry->item;
 
         DPRINTF(SnoopFilter, "%s:   old SF value %x.%x\n",
                 __func__, sf_item.requested, sf_item.holder);
-        sf_item.holder = 0;
+        sf_item.holder.reset();
         DPRINTF(SnoopFilter, "%s:   new SF value %x.%x\n",
                 __func__, sf_item.requested, sf_item.holder);
 
-        eraseIfNullEntry(sf_it);
+        eraseIfNullEntry(sf_entry);
     }
 }
 
@@ -353,12 +554,12 @@ SnoopFilter::updateResponse(const Packet* cpkt, const ResponsePort&
     if (cpkt->isSecure()) {
         line_addr |= LineSecure;
     }
-    auto sf_it = cachedLocations.find(line_addr);
-    if (sf_it == cachedLocations.end())
+    Entry *sf_entry = findEntry(line_addr);
+    if (!sf_entry)
         return;
 
     SnoopMask response_mask = portToMask(cpu_side_port);
-    SnoopItem& sf_item = sf_it->second;
+    SnoopItem& sf_item = sf_entry->item;
 
     DPRINTF(SnoopFilter, "%s:   old SF value %x.%x\n",
             __func__,  sf_item.requested, sf_item.holder);
@@ -368,16 +569,16 @@ SnoopFilter::updateResponse(const Packet* cpkt, const ResponsePort&
              "SF value %x.%x missing request bit\n",
              sf_item.requested, sf_item.holder);
 
-    sf_item.requested &= ~response_mask;
+    sf_item.requested.reset(response_mask);
     // Update the residency of the cache line.
 
     if (cpkt->req->isCacheMaintenance()) {
         // A cache clean response does not carry any data so it
         // shouldn't change the holders, unless it is invalidating.
         if (cpkt->isInvalidate()) {
-            sf_item.holder &= ~response_mask;
+            sf_item.holder.reset(response_mask);
         }
-        eraseIfNullEntry(sf_it);
+        eraseIfNullEntry(sf_entry);
     } else {
         // Any other response implies that a cache above will have the
         // block.
@@ -405,7 +606,16 @@ SnoopFilter::SnoopFilterStats::SnoopFilterStats(statistics::Group *parent)
                "holder of the requested data."),
       ADD_STAT(hitMultiSnoops, statistics::units::Count::get(),
                "Number of snoops hitting in the snoop filter with multiple "
-               "(>1) holders of the requested data.")
+               "(>1) holders of the requested data."),
+      ADD_STAT(evictions, statistics::units::Count::get(),
+               "Number of lines evicted from a capacity-limited snoop "
+               "filter."),
+      ADD_STAT(backInvalidations, statistics::units::Count::get(),
+               "Number of evicted lines that had to be invalidated in the "
+               "caches above."),
+      ADD_STAT(overflows, statistics::units::Count::get(),
+               "Number of allocations that found every way of their set "
+               "with requests in flight.")
 {}
 
 void
@@ -43,10 +43,14 @@
 #ifndef __MEM_SNOOP_FILTER_HH__
 #define __MEM_SNOOP_FILTER_HH__
 
-#include <bitset>
-#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+#include <ostream>
 #include <utility>
+#include <vector>
 
+#include "base/bitfield.hh"
+#include "base/types.hh"
 #include "mem/packet.hh"
 #include "mem/port.hh"
 #include "mem/qport.hh"
@@ -76,6 +80,13 @@ namespace gem5
  * | holder) should be notified and the requesting MSHRs will take
  * care of ordering.
  *
+ * By default the filter is unbounded and only sanity checks its
+ * capacity. With a non-zero associativity it instead models a
+ * set-associative structure of the configured capacity: allocating
+ * into a full set evicts the least recently used entry without
+ * outstanding requests, and the holders of the evicted line are
+ * back-invalidated by the crossbar (see takeBackInvalidations).
+ *
  * Overall, some trickery is required because:
  * (1) snoops are not followed by an ACK, but only evoke a response if
  *     they need to (hit dirty)
@@ -90,18 +101,20 @@ class SnoopFilter : public SimObject
 {
   public:
 
-    // Change for systems with more than 256 ports tracked by this object
-    static const int SNOOP_MASK_SIZE = 256;
-
     typedef std::vector<QueuedResponsePort*> SnoopList;
 
-    SnoopFilter (const SnoopFilterParams &p) :
-        SimObject(p), reqLookupResult(cachedLocations.end()),
-        linesize(p.system->cacheLineSize()), lookupLatency(p.lookup_latency),
-        maxEntryCount(p.max_capacity / p.system->cacheLineSize()),
-        stats(this)
+    /**
+     * A line evicted from a capacity-limited filter, together with the
+     * ports that still hold it and have to be invalidated.
+     */
+    struct BackInvalidation
     {
-    }
+        Addr addr;
+        bool isSecure;
+        SnoopList holders;
+    };
+
+    SnoopFilter(const SnoopFilterParams &p);
 
     /**
      * Init a new snoop filter and tell it about all the cpu_sideports
@@ -120,11 +133,6 @@ class SnoopFilter : public SimObject
                 localResponsePortIds[p->getId()] = id++;
             }
         }
-
-        // make sure we can deal with this many ports
-        fatal_if(id > SNOOP_MASK_SIZE,
-                 "Snoop filter only supports %d snooping ports, got %d\n",
-                 SNOOP_MASK_SIZE, id);
     }
 
     /**
@@ -200,15 +208,173 @@ class SnoopFilter : public SimObject
      */
     void updateResponse(const Packet *cpkt, const ResponsePort& cpu_side_port);
 
+    /**
+     * Hand over the lines evicted since the last call. The filter no
+     * longer tracks them, so the caller is responsible for
+     * invalidating the copies held by the listed ports. The crossbar
+     * collects these once a request is done with the filter, as the
+     * invalidations may cause writebacks that re-enter it.
+     *
+     * @return The evicted lines and their holders.
+     */
+    std::vector<BackInvalidation>
+    takeBackInvalidations()
+    {
+        std::vector<BackInvalidation> res;
+        res.swap(pendingBackInvalidations);
+        return res;
+    }
+
+    /** Are there evicted lines waiting to be back-invalidated? */
+    bool
+    hasBackInvalidations() const
+    {
+        return !pendingBackInvalidations.empty();
+    }
+
     virtual void regStats();
 
   protected:
 
     /**
-     * The underlying type for the bitmask we use for tracking. This
-     * limits the number of snooping ports supported per crossbar.
+     * The underlying type for the bitmask we use for tracking. The
+     * first 64 ports are kept in a single word, and only crossbars
+     * with more snooping ports than that pay for the extra words, so
+     * there is no upper limit on the number of ports tracked.
      */
-    typedef std::bitset<SNOOP_MASK_SIZE> SnoopMask;
+    class SnoopMask
+    {
+      public:
+        SnoopMask() = default;
+
+        /** Create a one-hot mask with the given bit set. */
+        static SnoopMask
+        bit(unsigned idx)
+        {
+            SnoopMask mask;
+            mask.set(idx);
+            return mask;
+        }
+
+        void
+        set(unsigned idx)
+        {
+            if (idx < 64) {
+                low |= 1ULL << idx;
+                return;
+            }
+            const unsigned w = idx / 64 - 1;
+            if (high.size() <= w)
+                high.resize(w + 1, 0);
+            high[w] |= 1ULL << (idx % 64);
+        }
+
+        /** Clear all bits. */
+        void
+        reset()
+        {
+            low = 0;
+            high.clear();
+        }
+
+        /** Clear the bits that are set in other. */
+        void
+        reset(const SnoopMask &other)
+        {
+            low &= ~other.low;
+            for (size_t w = 0; w < std::min(high.size(), other.high.size());
+                 ++w) {
+                high[w] &= ~other.high[w];
+            }
+        }
+
+        bool
+        any() const
+        {
+            if (low)
+                return true;
+            for (auto w : high) {
+                if (w)
+                    return true;
+            }
+            return false;
+        }
+
+        bool none() const { return !any(); }
+
+        unsigned
+        count() const
+        {
+            unsigned c = popCount(low);
+            for (auto w : high)
+                c += popCount(w);
+            return c;
+        }
+
+        SnoopMask &
+        operator|=(const SnoopMask &other)
+        {
+            low |= other.low;
+            if (high.size() < other.high.size())
+                high.resize(other.high.size(), 0);
+            for (size_t w = 0; w < other.high.size(); ++w)
+                high[w] |= other.high[w];
+            return *this;
+        }
+
+        SnoopMask &
+        operator&=(const SnoopMask &other)
+        {
+            low &= other.low;
+            if (high.size() > other.high.size())
+                high.resize(other.high.size());
+            for (size_t w = 0; w < high.size(); ++w)
+                high[w] &= other.high[w];
+            return *this;
+        }
+
+        friend SnoopMask
+        operator|(SnoopMask a, const SnoopMask &b)
+        {
+            return a |= b;
+        }
+
+        friend SnoopMask
+        operator&(SnoopMask a, const SnoopMask &b)
+        {
+            return a &= b;
+        }
+
+        /** Call f with the index of every bit set, in ascending order. */
+        template <typename F>
+        void
+        forEachSet(F f) const
+        {
+            for (size_t w = 0; w <= high.size(); ++w) {
+                uint64_t bits = w ? high[w - 1] : low;
+                while (bits) {
+                    f(w * 64 + ctz64(bits));
+                    bits &= bits - 1;
+                }
+            }
+        }
+
+        /** Print the mask as a single hex number. */
+        void print(std::ostream &os) const;
+
+        friend std::ostream &
+        operator<<(std::ostream &os, const SnoopMask &mask)
+        {
+            mask.print(os);
+            return os;
+        }
+
+      private:
+        /** Ports 0 to 63. */
+        uint64_t low = 0;
+        /** Ports 64 and above, 64 per word. */
+        std::vector<uint64_t> high;
+    };
 
     /**
     * Per cache line item tracking a bitmask of ResponsePorts who have an
@@ -220,10 +386,74 @@ class SnoopFilter : public SimObject
         SnoopMask requested;
         SnoopMask holder;
     };
+
+    /** Marks an unused entry, never a valid (aligned) line address. */
+    static constexpr Addr InvalidLine = MaxAddr;
+
     /**
-     * HashMap of SnoopItems indexed by line address
+     * A SnoopItem together with the line address (and status bits)
+     * it tracks.
      */
-    typedef std::unordered_map<Addr, SnoopItem> SnoopFilterCache;
+    struct Entry
+    {
+        Addr line = InvalidLine;
+        /** Last access, used for LRU replacement in a bounded filter. */
+        uint64_t lastTouch = 0;
+        SnoopItem item;
+    };
+
+    /**
+     * Open-addressed hash table of entries using linear probing. All
+     * entries live in one contiguous array, and erasing shifts the
+     * following entries of the probe sequence back rather than
+     * leaving tombstones behind. Entries move on insertion and
+     * erasure, so pointers to them are only valid until the next
+     * change to the table.
+     */
+    class FlatTable
+    {
+      public:
+        FlatTable();
+
+        /** Find the entry of a line, nullptr if there is none. */
+        Entry *find(Addr line);
+
+        /** Insert an empty entry for a line that is not in the table. */
+        Entry *insert(Addr line);
+
+        /** Erase an entry previously returned by find or insert. */
+        void erase(Entry *entry);
+
+        /** Is this entry stored in the table? */
+        bool
+        owns(const Entry *entry) const
+        {
+            return entry >= slots.data() &&
+                entry < slots.data() + slots.size();
+        }
+
+        size_t size() const { return count; }
+        bool empty() const { return count == 0; }
+
+      private:
+        /** Initial number of slots, must be a power of two. */
+        static constexpr size_t InitialSlots = 1024;
+
+        size_t
+        home(Addr line) const
+        {
+            // fold the upper bits in, as the low bits of a line
+            // address carry little information
+            uint64_t h = line * 0x9e3779b97f4a7c15ULL;
+            return (h ^ (h >> 32)) & (slots.size() - 1);
+        }
+
+        /** Double the number of slots and re-insert all entries. */
+        void grow();
+
+        std::vector<Entry> slots;
+        size_t count;
+    };
 
     /**
      * Simple factory methods for standard return values.
@@ -254,17 +484,61 @@ class SnoopFilter : public SimObject
      * @param ports SnoopMask of the requested ports
      * @return SnoopList containing all the requested ResponsePorts
      */
-    SnoopList maskToPortList(SnoopMask ports) const;
+    SnoopList maskToPortList(const SnoopMask &ports) const;
 
   private:
 
+    /**
+     * Find the entry tracking a line, and mark it as recently used.
+     *
+     * @param line Line address including the status bits.
+     * @return The entry, or nullptr if the line is not tracked.
+     */
+    Entry *findEntry(Addr line);
+
+    /**
+     * Allocate an empty entry for a line that is not tracked. In a
+     * bounded filter this may evict another line, which is queued for
+     * back-invalidation.
+     *
+     * @param line Line address including the status bits.
+     * @return The new entry.
+     */
+    Entry *allocateEntry(Addr line);
+
     /**
      * Removes snoop filter items which have no requestors and no holders.
      */
-    void eraseIfNullEntry(SnoopFilterCache::iterator& sf_it);
+    void eraseIfNullEntry(Entry *entry);
 
-    /** Simple hash set of cached addresses. */
-    SnoopFilterCache cachedLocations;
+    /** Cache line size. */
+    const Addr linesize;
+    /** Latency for doing a lookup in the filter */
+    const Cycles lookupLatency;
+    /**
+     * Max capacity in terms of cache blocks tracked, for sanity
+     * checking in an unbounded filter, or the number of entries of a
+     * bounded one.
+     */
+    const unsigned maxEntryCount;
+    /** Associativity of a bounded filter, 0 if unbounded. */
+    const unsigned assoc;
+    /** Number of sets of a bounded filter. */
+    const unsigned numSets;
+
+    /** The ways of a bounded filter, stored set after set. */
+    std::vector<Entry> ways;
+    /**
+     * All entries of an unbounded filter. In a bounded filter this
+     * only holds the lines for which every way of their set had
+     * outstanding requests, so that no in-flight line is dropped.
+     */
+    FlatTable table;
+    /** Access counter providing the LRU timestamps. */
+    uint64_t touchCount;
+
+    /** Evicted lines waiting to be handed to the crossbar. */
+    std::vector<BackInvalidation> pendingBackInvalidations;
 
     /**
      * A request lookup must be followed by a call to finishRequest to inform
@@ -274,8 +548,12 @@ class SnoopFilter : public SimObject
      */
     struct ReqLookupResult
     {
-        /** Iterator used to store the result from lookupRequest. */
-        SnoopFilterCache::iterator it;
+        /**
+         * Line looked up by lookupRequest, or InvalidLine if it has
+         * no entry. The entry itself is looked up again as it may
+         * have moved in the meantime.
+         */
+        Addr line = InvalidLine;
 
         /**
          * Variable to temporarily store value of snoopfilter entry
@@ -283,30 +561,12 @@ class SnoopFilter : public SimObject
          * (because of crossbar retry)
          */
         SnoopItem retryItem;
-
-        /**
-         * The constructor must be informed of the internal cache's end
-         * iterator, so do not allow the compiler to implictly define it.
-         *
-         * @param end_it Iterator to the end of the internal cache.
-         */
-        ReqLookupResult(SnoopFilterCache::iterator end_it)
-            : it(end_it), retryItem{0, 0}
-        {
-        }
-        ReqLookupResult() = delete;
     } reqLookupResult;
 
     /** List of all attached snooping CPU-side ports. */
     SnoopList cpuSidePorts;
     /** Track the mapping from port ids to the local mask ids. */
     std::vector<PortID> localResponsePortIds;
-    /** Cache line size. */
-    const Addr linesize;
-    /** Latency for doing a lookup in the filter */
-    const Cycles lookupLatency;
-    /** Max capacity in terms of cache blocks tracked, for sanity checking */
-    const unsigned maxEntryCount;
 
     /**
      * Use the lower bits of the address to keep track of the line status
@@ -329,6 +589,10 @@ class SnoopFilter : public SimObject
         statistics::Scalar totSnoops;
         statistics::Scalar hitSingleSnoops;
         statistics::Scalar hitMultiSnoops;
+
+        statistics::Scalar evictions;
+        statistics::Scalar backInvalidations;
+        statistics::Scalar overflows;
     } stats;
 };
 
@@ -337,17 +601,18 @@ SnoopFilter::portToMask(const ResponsePort& port) const
 {
     assert(port.getId() != InvalidPortID);
     // if this is not a snooping port, return a zero mask
-    return !port.isSnooping() ? 0 :
-        ((SnoopMask)1) << localResponsePortIds[port.getId()];
+    return !port.isSnooping() ? SnoopMask() :
+        SnoopMask::bit(localResponsePortIds[port.getId()]);
 }
 
 inline SnoopFilter::SnoopList
-SnoopFilter::maskToPortList(SnoopMask port_mask) const
+SnoopFilter::maskToPortList(const SnoopMask &port_mask) const
 {
+    // the local mask ids follow the order of cpuSidePorts
     SnoopList res;
-    for (const auto& p : cpuSidePorts)
-        if ((port_mask & portToMask(*p)).any())
-            res.push_back(p);
+    port_mask.forEachSet([&](unsigned idx) {
+        res.push_back(cpuSidePorts[idx]);
+    });
     return res;
 }
 
@@ -0,0 +1,390 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/tiered_memory_manager.hh"
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "base/intmath.hh"
+#include "base/trace.hh"
+#include "debug/TieredMemoryManager.hh"
+#include "mem/port_proxy.hh"
+#include "sim/serialize.hh"
+
+namespace gem5
+{
+
+TieredMemoryManager::TieredMemoryManager(const TieredMemoryManagerParams &p)
+    : AddrMapper(p),
+      fastRange(p.fast_range), slowRange(p.slow_range),
+      pageSize(p.page_size), epoch(p.epoch),
+      sampleInterval(p.sample_interval),
+      promotionThreshold(p.promotion_threshold),
+      maxMigrations(p.max_migrations),
+      copyTicksPerByte(p.copy_bandwidth),
+      sinceSample(0), copyFreeAt(0), victimHand(0), retryReq(false),
+      epochEvent([this]{ processEpochEvent(); }, name()),
+      migrationEvent([this]{ processMigrationEvent(); }, name()),
+      stats(*this)
+{
+    fatal_if(!isPowerOf2(pageSize), "%s: page size must be a power of 2\n",
+             name());
+    fatal_if(fastRange.interleaved() || slowRange.interleaved(),
+             "%s: memory tiers must not be interleaved\n", name());
+    fatal_if(fastRange.intersects(slowRange),
+             "%s: memory tiers must not overlap\n", name());
+    fatal_if(fastRange.start() % pageSize || fastRange.size() % pageSize ||
+             slowRange.start() % pageSize || slowRange.size() % pageSize,
+             "%s: memory tiers must be page aligned\n", name());
+    fatal_if(epoch == 0 || sampleInterval == 0,
+             "%s: epoch and sample interval must be non-zero\n", name());
+}
+
+void
+TieredMemoryManager::init()
+{
+    AddrMapper::init();
+    cpuSidePort.sendRangeChange();
+}
+
+void
+TieredMemoryManager::startup()
+{
+    schedule(epochEvent, curTick() + epoch);
+}
+
+DrainState
+TieredMemoryManager::drain()
+{
+    // let the swaps in progress finish, as their pages are held off
+    return migrations.empty() ? DrainState::Drained : DrainState::Draining;
+}
+
+void
+TieredMemoryManager::serialize(CheckpointOut &cp) const
+{
+    std::vector<Addr> pages;
+    std::vector<Addr> frames;
+    for (const auto &[page, frame] : pageFrames) {
+        pages.push_back(page);
+        frames.push_back(frame);
+    }
+
+    SERIALIZE_CONTAINER(pages);
+    SERIALIZE_CONTAINER(frames);
+}
+
+void
+TieredMemoryManager::unserialize(CheckpointIn &cp)
+{
+    std::vector<Addr> pages;
+    std::vector<Addr> frames;
+    UNSERIALIZE_CONTAINER(pages);
+    UNSERIALIZE_CONTAINER(frames);
+
+    fatal_if(pages.size() != frames.size(),
+             "%s: inconsistent page mapping in checkpoint\n", name());
+
+    for (size_t i = 0; i < pages.size(); i++)
+        setFrame(pages[i], frames[i]);
+}
+
+AddrRangeList
+TieredMemoryManager::getAddrRanges() const
+{
+    return AddrRangeList{fastRange, slowRange};
+}
+
+Addr
+TieredMemoryManager::frameOf(Addr page) const
+{
+    auto it = pageFrames.find(page);
+    return it == pageFrames.end() ? page : it->second;
+}
+
+Addr
+TieredMemoryManager::pageIn(Addr frame) const
+{
+    auto it = framePages.find(frame);
+    return it == framePages.end() ? frame : it->second;
+}
+
+void
+TieredMemoryManager::setFrame(Addr page, Addr frame)
+{
+    if (page == frame) {
+        pageFrames.erase(page);
+        framePages.erase(frame);
+    } else {
+        pageFrames[page] = frame;
+        framePages[frame] = page;
+    }
+}
+
+Addr
+TieredMemoryManager::remapAddr(Addr addr) const
+{
+    const Addr page = pageAlign(addr);
+    return frameOf(page) + (addr - page);
+}
+
+void
+TieredMemoryManager::recordAccess(Addr page)
+{
+    if (fastRange.contains(frameOf(page)))
+        stats.fastAccesses++;
+    else
+        stats.slowAccesses++;
+
+    if (++sinceSample == sampleInterval) {
+        sinceSample = 0;
+        pageAccesses[page]++;
+    }
+}
+
+Tick
+TieredMemoryManager::recvAtomic(PacketPtr pkt)
+{
+    recordAccess(pageAlign(pkt->getAddr()));
+    return AddrMapper::recvAtomic(pkt);
+}
+
+Tick
+TieredMemoryManager::recvAtomicBackdoor(PacketPtr pkt,
+                                        MemBackdoorPtr& backdoor)
+{
+    recordAccess(pageAlign(pkt->getAddr()));
+    return AddrMapper::recvAtomicBackdoor(pkt, backdoor);
+}
+
+bool
+TieredMemoryManager::recvTimingReq(PacketPtr pkt)
+{
+    const Addr page = pageAlign(pkt->getAddr());
+
+    if (migratingPages.count(page)) {
+        DPRINTF(TieredMemoryManager, "Holding off %s, page being swapped\n",
+                pkt->print());
+        stats.blockedReqs++;
+        retryReq = true;
+        return false;
+    }
+
+    const bool expects_response =
+        pkt->needsResponse() && !pkt->cacheResponding();
+
+    if (!AddrMapper::recvTimingReq(pkt))
+        return false;
+
+    recordAccess(page);
+    if (expects_response)
+        outstandingReqs[page]++;
+
+    return true;
+}
+
+bool
+TieredMemoryManager::recvTimingResp(PacketPtr pkt)
+{
+    // the page cannot have moved while the request was in flight, and
+    // the packet may be gone once the response is sent
+    const Addr page = pageIn(pageAlign(pkt->getAddr()));
+
+    if (!AddrMapper::recvTimingResp(pkt))
+        return false;
+
+    auto it = outstandingReqs.find(page);
+    assert(it != outstandingReqs.end());
+    if (--it->second == 0) {
+        outstandingReqs.erase(it);
+
+        // a swap may be waiting for the page to be quiet
+        if (!migrations.empty() && migrations.front().copyDone <= curTick()
+            && !migrationEvent.scheduled()) {
+            schedule(migrationEvent, curTick());
+        }
+    }
+
+    return true;
+}
+
+Addr
+TieredMemoryManager::findColdPage(unsigned accesses)
+{
+    const uint64_t num_frames = fastRange.size() / pageSize;
+
+    for (uint64_t i = 0; i < num_frames; i++) {
+        const Addr page = pageIn(fastRange.start() + victimHand * pageSize);
+        victimHand = (victimHand + 1) % num_frames;
+
+        if (migratingPages.count(page))
+            continue;
+
+        auto it = pageAccesses.find(page);
+        if (it == pageAccesses.end() || it->second < accesses)
+            return page;
+    }
+
+    return MaxAddr;
+}
+
+void
+TieredMemoryManager::swapPages(Addr hot, Addr cold)
+{
+    const Addr hot_frame = frameOf(hot);
+    const Addr cold_frame = frameOf(cold);
+
+    DPRINTF(TieredMemoryManager, "Swapping page %#x in frame %#x with "
+            "page %#x in frame %#x\n", hot, hot_frame, cold, cold_frame);
+
+    // exchange the data of the frames
+    PortProxy proxy(memSidePort, pageSize);
+    std::vector<uint8_t> hot_data(pageSize);
+    std::vector<uint8_t> cold_data(pageSize);
+    proxy.readBlob(hot_frame, hot_data.data(), pageSize);
+    proxy.readBlob(cold_frame, cold_data.data(), pageSize);
+    proxy.writeBlob(hot_frame, cold_data.data(), pageSize);
+    proxy.writeBlob(cold_frame, hot_data.data(), pageSize);
+
+    setFrame(hot, cold_frame);
+    setFrame(cold, hot_frame);
+
+    stats.promotions++;
+    stats.demotions++;
+}
+
+void
+TieredMemoryManager::processEpochEvent()
+{
+    if (drainState() == DrainState::Running) {
+        // find the hottest pages of the slow tier
+        std::vector<std::pair<unsigned, Addr>> hot;
+        for (const auto &[page, accesses] : pageAccesses) {
+            if (accesses >= promotionThreshold &&
+                slowRange.contains(frameOf(page)) &&
+                !migratingPages.count(page)) {
+                hot.emplace_back(accesses, page);
+            }
+        }
+
+        const size_t num_hot = std::min<size_t>(hot.size(), maxMigrations);
+        std::partial_sort(hot.begin(), hot.begin() + num_hot, hot.end(),
+                          std::greater<>());
+
+        for (size_t i = 0; i < num_hot; i++) {
+            const auto [accesses, page] = hot[i];
+            const Addr cold = findColdPage(accesses);
+            if (cold == MaxAddr)
+                break;
+
+            // the copy engine reads and writes both pages
+            const Tick start = std::max(curTick(), copyFreeAt);
+            copyFreeAt = start + 2 * pageSize * copyTicksPerByte;
+
+            DPRINTF(TieredMemoryManager, "Promoting page %#x (%d accesses) "
+                    "in place of page %#x, done at %d\n", page, accesses,
+                    cold, copyFreeAt);
+
+            migrations.push_back({page, cold, copyFreeAt});
+            migratingPages.insert(page);
+            migratingPages.insert(cold);
+            stats.copiedBytes += 2 * pageSize;
+        }
+
+        if (!migrations.empty() && !migrationEvent.scheduled()) {
+            schedule(migrationEvent,
+                     std::max(curTick(), migrations.front().copyDone));
+        }
+    }
+
+    // age the access counts, so that pages cool down over time
+    for (auto it = pageAccesses.begin(); it != pageAccesses.end();) {
+        it->second /= 2;
+        it = it->second ? std::next(it) : pageAccesses.erase(it);
+    }
+
+    schedule(epochEvent, curTick() + epoch);
+}
+
+void
+TieredMemoryManager::processMigrationEvent()
+{
+    while (!migrations.empty() && migrations.front().copyDone <= curTick()) {
+        const Migration &migration = migrations.front();
+
+        if (outstandingReqs.count(migration.hot) ||
+            outstandingReqs.count(migration.cold)) {
+            // finish once the requests in flight are done
+            DPRINTF(TieredMemoryManager, "Swap of page %#x waiting for "
+                    "requests in flight\n", migration.hot);
+            return;
+        }
+
+        swapPages(migration.hot, migration.cold);
+        migratingPages.erase(migration.hot);
+        migratingPages.erase(migration.cold);
+        migrations.pop_front();
+    }
+
+    if (!migrations.empty()) {
+        schedule(migrationEvent, migrations.front().copyDone);
+    } else if (drainState() == DrainState::Draining) {
+        signalDrainDone();
+    }
+
+    if (retryReq) {
+        retryReq = false;
+        cpuSidePort.sendRetryReq();
+    }
+}
+
+TieredMemoryManager::TieredMemoryStats::TieredMemoryStats(
+        TieredMemoryManager &manager)
+    : statistics::Group(&manager),
+      ADD_STAT(fastAccesses, statistics::units::Count::get(),
+               "Accesses to pages in the fast tier"),
+      ADD_STAT(slowAccesses, statistics::units::Count::get(),
+               "Accesses to pages in the slow tier"),
+      ADD_STAT(fastHitRatio, statistics::units::Ratio::get(),
+               "Fraction of the accesses served by the fast tier"),
+      ADD_STAT(promotions, statistics::units::Count::get(),
+               "Pages moved to the fast tier"),
+      ADD_STAT(demotions, statistics::units::Count::get(),
+               "Pages moved to the slow tier"),
+      ADD_STAT(copiedBytes, statistics::units::Byte::get(),
+               "Bytes copied between the tiers"),
+      ADD_STAT(blockedReqs, statistics::units::Count::get(),
+               "Requests held off by a swap of their page")
+{
+    fastHitRatio.precision(4);
+    fastHitRatio = fastAccesses / (fastAccesses + slowAccesses);
+}
+
+} // namespace gem5
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_TIERED_MEMORY_MANAGER_HH__
+#define __MEM_TIERED_MEMORY_MANAGER_HH__
+
+#include <deque>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "base/statistics.hh"
+#include "mem/addr_mapper.hh"
+#include "params/TieredMemoryManager.hh"
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+/**
+ * A tiered memory manager sits in front of a fast and a slow memory,
+ * and moves the hot pages of the slow memory to the fast one, as an
+ * operating system would. It counts the (sampled) accesses to each
+ * page, and at the end of every epoch swaps the hottest pages of the
+ * slow tier with cold pages of the fast tier. The pages keep their
+ * addresses on the CPU side, and are remapped to the frames holding
+ * them on the memory side.
+ *
+ * A swap takes the time to copy both pages at the copy bandwidth,
+ * with one swap at a time. Requests to the pages being swapped are
+ * held off until the swap is done, and the swap waits for the requests
+ * in flight to the pages to complete, as the data is exchanged with
+ * functional accesses when the swap is done. Writes are expected to
+ * update the memory when they are accepted, so the manager should
+ * directly face the memory controllers or a crossbar to them.
+ */
+class TieredMemoryManager : public AddrMapper
+{
+  public:
+    TieredMemoryManager(const TieredMemoryManagerParams &p);
+
+    void init() override;
+    void startup() override;
+
+    DrainState drain() override;
+
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
+
+    AddrRangeList getAddrRanges() const override;
+
+  protected:
+    Addr remapAddr(Addr addr) const override;
+
+    /** The mapping changes over time, so there are no backdoors */
+    MemBackdoorPtr
+    getRevertedBackdoor(MemBackdoorPtr &backdoor,
+                        const AddrRange &range) override
+    {
+        return nullptr;
+    }
+
+    void
+    recvRangeChange() override
+    {
+    }
+
+    Tick recvAtomic(PacketPtr pkt) override;
+    Tick recvAtomicBackdoor(PacketPtr pkt,
+                            MemBackdoorPtr& backdoor) override;
+    bool recvTimingReq(PacketPtr pkt) override;
+    bool recvTimingResp(PacketPtr pkt) override;
+
+    /** A swap of a hot slow page with a cold fast page */
+    struct Migration
+    {
+        Addr hot;
+        Addr cold;
+        /** When the copy of both pages is done */
+        Tick copyDone;
+    };
+
+    const AddrRange fastRange;
+    const AddrRange slowRange;
+
+    const Addr pageSize;
+
+    /** Time between migration decisions */
+    const Tick epoch;
+
+    /** Count every n-th access to a page */
+    const unsigned sampleInterval;
+
+    /** Sampled accesses in an epoch to promote a page */
+    const unsigned promotionThreshold;
+
+    /** Maximum promotions per epoch */
+    const unsigned maxMigrations;
+
+    /** Time to copy a byte */
+    const double copyTicksPerByte;
+
+    /** Frames of the pages that are not in their own frame */
+    std::unordered_map<Addr, Addr> pageFrames;
+
+    /** Pages in the frames that do not hold their own page */
+    std::unordered_map<Addr, Addr> framePages;
+
+    /** Sampled accesses per page, halved every epoch */
+    std::unordered_map<Addr, unsigned> pageAccesses;
+
+    /** Accesses since the last sampled one */
+    unsigned sinceSample;
+
+    /** Requests in flight per page, waiting for their response */
+    std::unordered_map<Addr, unsigned> outstandingReqs;
+
+    /** Swaps in the order they are done, and the pages they hold */
+    std::deque<Migration> migrations;
+    std::unordered_set<Addr> migratingPages;
+
+    /** When the copy engine is done with the queued swaps */
+    Tick copyFreeAt;
+
+    /** Frame of the fast tier to look at next for a cold page */
+    uint64_t victimHand;
+
+    /** Did we hold off a request that should be retried */
+    bool retryReq;
+
+    Addr pageAlign(Addr addr) const { return addr & ~(pageSize - 1); }
+
+    /** Frame holding a page, and page held in a frame */
+    Addr frameOf(Addr page) const;
+    Addr pageIn(Addr frame) const;
+
+    /** Map a page to a frame */
+    void setFrame(Addr page, Addr frame);
+
+    /** Count an access to a page */
+    void recordAccess(Addr page);
+
+    /**
+     * Find a page in the fast tier with fewer accesses than a page to
+     * promote, going round the frames of the fast tier.
+     *
+     * @param accesses sampled accesses of the page to promote
+     * @return the page, or MaxAddr if there is none
+     */
+    Addr findColdPage(unsigned accesses);
+
+    /** Swap the frames and the data of two pages */
+    void swapPages(Addr hot, Addr cold);
+
+    /** Decide the migrations at the end of an epoch */
+    void processEpochEvent();
+    EventFunctionWrapper epochEvent;
+
+    /** Finish the swaps whose copies are done, and whose pages have
+        no requests in flight */
+    void processMigrationEvent();
+    EventFunctionWrapper migrationEvent;
+
+    struct TieredMemoryStats : public statistics::Group
+    {
+        TieredMemoryStats(TieredMemoryManager &manager);
+
+        statistics::Scalar fastAccesses;
+        statistics::Scalar slowAccesses;
+        statistics::Formula fastHitRatio;
+
+        /** Pages moved to the fast and to the slow tier */
+        statistics::Scalar promotions;
+        statistics::Scalar demotions;
+
+        /** Bytes copied by the swaps */
+        statistics::Scalar copiedBytes;
+
+        /** Requests held off by a swap of their page */
+        statistics::Scalar blockedReqs;
+    } stats;
+};
+
+} // namespace gem5
+
+#endif //__MEM_TIERED_MEMORY_MANAGER_HH__
@@ -68,6 +68,7 @@ BaseXBar::BaseXBar(const BaseXBarParams &p)
                           p.port_mem_side_ports_connection_count, false),
       gotAllAddrRanges(false), defaultPortID(InvalidPortID),
       useDefaultRange(p.use_default_range),
+      fastPath(p.fast_path),
 
       ADD_STAT(transDist, statistics::units::Count::get(),
                "Transaction distribution"),
@@ -147,7 +148,8 @@ BaseXBar::Layer<SrcType, DstType>::Layer(DstType& _port, BaseXBar& _xbar,
                                        const std::string& _name) :
     statistics::Group(&_xbar, _name.c_str()),
     port(_port), xbar(_xbar), _name(xbar.name() + "." + _name), state(IDLE),
-    waitingForPeer(NULL), releaseEvent([this]{ releaseLayer(); }, name()),
+    busyUntil(0), waitingForPeer(NULL),
+    releaseEvent([this]{ releaseLayer(); }, name()),
     ADD_STAT(occupancy, statistics::units::Tick::get(), "Layer occupancy (ticks)"),
     ADD_STAT(utilization, statistics::units::Ratio::get(), "Layer utilization")
 {
@@ -172,7 +174,12 @@ void BaseXBar::Layer<SrcType, DstType>::occupyLayer(Tick until)
 
     // until should never be 0 as express snoops never occupy the layer
     assert(until != 0);
-    xbar.schedule(releaseEvent, until);
+    busyUntil = until;
+
+    // on the fast path nothing happens on release unless someone is
+    // waiting for the layer, so leave it to the next tryTiming
+    if (!xbar.fastPath || !waitingForLayer.empty())
+        xbar.schedule(releaseEvent, until);
 
     // account for the occupied ticks
     occupancy += until - curTick();
@@ -181,10 +188,25 @@ void BaseXBar::Layer<SrcType, DstType>::occupyLayer(Tick until)
             curTick(), until);
 }
 
+template <typename SrcType, typename DstType>
+void
+BaseXBar::Layer<SrcType, DstType>::scheduleRelease()
+{
+    // while a transfer is being decided on, occupyLayer takes care
+    // of scheduling the release
+    if (xbar.fastPath && state == BUSY && busyUntil != MaxTick &&
+        !releaseEvent.scheduled()) {
+        xbar.schedule(releaseEvent, busyUntil);
+    }
+}
+
 template <typename SrcType, typename DstType>
 bool
 BaseXBar::Layer<SrcType, DstType>::tryTiming(SrcType* src_port)
 {
+    if (xbar.fastPath)
+        lazyRelease();
+
     // if we are in the retry state, we will not see anything but the
     // retrying port (or in the case of the snoop ports the snoop
     // response port that mirrors the actual CPU-side port) as we leave
@@ -204,10 +226,12 @@ BaseXBar::Layer<SrcType, DstType>::tryTiming(SrcType* src_port)
         // that transaction to go through, and then the layer to free
         // up)
         waitingForLayer.push_back(src_port);
+        scheduleRelease();
         return false;
     }
 
     state = BUSY;
+    busyUntil = MaxTick;
 
     return true;
 }
@@ -321,12 +345,16 @@ BaseXBar::Layer<SrcType, DstType>::recvRetry()
     // we are no longer waiting for the peer
     waitingForPeer = NULL;
 
+    if (xbar.fastPath)
+        lazyRelease();
+
     // if the layer is idle, retry this port straight away, if we
     // are busy, then simply let the port wait for its turn
     if (state == IDLE) {
         retryWaiting();
     } else {
         assert(state == BUSY);
+        scheduleRelease();
     }
 }
 
@@ -337,10 +365,10 @@ BaseXBar::findPort(AddrRange addr_range, PacketPtr pkt)
     // ranges of all connected CPU-side-port modules
     assert(gotAllAddrRanges);
 
-    // Check the address map interval tree
-    auto i = portMap.contains(addr_range);
-    if (i != portMap.end()) {
-        return i->second;
+    // Check the address decoder built from the address map
+    const PortID *port_id = portDecoder.find(addr_range);
+    if (port_id) {
+        return *port_id;
     }
 
     // Check if this matches the default range
@@ -447,6 +475,11 @@ BaseXBar::recvRangeChange(PortID mem_side_port_id)
     // modules, go ahead and tell our connected memory-side-port modules in
     // turn, this effectively assumes a tree structure of the system
     if (gotAllAddrRanges) {
+        // nothing is routed before every port has reported its ranges,
+        // so only build the decoder once the map is complete, rather
+        // than for each port at startup
+        portDecoder.build(portMap);
+
         DPRINTF(AddrRanges, "Aggregating address ranges\n");
         xbarRanges.clear();
 
@@ -600,8 +633,12 @@ BaseXBar::Layer<SrcType, DstType>::drain()
     //We should check that we're not "doing" anything, and that noone is
     //waiting. We might be idle but have someone waiting if the device we
     //contacted for a retry didn't actually retry.
+    if (xbar.fastPath)
+        lazyRelease();
     if (state != IDLE) {
         DPRINTF(Drain, "Crossbar not drained\n");
+        // the release event signals the drain being done
+        scheduleRelease();
         return DrainState::Draining;
     } else {
         return DrainState::Drained;
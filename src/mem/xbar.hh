@@ -49,8 +49,10 @@
 #include <deque>
 #include <unordered_map>
 
+#include "base/addr_range_decoder.hh"
 #include "base/addr_range_map.hh"
 #include "base/types.hh"
+#include "mem/packet.hh"
 #include "mem/qport.hh"
 #include "params/BaseXBar.hh"
 #include "sim/clocked_object.hh"
@@ -149,6 +151,13 @@ class BaseXBar : public ClockedObject
          */
         void failedTiming(SrcType* src_port, Tick busy_time);
 
+        /**
+         * Occupy the layer until the given tick. With the fast path
+         * the layer is released lazily by the next tryTiming and the
+         * release event is only scheduled if some port is waiting.
+         *
+         * @param until Tick at which the layer becomes free
+         */
         void occupyLayer(Tick until);
 
         /**
@@ -204,6 +213,31 @@ class BaseXBar : public ClockedObject
 
         State state;
 
+        /**
+         * Tick until which the busy layer is occupied, or MaxTick
+         * while a transfer is being decided on.
+         */
+        Tick busyUntil;
+
+        /**
+         * For the fast path, go back to idle if the layer is busy
+         * but its occupancy has expired without a release event.
+         */
+        void
+        lazyRelease()
+        {
+            if (state == BUSY && busyUntil <= curTick() &&
+                !releaseEvent.scheduled()) {
+                state = IDLE;
+            }
+        }
+
+        /**
+         * For the fast path, make sure the release event is scheduled
+         * once there is someone to retry or drain.
+         */
+        void scheduleRelease();
+
         /**
          * A deque of ports that retry should be called on because
          * the original send was delayed due to a busy layer.
@@ -318,6 +352,13 @@ class BaseXBar : public ClockedObject
 
     AddrRangeMap<PortID, 3> portMap;
 
+    /**
+     * Flat decoder built from portMap once all ports have reported
+     * their ranges, and again whenever it changes after that, used to
+     * route packets without walking the map.
+     */
+    AddrRangeDecoder<PortID> portDecoder;
+
     /**
      * Remember where request packets came from so that we can route
      * responses to the appropriate port. This relies on the fact that
@@ -326,6 +367,18 @@ class BaseXBar : public ClockedObject
      */
     std::unordered_map<RequestPtr, PortID> routeTo;
 
+    /**
+     * Sender state used by the fast path to remember the CPU-side
+     * port a request came from, so the response finds its way back
+     * without a lookup in routeTo.
+     */
+    struct RouteState : public Packet::SenderState
+    {
+        const PortID port;
+
+        RouteState(PortID _port) : port(_port) {}
+    };
+
     /** all contigous ranges seen by this crossbar */
     AddrRangeList xbarRanges;
 
@@ -395,6 +448,12 @@ class BaseXBar : public ClockedObject
        addresses not handled by another port to default device. */
     const bool useDefaultRange;
 
+    /**
+     * Use lazily released layers and keep the route of normal
+     * requests in the packet (see RouteState) rather than in routeTo.
+     */
+    const bool fastPath;
+
     BaseXBar(const BaseXBarParams &p);
 
     /**
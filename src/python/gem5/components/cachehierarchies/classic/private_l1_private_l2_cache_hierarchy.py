@@ -46,6 +46,7 @@ from m5.objects import (
     L2XBar,
     Port,
     SystemXBar,
+    VictimCache,
 )
 
 from ....isas import ISA
@@ -87,6 +88,7 @@ class PrivateL1PrivateL2CacheHierarchy(
         l1i_size: str,
         l2_size: str,
         membus: Optional[BaseXBar] = None,
+        l1d_victim_size: Optional[str] = None,
     ) -> None:
         """
         :param l1d_size: The size of the L1 Data Cache (e.g., "32KiB").
@@ -98,6 +100,11 @@ class PrivateL1PrivateL2CacheHierarchy(
         :param membus: The memory bus. This parameter is optional parameter and
                        will default to a 64 bit width SystemXBar is not
                        specified.
+
+        :param l1d_victim_size: The size of a victim cache placed below each
+                                L1 Data Cache (e.g., "4KiB"). This parameter
+                                is optional and no victim cache is used if
+                                it is not specified.
         """
 
         AbstractClassicCacheHierarchy.__init__(self=self)
@@ -112,6 +119,7 @@ class PrivateL1PrivateL2CacheHierarchy(
         )
 
         self.membus = membus if membus else self._get_default_membus()
+        self._l1d_victim_size = l1d_victim_size
 
     @overrides(AbstractClassicCacheHierarchy)
     def get_mem_side_port(self) -> Port:
@@ -132,6 +140,11 @@ class PrivateL1PrivateL2CacheHierarchy(
         self.l2buses = [
             L2XBar() for i in range(board.get_processor().get_num_cores())
         ]
+        if self._l1d_victim_size:
+            self.l1d_victim_caches = [
+                VictimCache(size=self._l1d_victim_size)
+                for i in range(board.get_processor().get_num_cores())
+            ]
 
         for i, cpu in enumerate(board.get_processor().get_cores()):
             l2_node = self.add_root_child(
@@ -140,15 +153,25 @@ class PrivateL1PrivateL2CacheHierarchy(
             l1i_node = l2_node.add_child(
                 f"l1i-cache-{i}", L1ICache(size=self._l1i_size)
             )
+            # The victim caches capture the clean L1 evictions as well
             l1d_node = l2_node.add_child(
-                f"l1d-cache-{i}", L1DCache(size=self._l1d_size)
+                f"l1d-cache-{i}",
+                L1DCache(
+                    size=self._l1d_size,
+                    writeback_clean=self._l1d_victim_size is not None,
+                ),
             )
 
             self.l2buses[i].mem_side_ports = l2_node.cache.cpu_side
             self.membus.cpu_side_ports = l2_node.cache.mem_side
 
             l1i_node.cache.mem_side = self.l2buses[i].cpu_side_ports
-            l1d_node.cache.mem_side = self.l2buses[i].cpu_side_ports
+            if self._l1d_victim_size:
+                victim = self.l1d_victim_caches[i]
+                l1d_node.cache.mem_side = victim.cpu_side
+                victim.mem_side = self.l2buses[i].cpu_side_ports
+            else:
+                l1d_node.cache.mem_side = self.l2buses[i].cpu_side_ports
 
             cpu.connect_icache(l1i_node.cache.cpu_side)
             cpu.connect_dcache(l1d_node.cache.cpu_side)
@@ -33,6 +33,7 @@ from m5.objects import (
     L2XBar,
     Port,
     SystemXBar,
+    VictimCache,
 )
 
 from ....isas import ISA
@@ -80,6 +81,7 @@ class PrivateL1SharedL2CacheHierarchy(
         l1i_assoc: int = 8,
         l2_assoc: int = 16,
         membus: Optional[BaseXBar] = None,
+        l1d_victim_size: Optional[str] = None,
     ) -> None:
         """
         :param l1d_size: The size of the L1 Data Cache (e.g., "32KiB").
@@ -91,6 +93,10 @@ class PrivateL1SharedL2CacheHierarchy(
         :param membus: The memory bus. This parameter is optional parameter and
                        will default to a 64 bit width SystemXBar is not
                        specified.
+        :param l1d_victim_size: The size of a victim cache placed below each
+                                L1 Data Cache (e.g., "4KiB"). This parameter
+                                is optional and no victim cache is used if
+                                it is not specified.
         """
 
         AbstractClassicCacheHierarchy.__init__(self=self)
@@ -105,6 +111,7 @@ class PrivateL1SharedL2CacheHierarchy(
         )
 
         self.membus = membus if membus else self._get_default_membus()
+        self._l1d_victim_size = l1d_victim_size
 
     @overrides(AbstractClassicCacheHierarchy)
     def get_mem_side_port(self) -> Port:
@@ -130,10 +137,20 @@ class PrivateL1SharedL2CacheHierarchy(
             )
             for i in range(board.get_processor().get_num_cores())
         ]
+        # The victim caches capture the clean L1 evictions as well
         self.l1dcaches = [
-            L1DCache(size=self._l1d_size, assoc=self._l1d_assoc)
+            L1DCache(
+                size=self._l1d_size,
+                assoc=self._l1d_assoc,
+                writeback_clean=self._l1d_victim_size is not None,
+            )
             for i in range(board.get_processor().get_num_cores())
         ]
+        if self._l1d_victim_size:
+            self.l1d_victim_caches = [
+                VictimCache(size=self._l1d_victim_size)
+                for i in range(board.get_processor().get_num_cores())
+            ]
         self.l2bus = L2XBar()
         self.l2cache = L2Cache(size=self._l2_size, assoc=self._l2_assoc)
         # ITLB Page walk caches
@@ -155,7 +172,11 @@ class PrivateL1SharedL2CacheHierarchy(
             cpu.connect_dcache(self.l1dcaches[i].cpu_side)
 
             self.l1icaches[i].mem_side = self.l2bus.cpu_side_ports
-            self.l1dcaches[i].mem_side = self.l2bus.cpu_side_ports
+            if self._l1d_victim_size:
+                self.l1dcaches[i].mem_side = self.l1d_victim_caches[i].cpu_side
+                self.l1d_victim_caches[i].mem_side = self.l2bus.cpu_side_ports
+            else:
+                self.l1dcaches[i].mem_side = self.l2bus.cpu_side_ports
             self.iptw_caches[i].mem_side = self.l2bus.cpu_side_ports
             self.dptw_caches[i].mem_side = self.l2bus.cpu_side_ports
 
@@ -24,6 +24,10 @@
 # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+from .cxl import (
+    CXLDDR5_4400,
+    CXLMemory,
+)
 from .hbm import HBM2Stack
 from .multi_channel import (
     DualChannelDDR3_1600,
@@ -0,0 +1,119 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+""" CXL.mem type-3 memory expander
+"""
+
+from typing import (
+    Optional,
+    Sequence,
+    Tuple,
+    Type,
+    Union,
+)
+
+from m5.objects import (
+    AddrRange,
+    CXLMemDevice,
+    DRAMInterface,
+    Port,
+)
+
+from ...utils.override import overrides
+from .abstract_memory_system import AbstractMemorySystem
+from .dram_interfaces.ddr5 import DDR5_4400_4x8
+from .memory import (
+    ChanneledMemory,
+    MultiChannelMemory,
+)
+
+
+class CXLMemory(MultiChannelMemory):
+    """A memory expander attached over CXL.mem
+
+    The host reaches the memory through a CXLMemDevice, which models the
+    flit-based link and the protocol latency of the expander. Behind the
+    link, the DRAM channels of the expander are served by a single
+    MultiChannelMemCtrl, the device-side controller.
+    """
+
+    def __init__(
+        self,
+        dram_interface_class: Type[DRAMInterface],
+        num_channels: Union[int, str],
+        interleaving_size: Union[int, str],
+        size: Optional[str] = None,
+        addr_mapping: Optional[str] = None,
+        num_lanes: int = 16,
+        lane_speed: int = 32,
+        link_latency: str = "10ns",
+        protocol_latency: str = "25ns",
+    ) -> None:
+        """
+        :param num_lanes: The number of lanes of the CXL link.
+        :param lane_speed: The speed of each lane in Gb/s.
+        :param link_latency: The PHY, retimer and flight latency of each
+                             direction of the link.
+        :param protocol_latency: The link and transaction layer latency
+                                 of each direction of the link.
+
+        See ChanneledMemory for the other parameters.
+        """
+        super().__init__(
+            dram_interface_class,
+            num_channels,
+            interleaving_size,
+            size,
+            addr_mapping,
+        )
+
+        self.cxl_device = CXLMemDevice(
+            num_lanes=num_lanes,
+            lane_speed=lane_speed,
+            link_latency=link_latency,
+            protocol_latency=protocol_latency,
+        )
+        self.cxl_device.mem_side_port = self.mem_ctrl[0].port
+
+    @overrides(ChanneledMemory)
+    def set_memory_range(self, ranges: Sequence[AddrRange]) -> None:
+        super().set_memory_range(ranges)
+        self.cxl_device.range = self._mem_range
+
+    @overrides(ChanneledMemory)
+    def get_mem_ports(self) -> Sequence[Tuple[AddrRange, Port]]:
+        return [(self._mem_range, self.cxl_device.cpu_side_port)]
+
+
+def CXLDDR5_4400(
+    size: Optional[str] = None,
+    num_channels: int = 2,
+) -> AbstractMemorySystem:
+    """
+    A CXL memory expander with DDR5_4400_4x8 based channels behind a
+    x16 PCIe 5.0 link.
+    """
+    return CXLMemory(DDR5_4400_4x8, num_channels, 64, size=size)
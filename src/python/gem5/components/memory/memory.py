@@ -41,6 +41,7 @@ from m5.objects import (
     AddrRange,
     DRAMInterface,
     MemCtrl,
+    MultiChannelMemCtrl,
     Port,
 )
 from m5.util.convert import toMemorySize
@@ -157,8 +158,8 @@ class ChanneledMemory(AbstractMemorySystem):
             )
 
         intlv_bits = log(self._num_channels, 2)
-        for i, ctrl in enumerate(self.mem_ctrl):
-            ctrl.dram.range = AddrRange(
+        for i, dram in enumerate(self._dram):
+            dram.range = AddrRange(
                 start=self._mem_range.start,
                 size=self._mem_range.size(),
                 intlvHighBit=intlv_low_bit + intlv_bits - 1,
@@ -211,3 +212,55 @@ class ChanneledMemory(AbstractMemorySystem):
     @overrides(AbstractMemorySystem)
     def get_uninterleaved_range(self) -> List[AddrRange]:
         return [self._mem_range]
+
+
+class MultiChannelMemory(ChanneledMemory):
+    """A multi-channel memory system served by a single controller
+
+    Unlike ChanneledMemory, which creates a MemCtrl per channel and relies
+    on the crossbar for the channel interleaving, all channels are served
+    by one MultiChannelMemCtrl, with shared queues and a single scheduling
+    loop for all channels.
+    """
+
+    def __init__(
+        self,
+        dram_interface_class: Type[DRAMInterface],
+        num_channels: Union[int, str],
+        interleaving_size: Union[int, str],
+        size: Optional[str] = None,
+        addr_mapping: Optional[str] = None,
+        coordinated_write_drain: bool = False,
+    ) -> None:
+        """
+        :param coordinated_write_drain: Drain the writes of all channels
+                                        together when one channel has to.
+
+        See ChanneledMemory for the other parameters.
+        """
+        self._coordinated_write_drain = coordinated_write_drain
+        super().__init__(
+            dram_interface_class,
+            num_channels,
+            interleaving_size,
+            size,
+            addr_mapping,
+        )
+
+    @overrides(ChanneledMemory)
+    def _create_mem_interfaces_controller(self):
+        self._dram = [
+            self._dram_class(addr_mapping=self._addr_mapping)
+            for _ in range(self._num_channels)
+        ]
+
+        self.mem_ctrl = [
+            MultiChannelMemCtrl(
+                channels=self._dram,
+                coordinated_write_drain=self._coordinated_write_drain,
+            )
+        ]
+
+    @overrides(ChanneledMemory)
+    def get_mem_ports(self) -> Sequence[Tuple[AddrRange, Port]]:
+        return [(self._mem_range, self.mem_ctrl[0].port)]
@@ -0,0 +1,108 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Records the committed branches of an O3 CPU running a simple binary in SE
+mode, then replays the trace through a fresh copy of the CPU's branch
+predictor. The replay must see every recorded branch, and the trace must
+carry the instruction counts of the CPU, so that the MPKI is defined.
+"""
+
+import argparse
+import math
+import os
+import sys
+
+import m5
+from m5.objects import (
+    BranchTraceRecorder,
+    BranchTraceReplayer,
+    TournamentBP,
+)
+
+from gem5.components.boards.simple_board import SimpleBoard
+from gem5.components.cachehierarchies.classic.no_cache import NoCache
+from gem5.components.memory import SingleChannelDDR3_1600
+from gem5.components.processors.cpu_types import CPUTypes
+from gem5.components.processors.simple_processor import SimpleProcessor
+from gem5.isas import ISA
+from gem5.resources.resource import obtain_resource
+from gem5.simulate.simulator import Simulator
+
+parser = argparse.ArgumentParser(
+    description="Record a branch trace and replay it in the same run."
+)
+parser.add_argument(
+    "resource", type=str, help="The gem5 resource binary to run."
+)
+parser.add_argument(
+    "--resource-directory",
+    type=str,
+    required=False,
+    help="The directory in which resources will be downloaded or exist.",
+)
+args = parser.parse_args()
+
+processor = SimpleProcessor(cpu_type=CPUTypes.O3, isa=ISA.ARM, num_cores=1)
+board = SimpleBoard(
+    clk_freq="3GHz",
+    processor=processor,
+    memory=SingleChannelDDR3_1600(),
+    cache_hierarchy=NoCache(),
+)
+board.set_se_binary_workload(
+    obtain_resource(args.resource, resource_directory=args.resource_directory)
+)
+
+# the recorder finds the CPU to count instructions on by itself
+cpu = processor.get_cores()[0].get_simobject()
+cpu.branch_trace = BranchTraceRecorder(
+    manager=cpu.branchPred, trace_file="branches.trc.gz"
+)
+board.replayer = BranchTraceReplayer(
+    predictors=[TournamentBP()],
+    trace_file=os.path.join(m5.options.outdir, "branches.trc.gz"),
+    replay_threads=1,
+)
+
+simulator = Simulator(board=board)
+simulator.run()
+
+recorded = cpu.branch_trace.stopRecording()
+replayed = board.replayer.replay()
+
+predictor = board.replayer.predictors[0]
+insts = predictor.resolveStat("replay.insts").value
+mispredicted = predictor.resolveStat("replay.mispredicted").value
+mpki = mispredicted * 1000 / insts if insts else math.nan
+print(f"Recorded {recorded} branches, replayed {replayed}, MPKI {mpki:.3f}")
+
+if not recorded or replayed != recorded:
+    print("The replay does not cover the recorded branches", file=sys.stderr)
+    sys.exit(1)
+if not math.isfinite(mpki) or mpki <= 0:
+    print("The trace gives no valid MPKI", file=sys.stderr)
+    sys.exit(1)
@@ -0,0 +1,129 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Replays a short packet trace through three cache models: one the stream
+fits in, one it does not fit in, and one with a next-line prefetcher.
+The run fails unless the hit rate of every model, and the prefetch
+accuracy and coverage, are those the trace gives.
+"""
+
+import math
+import os
+import sys
+
+import m5
+from m5.objects import *
+
+# a stream of reads over one page of 64 byte lines, read twice
+line_size = 64
+num_lines = 64
+base_addr = 0x100000
+
+
+def varint(value):
+    out = bytearray()
+    while value > 0x7F:
+        out.append(value & 0x7F | 0x80)
+        value >>= 7
+    out.append(value)
+    return bytes(out)
+
+
+def message(*fields):
+    # fields are (number, value) pairs of integers, which are varints,
+    # and of strings, which are length delimited
+    body = b""
+    for number, value in fields:
+        if isinstance(value, str):
+            data = value.encode()
+            body += varint(number << 3 | 2) + varint(len(data)) + data
+        else:
+            body += varint(number << 3) + varint(value)
+    return varint(len(body)) + body
+
+
+def write_trace(path):
+    # the framing of src/proto/protoio.cc, with the PacketHeader and
+    # Packet messages of src/proto/packet.proto
+    with open(path, "wb") as trace:
+        trace.write(b"gem5")
+        trace.write(message((1, "stream"), (3, 10**12)))
+        for i in range(2 * num_lines):
+            addr = base_addr + (i % num_lines) * line_size
+            # ReadReq is 1 in the MemCmd enum of src/mem/packet.hh
+            trace.write(message((1, 1000 * i), (2, 1), (3, addr), (4, 8)))
+
+
+trace_file = os.path.join(m5.options.outdir, "stream.trc")
+write_trace(trace_file)
+
+models = {
+    "fits": TraceCacheModel(size="8KiB", assoc=4),
+    "thrashes": TraceCacheModel(size="2KiB", assoc=4),
+    "prefetches": TraceCacheModel(
+        size="8KiB", assoc=4, prefetcher=TaggedPrefetcher(degree=1)
+    ),
+}
+
+root = Root(full_system=False)
+root.system = System(cache_line_size=line_size)
+root.system.clk_domain = SrcClockDomain(
+    clock="1GHz", voltage_domain=VoltageDomain()
+)
+root.system.replayer = CacheTraceReplayer(
+    models=list(models.values()), trace_file=trace_file, replay_threads=1
+)
+
+m5.instantiate()
+
+replayed = root.system.replayer.replay()
+m5.stats.dump()
+
+# the second pass hits when the stream fits, and the prefetcher brings in
+# every line of the page but the first, which all get used
+expected = {
+    "fits": {"hitRate": 0.5},
+    "thrashes": {"hitRate": 0.0},
+    "prefetches": {
+        "hitRate": 127 / 128,
+        "prefetches": 63,
+        "accuracy": 1.0,
+        "coverage": 63 / 64,
+    },
+}
+
+failed = replayed != 2 * num_lines
+for name, stats in expected.items():
+    for stat, value in stats.items():
+        result = models[name].resolveStat(stat).total
+        print(f"{name}.{stat}: {result} (expected {value})")
+        if not math.isclose(result, value, abs_tol=1e-9):
+            failed = True
+
+if failed:
+    print("The replay does not give the expected stats", file=sys.stderr)
+    sys.exit(1)
@@ -24,15 +24,50 @@
 # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+import argparse
+
 import m5
 from m5.objects import *
 
 m5.util.addToPath("../../../configs/")
 from common.Caches import *
 
+parser = argparse.ArgumentParser()
+# Cache maintenance operations race with the writebacks of the lines
+# other testers share through false sharing, and check that the data
+# has reached memory when they complete
+parser.add_argument(
+    "--percent-cmos",
+    type=int,
+    default=0,
+    help="Percentage of cache maintenance operations",
+)
+# A victim cache under each L1 captures its evictions, and hands the
+# lines back or flushes them as the testers and the CMOs touch them
+parser.add_argument(
+    "--victim-size",
+    type=str,
+    default=None,
+    help="Size of a victim cache under each L1",
+)
+parser.add_argument(
+    "--mem-mode",
+    choices=["timing", "atomic"],
+    default="timing",
+    help="Memory mode to run the testers in",
+)
+args = parser.parse_args()
+
 # MAX CORES IS 8 with the fals sharing method
 nb_cores = 8
-cpus = [MemTest(max_loads=1e5, progress_interval=1e4) for i in range(nb_cores)]
+cpus = [
+    MemTest(
+        max_loads=1e5,
+        progress_interval=1e4,
+        percent_cmos=args.percent_cmos,
+    )
+    for i in range(nb_cores)
+]
 
 # system simulated
 system = System(cpu=cpus, physmem=SimpleMemory(), membus=SystemXBar())
@@ -59,9 +94,16 @@ system.l2c.mem_side = system.membus.cpu_side_ports
 for cpu in cpus:
     # All cpus are associated with cpu_clk_domain
     cpu.clk_domain = system.cpu_clk_domain
-    cpu.l1c = L1Cache(size="32KiB", assoc=4)
+    if args.victim_size:
+        # the victim cache needs the clean evictions too
+        cpu.l1c = L1Cache(size="32KiB", assoc=4, writeback_clean=True)
+        cpu.vc = VictimCache(size=args.victim_size)
+        cpu.l1c.mem_side = cpu.vc.cpu_side
+        cpu.vc.mem_side = system.toL2Bus.cpu_side_ports
+    else:
+        cpu.l1c = L1Cache(size="32KiB", assoc=4)
+        cpu.l1c.mem_side = system.toL2Bus.cpu_side_ports
     cpu.l1c.cpu_side = cpu.port
-    cpu.l1c.mem_side = system.toL2Bus.cpu_side_ports
 
 system.system_port = system.membus.cpu_side_ports
 
@@ -74,7 +116,7 @@ system.physmem.port = system.membus.mem_side_ports
 # -----------------------
 
 root = Root(full_system=False, system=system)
-root.system.mem_mode = "timing"
+root.system.mem_mode = args.mem_mode
 
 m5.instantiate()
 exit_event = m5.simulate()
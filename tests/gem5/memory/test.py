@@ -70,6 +70,32 @@ gem5_verify_config(
     length=constants.long_tag,
 )
 
+gem5_verify_config(
+    name="memtest-cmo",
+    verifiers=(),  # No need for verfiers this will return non-zero on fail
+    config=joinpath(getcwd(), "memtest-run.py"),
+    config_args=["--percent-cmos", "10"],
+    valid_isas=(constants.null_tag,),
+    length=constants.long_tag,
+)
+
+for mem_mode in ("timing", "atomic"):
+    gem5_verify_config(
+        name=f"memtest-victim-{mem_mode}",
+        verifiers=(),  # No need for verfiers this will return non-zero on fail
+        config=joinpath(getcwd(), "memtest-run.py"),
+        config_args=[
+            "--percent-cmos",
+            "10",
+            "--victim-size",
+            "1KiB",
+            "--mem-mode",
+            mem_mode,
+        ],
+        valid_isas=(constants.null_tag,),
+        length=constants.long_tag,
+    )
+
 null_tests = [
     ("garnet_synth_traffic", None, ["--sim-cycles", "5000000"]),
     ("memcheck", None, ["--maxtick", "2000000000", "--prefetchers"]),